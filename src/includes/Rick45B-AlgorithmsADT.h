@@ -34,12 +34,35 @@ typedef int (*RICK45B_forEach_t)(void *elem, void *opt);
  * it manipulates it. Must return -1 if an error has occurred, 0 otherwise.
  * The 'opt' argument is optional, and can be used for whatever user-defined purpose.
 */
+typedef int (*RICK45B_predicate_t)(const void *key, void *opt);
+/*
+ * Function used by the RemoveIf functions that, given a key, must return a number different from 0 if the key
+ * satisfies the predicate, 0 otherwise. It must not modify the ADT it is called on.
+ * The 'opt' argument is optional, and can be used for whatever user-defined purpose.
+*/
+typedef void* (*RICK45B_map_t)(void *key, void *opt);
+/*
+ * Function used by the map functions that, given a key, returns the key that takes its place in the new ADT,
+ * or NULL if an error has occurred. It must not modify the ADT it is called on.
+ * The 'opt' argument is optional, and can be used for whatever user-defined purpose.
+*/
+typedef int (*RICK45B_combine_t)(void *acc, void *elem, void *opt);
+/*
+ * Function used by the reduce functions that folds 'elem' (a key, or another accumulator) into the accumulator
+ * 'acc'. Must return -1 if an error has occurred, 0 otherwise.
+ * The 'opt' argument is optional, and can be used for whatever user-defined purpose.
+*/
+
+typedef size_t (*RICK45B_hash_t)(const void *key);
+/*
+ * Function used by the hash indexes that, given a key, returns its hash. Keys that are equal for the comparator
+ * of the ADT must have the same hash.
+*/
 
 /*structs*/
 struct listNode{
     void *key;
     struct listNode *next;
-    struct listNode *previous;
 };
 typedef struct listNode* listNode_t;
 
@@ -50,12 +73,58 @@ struct doubleListNode{
 };
 typedef struct doubleListNode* doubleListNode_t;
 
+#define RICK45BLISTS_MAX_THREADS 64  /*max number of threads used by the parallel functions of the lists.*/
+#define RICK45BLISTS_SKIP_MAX_LEVEL 32
+
+/*search modes of the lists: what RICK45BLISTS_GetNodeByKey(Double) does with the node it has found.*/
+#define RICK45BLISTS_SEARCH_PLAIN 0             /*nothing.*/
+#define RICK45BLISTS_SEARCH_MOVE_TO_FRONT 1     /*the node is moved to the head.*/
+#define RICK45BLISTS_SEARCH_TRANSPOSE 2         /*the node is swapped with the one before it.*/
+
+struct skipLink{
+    struct skipTower *next;         /*next tower on the same level, or NULL.*/
+    size_t span;                    /*number of list nodes the link moves forward (meaningless if 'next' is NULL).*/
+};
+
+struct skipTower{
+    listNode_t node;                /*indexed list node, NULL for the tower before the head.*/
+    size_t height;
+    struct skipLink links[];
+};
+
+struct skipIndex{
+    struct skipTower *head;         /*tower before the first list node, RICK45BLISTS_SKIP_MAX_LEVEL levels tall.*/
+    size_t levels;                  /*levels currently in use.*/
+    int valid;                      /*FALSE after an edit by node: the index is rebuilt at the next positional access.*/
+    unsigned long long seed;        /*state of the tower height generator.*/
+};
+
+struct hashSlot{
+    listNode_t node;                /*indexed list node, NULL for an empty slot.*/
+    size_t hash;                    /*hash of the node's key.*/
+};
+
+struct hashIndex{
+    RICK45B_hash_t hash;
+    struct hashSlot *slots;         /*open addressing table with linear probing, at most half full.*/
+    size_t capacity;                /*number of slots: a power of 2.*/
+    size_t count;                   /*number of nodes in the table.*/
+    int valid;                      /*FALSE after a bulk edit: the table is rebuilt at the next lookup.*/
+};
+
 struct list{
     listNode_t head;
     listNode_t tail;
+    listNode_t tailPrevious;        /*node before the tail, or NULL if not known yet (i.e. after a tail removal).*/
     RICK45B_comparator_t key_cmp;
     size_t size;
     listNode_t pointedNode;
+    struct allocator allocator;     /*used for the list itself.*/
+    struct allocator nodeAllocator; /*used for the nodes: same as 'allocator', unless a node pool is in use.*/
+    nodePool_t pool;                /*node pool of the list, or NULL.*/
+    struct skipIndex *index;        /*skip list index of an indexed list, NULL otherwise.*/
+    struct hashIndex *hashIndex;    /*hash index of the keys, NULL if not in use.*/
+    int searchMode;                 /*one of the RICK45BLISTS_SEARCH_... values.*/
 };
 typedef struct list* list_t;
 
@@ -65,13 +134,134 @@ struct doubleList{
     RICK45B_comparator_t key_cmp;
     size_t size;
     doubleListNode_t pointedNode;
+    doubleListNode_t cachedNode;    /*node returned by the last positional lookup, or NULL.*/
+    size_t cachedPosition;          /*position of 'cachedNode'.*/
+    struct allocator allocator;     /*used for the double list itself.*/
+    struct allocator nodeAllocator; /*used for the nodes: same as 'allocator', unless a node pool is in use.*/
+    nodePool_t pool;                /*node pool of the double list, or NULL.*/
+    int searchMode;                 /*one of the RICK45BLISTS_SEARCH_... values.*/
 };
 typedef struct doubleList* doubleList_t;
 
+struct listIterator{
+    list_t linkedList;
+    listNode_t next;        /*node that will be returned by the next step, NULL at the end of the list.*/
+    listNode_t current;     /*node returned by the last step, NULL if there's none (or it has been removed).*/
+    listNode_t previous;    /*node before 'current' (before 'next' if 'current' is NULL), NULL at the head.*/
+};
+typedef struct listIterator* listIterator_t;
+/*
+ * Iterators are meant to be allocated by the caller (i.e. on the stack), one per traversal. Unlike the
+ * 'pointedNode' field, an iterator is private to its owner, so any number of them can walk the same list.
+*/
+
+struct doubleListIterator{
+    doubleList_t dlinkedList;
+    doubleListNode_t next;      /*node returned by the next forward step, NULL at the end of the list.*/
+    doubleListNode_t previous;  /*node returned by the next backward step, NULL at the beginning of the list.*/
+    doubleListNode_t last;      /*node returned by the last step, NULL if there's none (or it has been removed).*/
+};
+typedef struct doubleListIterator* doubleListIterator_t;
+
+#define RICK45BLISTS_UNROLLED_CAPACITY 32   /*keys stored by every node of an unrolled list.*/
+
+struct unrolledListNode{
+    size_t count;                   /*keys in use, stored in keys[0] ... keys[count-1].*/
+    struct unrolledListNode *next;
+    void *keys[RICK45BLISTS_UNROLLED_CAPACITY];
+};
+typedef struct unrolledListNode* unrolledListNode_t;
+
+struct unrolledList{
+    unrolledListNode_t head;
+    unrolledListNode_t tail;
+    RICK45B_comparator_t key_cmp;
+    size_t size;                    /*number of keys.*/
+    struct allocator allocator;     /*used for the unrolled list and its nodes.*/
+};
+typedef struct unrolledList* unrolledList_t;
+
+struct unrolledListIterator{
+    unrolledList_t ulist;
+    unrolledListNode_t node;        /*node holding the key returned by the next step, NULL at the end.*/
+    size_t index;                   /*index of that key inside 'node'.*/
+};
+typedef struct unrolledListIterator* unrolledListIterator_t;
+
+#define RICK45BLISTS_HAZARDS 3      /*hazard pointers used by every operation on a concurrent list.*/
+
+struct concurrentListNode{
+    void *key;
+    struct concurrentListNode *next;    /*its low bits mark the node as deleted (and its key to be freed).*/
+    struct concurrentListNode *retired; /*next node waiting to be released, once unlinked.*/
+};
+typedef struct concurrentListNode* concurrentListNode_t;
+
+struct hazardRecord{
+    concurrentListNode_t hazards[RICK45BLISTS_HAZARDS]; /*nodes that must not be released yet.*/
+    int active;                     /*TRUE while an operation is using the record.*/
+    struct hazardRecord *next;      /*next record of the list, never changed once published.*/
+    concurrentListNode_t retired;   /*unlinked nodes waiting to be released, owned by the active operation.*/
+    size_t retiredCount;
+};
+
+struct concurrentList{
+    concurrentListNode_t head;
+    RICK45B_comparator_t key_cmp;
+    size_t size;                    /*updated atomically.*/
+    struct hazardRecord *records;   /*hazard records, one for every operation ever run at the same time.*/
+    size_t recordCount;
+    struct allocator allocator;     /*used for the concurrent list, its nodes and its records.*/
+};
+typedef struct concurrentList* concurrentList_t;
+
+struct intrusiveLink{
+    struct intrusiveLink *next;
+    struct intrusiveLink *previous;
+};
+typedef struct intrusiveLink* intrusiveLink_t;
+
+/*pointer to the object of type 'type' whose field 'member' is the given link.*/
+#define RICK45BLISTS_CONTAINER_OF(link, type, member) ((type *)(void *)((char *)(link)-offsetof(type, member)))
+
+struct intrusiveList{
+    intrusiveLink_t head;
+    intrusiveLink_t tail;
+    size_t offset;                  /*offset of the link inside the objects.*/
+    RICK45B_comparator_t key_cmp;   /*compares two objects.*/
+    size_t size;
+    struct allocator allocator;     /*used for the intrusive list itself: the links live inside the objects.*/
+};
+typedef struct intrusiveList* intrusiveList_t;
+
+struct xorListNode{
+    void *key;
+    size_t link;                    /*address of the previous node XOR address of the next one (NULL being 0).*/
+};
+typedef struct xorListNode* xorListNode_t;
+
+struct xorList{
+    xorListNode_t head;
+    xorListNode_t tail;
+    RICK45B_comparator_t key_cmp;
+    size_t size;
+    struct allocator allocator;     /*used for the xor list itself.*/
+    struct allocator nodeAllocator; /*used for the nodes: same as 'allocator', unless a node pool is in use.*/
+    nodePool_t pool;                /*node pool of the xor list, or NULL.*/
+};
+typedef struct xorList* xorList_t;
+
+struct xorListIterator{
+    xorList_t xlist;
+    xorListNode_t next;             /*node returned by the next step, NULL at the end of the walk.*/
+    xorListNode_t previous;         /*node returned by the last step, NULL if there's none.*/
+};
+typedef struct xorListIterator* xorListIterator_t;
+
 struct treeNode{
     void* key;
     void* value;
-    struct treeNode **childs;
+    struct treeNode *childs[2];     /*stored inline: [0] is the left child, [1] the right one.*/
 };
 typedef struct treeNode* treeNode_t;
 
@@ -79,18 +269,28 @@ struct binaryTree{
     treeNode_t root;
     RICK45B_comparator_t key_cmp;
     unsigned int treeType;  /*this field is for private use only, and should NEVER be accessed!*/
+    struct allocator allocator;     /*used for the tree itself.*/
+    struct allocator nodeAllocator; /*used for the nodes: same as 'allocator', unless a node pool is in use.*/
+    nodePool_t pool;                /*node pool of the tree, or NULL.*/
 };
 typedef struct binaryTree* Btree_t;
 
+#define RICK45BSTACK_ARRAY_DEFAULT_CAPACITY 16  /*initial capacity of an array-backed stack, if none is given.*/
+
 struct stack{
     list_t head;
     unsigned long int dim;
+    struct allocator allocator;     /*used for the stack itself and its internal list.*/
+    void **keys;                    /*keys of an array-backed stack, from the bottom to the top; NULL if the stack uses its list.*/
+    size_t size;                    /*number of keys in 'keys'.*/
+    size_t capacity;                /*number of slots of 'keys'.*/
 };
 typedef struct stack* stack_t;
 
 struct queue{
     list_t list;
     unsigned long int dim;
+    struct allocator allocator;     /*used for the queue itself and its internal list.*/
 };
 typedef struct queue* queue_t;
 
@@ -120,6 +320,48 @@ list_t RICK45BLISTS_ListCreate(RICK45B_comparator_t key_cmp);
  * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
 */
 
+list_t RICK45BLISTS_ListCreateWithAllocator(RICK45B_comparator_t key_cmp, allocator_t allocator);
+/*
+ * Function used to initialize a list that allocates itself and all of its nodes through the given allocator.
+ * Returns a list type, or NULL if an error occurred.
+ * Arguments:
+ * key_cmp -> function used to compare elements of the linked list.
+ * allocator -> the allocator to use. It is copied into the list, so it doesn't need to outlive the call.
+ * If NULL, the functions given to 'RICK45B_LibStart()' will be used.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+list_t RICK45BLISTS_IndexedListCreate(RICK45B_comparator_t key_cmp);
+/*
+ * Function used to initialize an indexed list: a list that keeps an indexable skip list over its nodes, with the
+ * number of nodes skipped by every link. It is used with the same functions of a regular list, but the positional
+ * ones (RICK45BLISTS_GetNodeByPosition, RICK45BLISTS_GetKeyByPosition, RICK45BLISTS_SetKeyByPosition,
+ * RICK45BLISTS_AddListNode and RICK45BLISTS_RemoveNode), together with the head and tail insertions and removals,
+ * take O(log n) time instead of O(n).
+ * The functions that edit the list by node or by key (iterators, RICK45BLISTS_AddListNodeAfter,
+ * RICK45BLISTS_RemoveNodeByKey...) don't update the index: it is rebuilt in O(n) time by the next positional access.
+ * Since that rebuild can happen during a lookup, an indexed list is not safe for concurrent readers.
+ * Returns a list type, or NULL if an error occurred.
+ * Arguments:
+ * key_cmp -> function used to compare elements of the linked list.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+list_t RICK45BLISTS_IndexedListCreateWithAllocator(RICK45B_comparator_t key_cmp, allocator_t allocator);
+/*
+ * Function used to initialize an indexed list (see RICK45BLISTS_IndexedListCreate) that allocates itself, its
+ * nodes and its index through the given allocator.
+ * Returns a list type, or NULL if an error occurred.
+ * Arguments:
+ * key_cmp -> function used to compare elements of the linked list.
+ * allocator -> the allocator to use. It is copied into the list, so it doesn't need to outlive the call.
+ * If NULL, the functions given to 'RICK45B_LibStart()' will be used.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
 void RICK45BLISTS_ListDestroy(list_t *linkedList, int delete_bool);
 /*
  * Function that, given a linkedList, it destroys it.
@@ -134,6 +376,160 @@ void RICK45BLISTS_ListDestroy(list_t *linkedList, int delete_bool);
  * Use a delete_bool different from 0 only if the list doesn't contains any stack-allocated data!!
 */
 
+int RICK45BLISTS_ListUseNodePool(list_t linkedList, size_t nodesPerChunk);
+/*
+ * Function that makes the given list take its nodes from a private node pool, allocated through the list's
+ * allocator 'nodesPerChunk' nodes at a time. Released nodes are kept in the pool for reuse, and the whole pool is
+ * released at once when the list is destroyed. Can only be called on an empty list.
+ * The functions moving nodes between two lists (concatenations, splices, splits, sorted unions and merges) make
+ * them share a single pool: the chunks of the source's pool are handed to the destination's, or an empty list
+ * without a pool joins the other one's. A shared pool is released with the last list using it, and it must not be
+ * used by two threads at the same time, even through different lists. Moving nodes between a list with a pool and
+ * a non-empty list without one is an error.
+ * Returns -1 if an error has occurred, 0 otherwise.
+ * Arguments:
+ * linkedList -> the list which should use the pool.
+ * nodesPerChunk -> number of nodes allocated at once. If 0, RICK45B_POOL_DEFAULT_CHUNK will be used.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+int RICK45BLISTS_ListUseHashIndex(list_t linkedList, RICK45B_hash_t hash);
+/*
+ * Function that makes the given list keep a hash index of its nodes' keys, allocated through the list's allocator.
+ * The index is updated by every insertion, removal and RICK45BLISTS_SetKey... call, so that
+ * RICK45BLISTS_GetNodeByKey takes O(1) expected time instead of O(n). If a key is held by more than one node, the
+ * lookup falls back to the scan, so that the first node is still the one returned.
+ * The functions that move whole ranges of nodes or hand the nodes to user code (concatenations, splits, sorted set
+ * operations, forEach functions) don't update the index: it is rebuilt in O(n) time by the next lookup.
+ * The keys of an indexed list must only be changed through the RICK45BLISTS_SetKey... functions.
+ * Since that rebuild can happen during a lookup, a list with a hash index is not safe for concurrent readers.
+ * Returns -1 if an error has occurred, 0 otherwise.
+ * Arguments:
+ * linkedList -> the list which should keep the index. It can already hold some nodes.
+ * hash -> function used to hash the keys of the list.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+int RICK45BLISTS_ListSetSearchMode(list_t linkedList, int mode);
+/*
+ * Function that sets what RICK45BLISTS_GetNodeByKey does with the node it has found, so that the list organizes
+ * itself around the keys looked up most often:
+ * RICK45BLISTS_SEARCH_PLAIN -> nothing (default).
+ * RICK45BLISTS_SEARCH_MOVE_TO_FRONT -> the node is moved to the head of the list.
+ * RICK45BLISTS_SEARCH_TRANSPOSE -> the node is swapped with the one before it.
+ * The nodes are relinked, never copied: nodes obtained before stay valid, but the order of the list changes under
+ * the lookups. No extra memory is used. Lookups answered by a hash index (see RICK45BLISTS_ListUseHashIndex) don't
+ * move the nodes. Not available for indexed lists, whose positions must not change under a lookup.
+ * Unless the mode is RICK45BLISTS_SEARCH_PLAIN, every lookup by key writes to the list, which is then not safe for
+ * concurrent readers.
+ * Returns -1 if an error has occurred, 0 otherwise.
+ * Arguments:
+ * linkedList -> the list to set.
+ * mode -> one of the RICK45BLISTS_SEARCH_... values.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+list_t RICK45BLISTS_ListFromArray(void **keys, size_t n, RICK45B_comparator_t key_cmp, allocator_t allocator);
+/*
+ * Function that creates a list holding the given keys, in the same order. Its n nodes are carved out of a single
+ * block, allocated at once and linked in memory order: the list uses a node pool (see RICK45BLISTS_ListUseNodePool)
+ * whose first chunk is that block, so removed nodes are kept for reuse and the block is released by
+ * RICK45BLISTS_ListDestroy. Later chunks, if needed, have the default size.
+ * Returns the new list, or NULL if an error has occurred.
+ * Arguments:
+ * keys -> array of n keys, none of them NULL. Can be NULL if n is 0.
+ * n -> number of keys.
+ * key_cmp -> comparator of the keys.
+ * allocator -> the allocator used for the list and its block. If NULL, the functions given to 'RICK45B_LibStart()' will be used.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+void **RICK45BLISTS_ListToArray(list_t linkedList, void **array, int reverse);
+/*
+ * Function that writes the keys of the list into a contiguous array, from the head to the tail (or from the
+ * tail to the head if 'reverse' is TRUE), with a single traversal of the list.
+ * Returns the array, or NULL if an error has occurred.
+ * Arguments:
+ * linkedList -> the list whose keys are copied.
+ * array -> array of at least RICK45BLISTS_GetListSize(linkedList) entries. If NULL, a new one is allocated through
+ * the functions given to 'RICK45B_LibStart()' (with at least one entry, even for an empty list), and the client
+ * should release it with the free function given to 'RICK45B_LibStart()'.
+ * reverse -> TRUE to copy the keys in reverse order, FALSE otherwise.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+int RICK45BLISTS_ListforEach(list_t linkedList, RICK45B_forEach_t funct, void *opt);
+/*
+ * Function that applies funct to every node of the list, from the head to the tail, with the 'opt' optional argument.
+ * The walk stops at the first call returning -1.
+ * Returns -1 if an error has occurred, 0 otherwise.
+ * Arguments:
+ * linkedList -> the list to walk.
+ * funct -> the function to apply, that gets a node (listNode_t) as its first argument.
+ * opt -> optional argument of the 'funct' function.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+ * BE CAREFUL when using this function: funct can change the node's key, but must not link or unlink nodes!
+*/
+
+int RICK45BLISTS_ListParallelforEach(list_t linkedList, RICK45B_forEach_t funct, void *opt, size_t threads);
+/*
+ * Function that works like RICK45BLISTS_ListforEach, but splits the list into 'threads' chunks of consecutive
+ * nodes and walks them at the same time, one worker thread per chunk (the calling thread walks the first one).
+ * funct is called concurrently, so it must be thread-safe (and so must be the use of 'opt'). A call returning -1
+ * only stops the walk of its own chunk.
+ * Returns -1 if an error has occurred, 0 otherwise.
+ * Arguments:
+ * linkedList -> the list to walk.
+ * funct -> the function to apply, that gets a node (listNode_t) as its first argument.
+ * opt -> optional argument of the 'funct' function.
+ * threads -> number of threads to use, at most RICK45BLISTS_MAX_THREADS. If 0 or 1, the calling thread walks the
+ * whole list. If the library is compiled with RICK45B_NO_THREADS defined, the chunks are walked one after another.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+ * The list must not be modified by other threads during the call.
+*/
+
+list_t RICK45BLISTS_ListParallelMap(list_t linkedList, RICK45B_map_t funct, void *opt, size_t threads);
+/*
+ * Function that creates a new list, with the same comparator and allocator, holding the keys returned by funct
+ * for every key of the given list, in the same order. The keys are mapped in parallel like
+ * RICK45BLISTS_ListParallelforEach does, then the new list is built like RICK45BLISTS_ListFromArray does.
+ * Returns the new list, or NULL if an error has occurred (i.e. funct returned NULL).
+ * Arguments:
+ * linkedList -> the list whose keys are mapped. It isn't modified.
+ * funct -> the mapping function, that gets a key as its first argument.
+ * opt -> optional argument of the 'funct' function.
+ * threads -> number of threads to use, like in RICK45BLISTS_ListParallelforEach.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+ * The keys returned by funct that were already added to the new list are NOT freed when an error occurs.
+*/
+
+int RICK45BLISTS_ListParallelReduce(list_t linkedList, RICK45B_combine_t fold, RICK45B_combine_t combine, void *accumulators, size_t accSize, void *opt, size_t threads);
+/*
+ * Function that reduces the keys of the list in parallel: the list is split like RICK45BLISTS_ListParallelforEach
+ * does, every thread folds the keys of its chunk, in order, into its own accumulator, and then the accumulators
+ * are combined, in order, into the first one. 'combine' must be associative, and every accumulator must start as
+ * its identity element (i.e. 0 for a sum).
+ * Returns -1 if an error has occurred, 0 otherwise. The result is in the first accumulator.
+ * Arguments:
+ * linkedList -> the list to reduce.
+ * fold -> the function that folds a key (its 'elem' argument) into an accumulator.
+ * combine -> the function that folds an accumulator (its 'elem' argument) into another one.
+ * accumulators -> array of 'threads' accumulators (at least one), 'accSize' bytes each.
+ * accSize -> size of every accumulator.
+ * opt -> optional argument of the 'fold' and 'combine' functions.
+ * threads -> number of threads to use, like in RICK45BLISTS_ListParallelforEach.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
 listNode_t RICK45BLISTS_GetNextNode(list_t linkedList);
 /*
  * Function that, given a linkedList, it shifts the current pointed node forward (to the next adjacent node).
@@ -183,6 +579,83 @@ int RICK45BLISTS_RewindList(list_t linkedList);
  * if the function returns -1, it is advised to check for an error message.
 */
 
+/*
+ * Read-only traversal: the iterator functions below (as every function that doesn't add, remove or set nodes,
+ * nor moves the 'pointedNode' field) only read the list. Any number of threads can therefore walk the same
+ * list at the same time, each one with its own iterator, as long as no thread modifies the list meanwhile.
+ * The 'pointedNode' functions above move a cursor shared by every user of the list, so they must not be used
+ * by concurrent readers. The same holds for the lookups that write to the list, even though they don't change
+ * its contents:
+ * - the positional lookups of the double linked list, which update the list's cached position;
+ * - the lookups by key (RICK45BLISTS_GetNodeByKey and the functions built on it) of a list with a search mode
+ *   (see RICK45BLISTS_ListSetSearchMode), which relink the node found;
+ * - the lookups by key of a list with a hash index (see RICK45BLISTS_ListUseHashIndex), which rebuild the index
+ *   if a previous edit has left it out of date;
+ * - the positional lookups of an indexed list (see RICK45BLISTS_IndexedListCreate), which rebuild the skip list
+ *   if a previous edit has left it out of date.
+ * Readers sharing such a list must be serialized by the caller, e.g. with a lock.
+*/
+
+int RICK45BLISTS_IteratorInit(listIterator_t iterator, list_t linkedList);
+/*
+ * Function that sets up the given iterator at the beginning of the given list.
+ * Returns -1 if an error has occurred, 0 otherwise.
+ * Arguments:
+ * iterator -> the iterator to set up, usually a 'struct listIterator' allocated on the stack.
+ * linkedList -> the list to walk.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+int RICK45BLISTS_IteratorHasNext(listIterator_t iterator);
+/*
+ * Function that checks if the given iterator has not reached the end of its list yet.
+ * Returns 1 if a node can still be returned, -1 if an error has occurred, 0 otherwise.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+listNode_t RICK45BLISTS_IteratorNext(listIterator_t iterator);
+/*
+ * Function that returns the node the given iterator is on, and moves the iterator to the following one.
+ * Returns the node, or NULL at the end of the list or if an error has occurred. i.e:
+ *
+ * struct listIterator it;
+ * listNode_t node;
+ * RICK45BLISTS_IteratorInit(&it, linkedList);
+ * while ((node = RICK45BLISTS_IteratorNext(&it)) != NULL) ...
+ *
+ * The node that has just been returned can be removed from the list without invalidating the iterator.
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+int RICK45BLISTS_IteratorAdd(listIterator_t iterator, void *key);
+/*
+ * Function that, in constant time, adds a new node with the given key right before the node the next step of the
+ * iterator will return (so after the last returned one, or at the head if no node has been returned yet).
+ * A following step is not affected, and adding more keys inserts them in order.
+ * Returns -1 if an error has occurred, 0 otherwise.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+int RICK45BLISTS_IteratorRemove(listIterator_t iterator, int delete_bool);
+/*
+ * Function that, in constant time, removes from the list the node returned by the last step of the iterator.
+ * It can be called once per step, and not right after 'RICK45BLISTS_IteratorAdd()'.
+ * Returns -1 if an error has occurred, 0 otherwise.
+ * Arguments:
+ * iterator -> the iterator pointing at the node to remove.
+ * delete_bool -> an integer number, used to interrogate the client if he wants to
+ * delete the users data as well with the node. i.e:
+ * 0 -> just delete (free) the node, and not its content.
+ * A number different from 0 -> delete (free), together with the node, the user defined contents
+ * as well.
+ *
+ * Iterators (and node handles) must not be used across changes made to the list by other means.
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
 int RICK45BLISTS_HeadAddListNode(void *key, list_t linkedList);
 /*
  * Function used to add a node at the HEAD of a linked list.
@@ -241,6 +714,7 @@ listNode_t RICK45BLISTS_GetNodeByKey(list_t linkedList, void* key);
 /*
  * Function used to get a Node by key.
  * Returns a the first listNode_t with that key, or NULL if an error has occurred.
+ * The node found is moved towards the head if the list has a search mode (see RICK45BLISTS_ListSetSearchMode).
  * Arguments:
  * key -> the key used for searching for the node.
  * linkedList -> the list where to search in.
@@ -359,7 +833,9 @@ void RICK45BLISTS_RemoveAllNodes(list_t linkedList, int delete_bool);
 
 int RICK45BLISTS_RemoveTail(list_t linkedList, int delete_bool);
 /*
- * Function that, given a list, it deletes (if presents) the node at it's tail.
+ * Function that, given a list, it deletes (if presents) the node at it's tail. The node before the tail is
+ * remembered by the list whenever it's known (i.e. after a tail insertion), so the removal takes constant time;
+ * otherwise the list is walked once to find it.
  * Returns -1 if an error has occurred, 0 otherwise.
  * Arguments:
  * linkedList -> the list to which delete the tail.
@@ -392,7 +868,8 @@ int RICK45BLISTS_RemoveNodeByKey(list_t linkedList, void *key, int delete_bool);
 
 int RICK45BLISTS_RemoveAllNodesByKey(list_t linkedList, void *key, int delete_bool);
 /*
- * Function that, given a list and a key value, it deletes (if present) all the nodes it encounters with that key.
+ * Function that, given a list and a key value, it deletes (if present) all the nodes it encounters with that key,
+ * in a single pass over the list.
  * Returns the number of nodes that have been deleted, or -1 if an error has occurred.
  * Arguments:
  * linkedList -> the list to which delete the nodes.
@@ -407,94 +884,399 @@ int RICK45BLISTS_RemoveAllNodesByKey(list_t linkedList, void *key, int delete_bo
  * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
 */
 
-/*  ***Double linked lists***   */
-
-doubleList_t RICK45BLISTS_DoubleListCreate(RICK45B_comparator_t key_cmp);
+int RICK45BLISTS_RemoveIf(list_t linkedList, RICK45B_predicate_t pred, void *opt, int delete_bool);
 /*
- * Function used to initialize a double linked list.
- * Returns a doubleList type, or NULL if an error occurred.
+ * Function that, in a single pass over the list, deletes every node whose key satisfies the given predicate.
+ * Returns the number of nodes that have been deleted, or -1 if an error has occurred.
  * Arguments:
- * key_cmp -> function used to compare elements of the double linked list.
+ * linkedList -> the list to which delete the nodes.
+ * pred -> the predicate, called once per node with the node's key and 'opt'.
+ * opt -> optional argument of the 'pred' function.
+ * delete_bool -> 0 to just delete (free) the nodes, a number different from 0 to free their keys as well.
  *
  * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
 */
 
-void RICK45BLISTS_DoubleListDestroy(doubleList_t *dlinkedList, int delete_bool);
+int RICK45BLISTS_ListSort(list_t linkedList);
 /*
- * Function that, given a double linkedList, it destroys it.
- * Returns nothing.
+ * Function that sorts the list in ascending order according to its key_cmp, with a stable bottom-up merge sort:
+ * nodes with equal keys keep their relative order. It takes O(n log n) time and no extra memory, as the nodes
+ * are only relinked.
+ * Returns -1 if an error has occurred, 0 otherwise.
  * Arguments:
- * dlinkedList -> the double linked list which you'd like to destroy
- * delete_bool -> an integer number, used to interrogate the client if he wants to
- * delete the users data as well with the node. i.e:
- * 0 -> just delete (free) the node, and not its content.
- * A number different from 0 -> delete (free), together with the node, the user defined contents
- * as well.
- * Use a delete_bool different from 0 only if the double linked list doesn't contains any stack-allocated data!!
+ * linkedList -> the list to sort.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
 */
 
-doubleListNode_t RICK45BLISTS_DoubleListGetNextNode(doubleList_t dlinkedList);
+int RICK45BLISTS_InsertSorted(void *key, list_t linkedList);
 /*
- * Function that, given a dlinkedList, it shifts the current pointed node forward (to the next adjacent node).
- * If the 'pointedNode' field already points to the tail of the list, nothing happens.
- * Returns the next node (if present), NULL otherwise.
+ * Function that adds a key to a list sorted in ascending order, keeping it sorted: the new node goes after every
+ * node with a key lower than or equal to it. Appending a key not lower than the tail takes O(1) time.
+ * Returns -1 if an error has occurred, 0 otherwise.
  * Arguments:
- * dlinkedList -> the double linkedList containing the 'pointedNode' field to shift.
+ * key -> the key to add.
+ * linkedList -> the sorted list where to add the key.
  *
- * it is STRONGLY RECOMMENDED to use this function together with the 'RICK45BLISTS_DoubleListHasNext()' function.
- * If the current pointed node has been deleted, the new pointed node will be the previous one,
- * or the new head, if it was already already pointing at the head of the list.
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
 */
 
-doubleListNode_t RICK45BLISTS_DoubleListGetPreviousNode(doubleList_t dlinkedList);
+int RICK45BLISTS_Concat(list_t dst, list_t src);
 /*
- * Function that, given a dlinkedList, it shifts the current pointed node backward (to the previous adjacent node).
- * If the 'pointedNode' field already points to the head of the list, nothing happens.
- * Returns the previous node (if present), NULL otherwise.
+ * Function that moves every node of 'src' to the end of 'dst', in O(1) time and without allocating anything.
+ * 'src' is left empty (but not destroyed). Since the nodes will be released by 'dst', both lists must take them
+ * from the same allocator, or from node pools (see RICK45BLISTS_ListUseNodePool, whose merge takes O(1) time as well).
+ * Returns -1 if an error has occurred, 0 otherwise.
  * Arguments:
- * dlinkedList -> the double linkedList containing the 'pointedNode' field to shift.
+ * dst -> the list that receives the nodes.
+ * src -> the list whose nodes are moved.
  *
- * it is STRONGLY RECOMMENDED to use this function together with the 'RICK45BLISTS_DoubleListHasPrevious()' and
- * 'RICK45BLISTS_DoubleListHasNext()' functions.
- * If the current pointed node has been deleted, the new pointed node will be the previous one,
- * or the new head, if it was already already pointing at the head of the list.
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
 */
 
-int RICK45BLISTS_DoubleListHasPrevious(doubleList_t dlinkedList);
+int RICK45BLISTS_SpliceAfter(list_t dst, listNode_t node, list_t src, listNode_t beforeFirst, listNode_t last);
 /*
- * Function that, given a dlinkedList, checks if its 'pointedNode' field has a previous valid node.
- * Returns 1 if a valid node is present, -1 if an error has occurred, 0 otherwise.
+ * Function that moves a range of consecutive nodes of 'src' into 'dst', right after 'node' (at the head if NULL),
+ * without allocating anything. The range goes from the node after 'beforeFirst' (the head of 'src' if NULL) up to
+ * 'last' included. The nodes are relinked in O(1) time, but they are counted to keep both sizes up to date, so
+ * the call takes O(k) time, k being the number of moved nodes.
+ * Both lists must take their nodes from the same allocator or from node pools, and must be different.
+ * Returns -1 if an error has occurred, 0 otherwise.
  * Arguments:
- * dlinkedList -> the double linkedList containing the 'pointedNode' field to check.
+ * dst -> the list that receives the nodes.
+ * node -> node of 'dst' after which the range goes, or NULL.
+ * src -> the list whose nodes are moved.
+ * beforeFirst -> node of 'src' right before the range, or NULL.
+ * last -> last node of the range.
  *
- * If the current pointed node has been deleted, the new pointed node will be the previous one,
- * or the new head, if it was already pointing at the head of the double linkedList.
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
 */
 
-int RICK45BLISTS_DoubleListHasNext(doubleList_t dlinkedList);
+list_t RICK45BLISTS_SplitAfter(list_t linkedList, listNode_t node);
 /*
- * Function that, given a dlinkedList, checks if its 'pointedNode' field has a next valid node.
- * Returns 1 if a valid node is present, -1 if an error has occurred, 0 otherwise.
+ * Function that splits the list right after the given node: every following node is moved, without being
+ * reallocated, into a new list with the same comparator and allocator (indexed, if the given list is). The new
+ * list shares the node pool of the given one, if any. The moved nodes are counted, so the call takes O(k) time,
+ * k being their number.
+ * Returns the new list (empty if 'node' is the tail), or NULL if an error has occurred.
  * Arguments:
- * dlinkedList -> the double linkedList containing the 'pointedNode' field to check.
+ * linkedList -> the list to split.
+ * node -> the node of the list that becomes its tail. If NULL, every node is moved.
  *
- * If the current pointed node has been deleted, the new pointed node will be the previous one,
- * or the new head, if it was already pointing at the head of the double linkedList.
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
 */
 
-doubleListNode_t RICK45BLISTS_DoubleListGetCurrentNode(doubleList_t dlinkedList);
+int RICK45BLISTS_SortedUnion(list_t dst, list_t src, int delete_bool);
 /*
- * Function that, once called, returns the current pointed node in the list. Remember that you can
- * visit the lists (and eventually change the current pointed node) by using the functions
- * 'RICK45BLISTS_DoubleListGetNextNode()', 'RICK45BLISTS_RewindDoubleList()' and 'RICK45BLISTS_DoubleListGetCurrentNode()'.
- * Returns the current pointed node by the internal field 'pointedNode' or NULL, if an error has occurred.
+ * Function that merges 'src' into 'dst', both sorted by their comparator, keeping 'dst' sorted. The nodes of 'src'
+ * whose key is equal to a key of 'dst' are released (with their key, if delete_bool is different from 0), the
+ * others are moved into 'dst' without being reallocated: 'src' is left empty. O(n+m) time.
+ * Both lists must take their nodes from the same allocator or from node pools, and must be different.
+ * Returns -1 if an error has occurred, 0 otherwise.
  * Arguments:
- * dlinkedList -> the double linkedList from where you'd like to get the current pointed node.
+ * dst -> the sorted list that receives the union.
+ * src -> the sorted list whose nodes are moved.
+ * delete_bool -> if different from 0, the keys of the released nodes are freed as well.
  *
- * REMEMBER THAT YOU SHOULD USE THIS FUNCTION AFTER CALLING AT LEAST ONCE THE FUNCTION
- * 'RICK45BLISTS_RewindDoubleList()', OTHERWISE THE VALUE 'NULL' WILL ALWAYS BE RETURNED!
- * If the current pointed node has been deleted, the new pointed node will be the previous one,
- * or the new head, if it was already pointing at the head of the double linkedList.
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+int RICK45BLISTS_SortedIntersection(list_t dst, list_t src, int delete_bool);
+/*
+ * Function that removes from 'dst' every key that isn't equal to a key of 'src', both lists being sorted by their
+ * comparator, in O(n+m) time. 'src' isn't modified, and the lists must be different.
+ * Returns the number of removed keys, or -1 if an error has occurred.
+ * Arguments:
+ * dst -> the sorted list that keeps the intersection.
+ * src -> the other sorted list.
+ * delete_bool -> if different from 0, the removed keys are freed as well.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+int RICK45BLISTS_SortedDifference(list_t dst, list_t src, int delete_bool);
+/*
+ * Function that removes from 'dst' every key that is equal to a key of 'src', both lists being sorted by their
+ * comparator, in O(n+m) time. 'src' isn't modified, and the lists must be different.
+ * Returns the number of removed keys, or -1 if an error has occurred.
+ * Arguments:
+ * dst -> the sorted list that keeps the difference.
+ * src -> the sorted list of the keys to remove.
+ * delete_bool -> if different from 0, the removed keys are freed as well.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+int RICK45BLISTS_SortedDedup(list_t linkedList, int delete_bool);
+/*
+ * Function that, given a sorted list, removes every key equal to the one before it, in a single pass.
+ * Returns the number of removed keys, or -1 if an error has occurred.
+ * Arguments:
+ * linkedList -> the sorted list.
+ * delete_bool -> if different from 0, the removed keys are freed as well.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+int RICK45BLISTS_SortedMerge(list_t dst, list_t *srcs, size_t k);
+/*
+ * Function that merges k sorted lists into the sorted list 'dst', keeping every key (equal keys keep the order
+ * of their lists, 'dst' first). The lists are merged in pairs, so the call takes O(n log k) time, n being the
+ * total number of nodes. The nodes are moved without being reallocated: every list of 'srcs' is left empty.
+ * Every list must take its nodes from the same allocator as 'dst', or all of them from node pools (an empty list
+ * without a pool can join them), and all of them must be different: a list given twice (or 'dst' among 'srcs') is
+ * an error. Every list is checked before anything is changed: on error, no node is moved and no pool is shared.
+ * Returns -1 if an error has occurred, 0 otherwise.
+ * Arguments:
+ * dst -> the sorted list that receives every node.
+ * srcs -> array of k sorted lists.
+ * k -> number of lists in 'srcs'.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+int RICK45BLISTS_AddListNodeAfter(void *key, list_t linkedList, listNode_t node);
+/*
+ * Function used to add, in constant time, a node right after the given node of a list.
+ * Returns -1 if an error has occurred, 0 otherwise.
+ * Arguments:
+ * key -> the key of the new node.
+ * linkedList -> the list containing the given node.
+ * node -> a node of the list, i.e. obtained from 'RICK45BLISTS_GetNodeByKey()' or from an iterator.
+ *
+ * Since a list node doesn't know the node before it, nodes can be added before a given one in constant
+ * time only through an iterator ('RICK45BLISTS_IteratorAdd()').
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+int RICK45BLISTS_RemoveNodeAfter(list_t linkedList, listNode_t node, int delete_bool);
+/*
+ * Function used to remove, in constant time, the node following the given node of a list.
+ * Returns -1 if an error has occurred (i.e. the given node is the tail), 0 otherwise.
+ * Arguments:
+ * linkedList -> the list containing the given node.
+ * node -> a node of the list.
+ * delete_bool -> an integer number, used to interrogate the client if he wants to
+ * delete the users data as well with the node. i.e:
+ * 0 -> just delete (free) the node, and not its content.
+ * A number different from 0 -> delete (free), together with the node, the user defined contents
+ * as well.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+/*  ***Double linked lists***   */
+
+doubleList_t RICK45BLISTS_DoubleListCreate(RICK45B_comparator_t key_cmp);
+/*
+ * Function used to initialize a double linked list.
+ * Returns a doubleList type, or NULL if an error occurred.
+ * Arguments:
+ * key_cmp -> function used to compare elements of the double linked list.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+doubleList_t RICK45BLISTS_DoubleListCreateWithAllocator(RICK45B_comparator_t key_cmp, allocator_t allocator);
+/*
+ * Function used to initialize a double linked list that allocates itself and all of its nodes through the given allocator.
+ * Returns a doubleList type, or NULL if an error occurred.
+ * Arguments:
+ * key_cmp -> function used to compare elements of the double linked list.
+ * allocator -> the allocator to use. It is copied into the double linked list, so it doesn't need to outlive the call.
+ * If NULL, the functions given to 'RICK45B_LibStart()' will be used.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+void RICK45BLISTS_DoubleListDestroy(doubleList_t *dlinkedList, int delete_bool);
+/*
+ * Function that, given a double linkedList, it destroys it.
+ * Returns nothing.
+ * Arguments:
+ * dlinkedList -> the double linked list which you'd like to destroy
+ * delete_bool -> an integer number, used to interrogate the client if he wants to
+ * delete the users data as well with the node. i.e:
+ * 0 -> just delete (free) the node, and not its content.
+ * A number different from 0 -> delete (free), together with the node, the user defined contents
+ * as well.
+ * Use a delete_bool different from 0 only if the double linked list doesn't contains any stack-allocated data!!
+*/
+
+int RICK45BLISTS_DoubleListUseNodePool(doubleList_t dlinkedList, size_t nodesPerChunk);
+/*
+ * Function that makes the given double linked list take its nodes from a private node pool, allocated through the double linked list's
+ * allocator 'nodesPerChunk' nodes at a time. Released nodes are kept in the pool for reuse, and the whole pool is
+ * released at once when the double linked list is destroyed. Can only be called on an empty double linked list.
+ * Returns -1 if an error has occurred, 0 otherwise.
+ * Arguments:
+ * dlinkedList -> the double linked list which should use the pool.
+ * nodesPerChunk -> number of nodes allocated at once. If 0, RICK45B_POOL_DEFAULT_CHUNK will be used.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+int RICK45BLISTS_DoubleListSetSearchMode(doubleList_t dlinkedList, int mode);
+/*
+ * Function that sets what RICK45BLISTS_GetNodeByKeyDouble does with the node it has found (see
+ * RICK45BLISTS_ListSetSearchMode). As there, a list with a search mode is not safe for concurrent readers.
+ * Returns -1 if an error has occurred, 0 otherwise.
+ * Arguments:
+ * dlinkedList -> the double linked list to set.
+ * mode -> one of the RICK45BLISTS_SEARCH_... values.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+doubleList_t RICK45BLISTS_DoubleListFromArray(void **keys, size_t n, RICK45B_comparator_t key_cmp, allocator_t allocator);
+/*
+ * Function that creates a double linked list holding the given keys, in the same order. Its n nodes are carved out
+ * of a single block, allocated at once and linked in memory order: the double linked list uses a node pool (see
+ * RICK45BLISTS_DoubleListUseNodePool) whose first chunk is that block, so removed nodes are kept for reuse and the
+ * block is released by RICK45BLISTS_DoubleListDestroy. Later chunks, if needed, have the default size.
+ * Returns the new double linked list, or NULL if an error has occurred.
+ * Arguments:
+ * keys -> array of n keys, none of them NULL. Can be NULL if n is 0.
+ * n -> number of keys.
+ * key_cmp -> comparator of the keys.
+ * allocator -> the allocator used for the double linked list and its block. If NULL, the functions given to 'RICK45B_LibStart()' will be used.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+void **RICK45BLISTS_DoubleListToArray(doubleList_t dlinkedList, void **array, int reverse);
+/*
+ * Function that writes the keys of the double linked list into a contiguous array, from the head to the tail
+ * (or from the tail to the head if 'reverse' is TRUE), with a single traversal of the double linked list.
+ * Returns the array, or NULL if an error has occurred.
+ * Arguments:
+ * dlinkedList -> the double linked list whose keys are copied.
+ * array -> array of at least RICK45BLISTS_GetDoubleListSize(dlinkedList) entries. If NULL, a new one is allocated
+ * like RICK45BLISTS_ListToArray does.
+ * reverse -> TRUE to copy the keys in reverse order, FALSE otherwise.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+int RICK45BLISTS_DoubleListforEach(doubleList_t dlinkedList, RICK45B_forEach_t funct, void *opt);
+/*
+ * Function that applies funct to every node of the double linked list, from the head to the tail, with the 'opt'
+ * optional argument. The walk stops at the first call returning -1.
+ * Returns -1 if an error has occurred, 0 otherwise.
+ * Arguments:
+ * dlinkedList -> the double linked list to walk.
+ * funct -> the function to apply, that gets a node (doubleListNode_t) as its first argument.
+ * opt -> optional argument of the 'funct' function.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+ * BE CAREFUL when using this function: funct can change the node's key, but must not link or unlink nodes!
+*/
+
+int RICK45BLISTS_DoubleListParallelforEach(doubleList_t dlinkedList, RICK45B_forEach_t funct, void *opt, size_t threads);
+/*
+ * Function that works like RICK45BLISTS_ListParallelforEach, on a double linked list.
+ * Returns -1 if an error has occurred, 0 otherwise.
+ * Arguments:
+ * dlinkedList -> the double linked list to walk.
+ * funct -> the function to apply, that gets a node (doubleListNode_t) as its first argument.
+ * opt -> optional argument of the 'funct' function.
+ * threads -> number of threads to use, like in RICK45BLISTS_ListParallelforEach.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+doubleList_t RICK45BLISTS_DoubleListParallelMap(doubleList_t dlinkedList, RICK45B_map_t funct, void *opt, size_t threads);
+/*
+ * Function that works like RICK45BLISTS_ListParallelMap, on a double linked list: the new double linked list is
+ * built like RICK45BLISTS_DoubleListFromArray does.
+ * Returns the new double linked list, or NULL if an error has occurred.
+ * Arguments:
+ * dlinkedList -> the double linked list whose keys are mapped. It isn't modified.
+ * funct -> the mapping function, that gets a key as its first argument.
+ * opt -> optional argument of the 'funct' function.
+ * threads -> number of threads to use, like in RICK45BLISTS_ListParallelforEach.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+int RICK45BLISTS_DoubleListParallelReduce(doubleList_t dlinkedList, RICK45B_combine_t fold, RICK45B_combine_t combine, void *accumulators, size_t accSize, void *opt, size_t threads);
+/*
+ * Function that works like RICK45BLISTS_ListParallelReduce, on a double linked list.
+ * Returns -1 if an error has occurred, 0 otherwise. The result is in the first accumulator.
+ * Arguments:
+ * dlinkedList -> the double linked list to reduce.
+ * fold -> the function that folds a key (its 'elem' argument) into an accumulator.
+ * combine -> the function that folds an accumulator (its 'elem' argument) into another one.
+ * accumulators -> array of 'threads' accumulators (at least one), 'accSize' bytes each.
+ * accSize -> size of every accumulator.
+ * opt -> optional argument of the 'fold' and 'combine' functions.
+ * threads -> number of threads to use, like in RICK45BLISTS_ListParallelforEach.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+doubleListNode_t RICK45BLISTS_DoubleListGetNextNode(doubleList_t dlinkedList);
+/*
+ * Function that, given a dlinkedList, it shifts the current pointed node forward (to the next adjacent node).
+ * If the 'pointedNode' field already points to the tail of the list, nothing happens.
+ * Returns the next node (if present), NULL otherwise.
+ * Arguments:
+ * dlinkedList -> the double linkedList containing the 'pointedNode' field to shift.
+ *
+ * it is STRONGLY RECOMMENDED to use this function together with the 'RICK45BLISTS_DoubleListHasNext()' function.
+ * If the current pointed node has been deleted, the new pointed node will be the previous one,
+ * or the new head, if it was already already pointing at the head of the list.
+*/
+
+doubleListNode_t RICK45BLISTS_DoubleListGetPreviousNode(doubleList_t dlinkedList);
+/*
+ * Function that, given a dlinkedList, it shifts the current pointed node backward (to the previous adjacent node).
+ * If the 'pointedNode' field already points to the head of the list, nothing happens.
+ * Returns the previous node (if present), NULL otherwise.
+ * Arguments:
+ * dlinkedList -> the double linkedList containing the 'pointedNode' field to shift.
+ *
+ * it is STRONGLY RECOMMENDED to use this function together with the 'RICK45BLISTS_DoubleListHasPrevious()' and
+ * 'RICK45BLISTS_DoubleListHasNext()' functions.
+ * If the current pointed node has been deleted, the new pointed node will be the previous one,
+ * or the new head, if it was already already pointing at the head of the list.
+*/
+
+int RICK45BLISTS_DoubleListHasPrevious(doubleList_t dlinkedList);
+/*
+ * Function that, given a dlinkedList, checks if its 'pointedNode' field has a previous valid node.
+ * Returns 1 if a valid node is present, -1 if an error has occurred, 0 otherwise.
+ * Arguments:
+ * dlinkedList -> the double linkedList containing the 'pointedNode' field to check.
+ *
+ * If the current pointed node has been deleted, the new pointed node will be the previous one,
+ * or the new head, if it was already pointing at the head of the double linkedList.
+*/
+
+int RICK45BLISTS_DoubleListHasNext(doubleList_t dlinkedList);
+/*
+ * Function that, given a dlinkedList, checks if its 'pointedNode' field has a next valid node.
+ * Returns 1 if a valid node is present, -1 if an error has occurred, 0 otherwise.
+ * Arguments:
+ * dlinkedList -> the double linkedList containing the 'pointedNode' field to check.
+ *
+ * If the current pointed node has been deleted, the new pointed node will be the previous one,
+ * or the new head, if it was already pointing at the head of the double linkedList.
+*/
+
+doubleListNode_t RICK45BLISTS_DoubleListGetCurrentNode(doubleList_t dlinkedList);
+/*
+ * Function that, once called, returns the current pointed node in the list. Remember that you can
+ * visit the lists (and eventually change the current pointed node) by using the functions
+ * 'RICK45BLISTS_DoubleListGetNextNode()', 'RICK45BLISTS_RewindDoubleList()' and 'RICK45BLISTS_DoubleListGetCurrentNode()'.
+ * Returns the current pointed node by the internal field 'pointedNode' or NULL, if an error has occurred.
+ * Arguments:
+ * dlinkedList -> the double linkedList from where you'd like to get the current pointed node.
+ *
+ * REMEMBER THAT YOU SHOULD USE THIS FUNCTION AFTER CALLING AT LEAST ONCE THE FUNCTION
+ * 'RICK45BLISTS_RewindDoubleList()', OTHERWISE THE VALUE 'NULL' WILL ALWAYS BE RETURNED!
+ * If the current pointed node has been deleted, the new pointed node will be the previous one,
+ * or the new head, if it was already pointing at the head of the double linkedList.
 */
 
 int RICK45BLISTS_RewindDoubleList(doubleList_t dlinkedList);
@@ -507,6 +1289,92 @@ int RICK45BLISTS_RewindDoubleList(doubleList_t dlinkedList);
  * if the function returns -1, it is advised to check for an error message.
 */
 
+/*
+ * Read-only traversal: just like the ones of the lists, the double linked list iterators only read the double
+ * linked list, so any number of threads can walk it at the same time with their own iterator, as long as no
+ * thread modifies it (or moves its 'pointedNode' field) meanwhile.
+*/
+
+int RICK45BLISTS_DoubleIteratorInit(doubleListIterator_t iterator, doubleList_t dlinkedList);
+/*
+ * Function that sets up the given iterator at the beginning (before the head) of the given double linked list.
+ * Returns -1 if an error has occurred, 0 otherwise.
+ * Arguments:
+ * iterator -> the iterator to set up, usually a 'struct doubleListIterator' allocated on the stack.
+ * dlinkedList -> the double linked list to walk.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+int RICK45BLISTS_DoubleIteratorInitTail(doubleListIterator_t iterator, doubleList_t dlinkedList);
+/*
+ * Function that sets up the given iterator at the end (after the tail) of the given double linked list, so that
+ * it can be walked backwards.
+ * Returns -1 if an error has occurred, 0 otherwise.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+int RICK45BLISTS_DoubleIteratorHasNext(doubleListIterator_t iterator);
+/*
+ * Function that checks if a forward step of the given iterator would return a node.
+ * Returns 1 if so, -1 if an error has occurred, 0 otherwise.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+int RICK45BLISTS_DoubleIteratorHasPrevious(doubleListIterator_t iterator);
+/*
+ * Function that checks if a backward step of the given iterator would return a node.
+ * Returns 1 if so, -1 if an error has occurred, 0 otherwise.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+doubleListNode_t RICK45BLISTS_DoubleIteratorNext(doubleListIterator_t iterator);
+/*
+ * Function that moves the given iterator one node forward, returning the node it has stepped over.
+ * Returns the node, or NULL at the end of the double linked list or if an error has occurred.
+ * A forward step followed by a backward one returns the same node twice.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+doubleListNode_t RICK45BLISTS_DoubleIteratorPrevious(doubleListIterator_t iterator);
+/*
+ * Function that moves the given iterator one node backward, returning the node it has stepped over.
+ * Returns the node, or NULL at the beginning of the double linked list or if an error has occurred.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+int RICK45BLISTS_DoubleIteratorAdd(doubleListIterator_t iterator, void *key);
+/*
+ * Function that, in constant time, adds a new node with the given key at the iterator's position: after the
+ * node a backward step would return, and before the one a forward step would return. A following forward step
+ * is not affected, while a following backward step returns the new node.
+ * Returns -1 if an error has occurred, 0 otherwise.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+int RICK45BLISTS_DoubleIteratorRemove(doubleListIterator_t iterator, int delete_bool);
+/*
+ * Function that, in constant time, removes from the double linked list the node returned by the last step
+ * (forward or backward) of the iterator. It can be called once per step, and not right after
+ * 'RICK45BLISTS_DoubleIteratorAdd()'.
+ * Returns -1 if an error has occurred, 0 otherwise.
+ * Arguments:
+ * iterator -> the iterator that returned the node to remove.
+ * delete_bool -> an integer number, used to interrogate the client if he wants to
+ * delete the users data as well with the node. i.e:
+ * 0 -> just delete (free) the node, and not its content.
+ * A number different from 0 -> delete (free), together with the node, the user defined contents
+ * as well.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
 int RICK45BLISTS_HeadAddDoubleListNode(void *key, doubleList_t dlinkedList);
 /*
  * Function used to add a node at the HEAD of a double linked list.
@@ -553,184 +1421,991 @@ int RICK45BLISTS_AddDoubleListNode(void *key, doubleList_t dlinkedList, size_t p
 doubleListNode_t RICK45BLISTS_GetNodeByPositionDouble(doubleList_t dlinkedList, size_t position);
 /*
  * Function used to get a Node by position.
+ * The walk starts from the closest of the head, the tail and the node returned by the last positional lookup,
+ * so scanning the list by increasing (or decreasing) positions costs O(1) per call.
  * Returns a doubleListNode_t, or NULL if an error has occurred.
  * Arguments:
- * position -> position of the node to fetch.
- * dlinkedList -> the double linked list where to search for the node.
+ * position -> position of the node to fetch, going from 0 to size-1.
+ * dlinkedList -> the double linked list where to search for the node.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+doubleListNode_t RICK45BLISTS_GetNodeByKeyDouble(doubleList_t dlinkedList, void* key);
+/*
+ * Function used to get a Node by key.
+ * Returns a the first doubleListNode_t with that key, or NULL if an error has occurred.
+ * The node found is moved towards the head if the list has a search mode (see RICK45BLISTS_DoubleListSetSearchMode).
+ * Arguments:
+ * key -> the key used for searching for the node.
+ * dlinkedList -> the double linked list where to search in.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+void *RICK45BLISTS_GetKeyByNodeDouble(doubleListNode_t node);
+/*
+ * Function that, given a Node, it returns its key. It is pretty useless, but
+ * might be useful to obtain a more verbose programming.
+ * Returns a key, or NULL if an error has occurred.
+ * Arguments:
+ * node -> the node where to get the key from.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+void *RICK45BLISTS_GetKeyByPositionDouble(doubleList_t dlinkedList, size_t position);
+/*
+ * Function that, given a position and a double linkedList, it returns the key at that position.
+ * It walks the list like RICK45BLISTS_GetNodeByPositionDouble.
+ * Returns a key, or NULL if an error has occurred.
+ * Arguments:
+ * dlinkedList -> the double linkedList where to get the key from.
+ * position -> the position of the key in the double linkedList to fetch, going from 0 to size-1.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+void *RICK45BLISTS_SetKeyByPositionDouble(doubleList_t dlinkedList, void* newkey, size_t position);
+/*
+ * Function that, given a position, a double linkedList and a key, it sets the key of the node at that
+ * position to newkey.
+ * Return the previously stored key on that node, or NULL if an error has occurred.
+ * Arguments:
+ * dlinkedList -> the double linkedList where to set the key.
+ * position -> the position of the node in the double linkedList at which to set the new key.
+ * newkey -> the new key of the node at the specified position, that will replace the old one.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+void *RICK45BLISTS_SetKeyByNodeDouble(doubleList_t dlinkedList, void* newkey, doubleListNode_t node);
+/*
+ * Function that given a node, a double linkedList, and a key, sets the key of the given node to newkey.
+ * Return the previously stored key on that node, or NULL if an error has occurred.
+ * Arguments:
+ * dlinkedList -> the double linkedList where to set the key.
+ * newkey -> the new key of the node at the specified position, that will replace the old one.
+ * node -> the node to which set the new key.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+int RICK45BLISTS_SetKeyByKeyDouble(doubleList_t dlinkedList, void* newkey, void* oldkey);
+/*
+ * Function that, given a new key, a double linkedList and a old key, sets all the keys of the given double linkedList
+ * that equals to oldkey, to newkey.
+ * Returns the number of replaced keys, -1 if an error has occurred.
+ * Arguments:
+ * dlinkedList -> the list where to set the key.
+ * newkey -> the new key of the node, that will replace the old one.
+ * oldkey -> the key that identifies all the nodes which their keys must be updated.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+int RICK45BLISTS_RemoveNodeDouble(doubleList_t dlinkedList, size_t position, int delete_bool);
+/*
+ * Function that, given a double linkedList and a position, it deletes the node at that position.
+ * PLEASE, REMEMBER THAT THE LIST IS INDEXED LIKE AN ARRAY, STARTING FROM ZERO!
+ * Returns -1 if an error has occurred, 0 otherwise.
+ * Arguments:
+ * dlinkedList -> the double linkedList to which delete the node.
+ * position -> the index of the node to delete.
+ * delete_bool -> an integer number, used to interrogate the client if he wants to
+ * delete the users data as well with the node. i.e:
+ *
+ * 0 -> just delete (free) the node, and not its content.
+ * A number different from 0 -> delete (free), together with the node, the user defined contents
+ * as well.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+int RICK45BLISTS_RemoveTailDouble(doubleList_t dlinkedList, int delete_bool);
+/*
+ * Function that, given a double linkedList, it deletes (if presents) the node at it's tail.
+ * Returns -1 if an error has occurred, 0 otherwise.
+ * Arguments:
+ * dlinkedList -> the double linkedList to which delete the tail.
+ * delete_bool -> an integer number, used to interrogate the client if he wants to
+ * delete the users data as well with the node. i.e:
+ *
+ * 0 -> just delete (free) the node, and not its content.
+ * A number different from 0 -> delete (free), together with the node, the user defined contents
+ * as well.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+int RICK45BLISTS_RemoveNodeByKeyDouble(doubleList_t dlinkedList, void *key, int delete_bool);
+/*
+ * Function that, given a double linkedList and a key value, it deletes (if presents) the first node it encounters with that key.
+ * Returns 0 if nothing has been deleted, 1 if something has been deleted and -1 if an error has occurred.
+ * Arguments:
+ * dlinkedList -> the double linkedList to which delete the node.
+ * key -> they key of the node to remove.
+ * delete_bool -> an integer number, used to interrogate the client if he wants to
+ * delete the users data as well with the node. i.e:
+ *
+ * 0 -> just delete (free) the node, and not its content.
+ * A number different from 0 -> delete (free), together with the node, the user defined contents
+ * as well.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+int RICK45BLISTS_RemoveAllNodesByKeyDouble(doubleList_t dlinkedList, void *key, int delete_bool);
+/*
+ * Function that, given a double linkedList and a key value, it deletes (if present) all the nodes it encounters with that key,
+ * in a single pass over the double linkedList.
+ * Returns the number of nodes that have been deleted, or -1 if an error has occurred.
+ * Arguments:
+ * dlinkedList -> the double linkedList to which delete the nodes.
+ * key -> they key of the nodes to remove.
+ * delete_bool -> an integer number, used to interrogate the client if he wants to
+ * delete the users data as well with the node. i.e:
+ *
+ * 0 -> just delete (free) the node, and not its content.
+ * A number different from 0 -> delete (free), together with the node, the user defined contents
+ * as well.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+int RICK45BLISTS_RemoveIfDouble(doubleList_t dlinkedList, RICK45B_predicate_t pred, void *opt, int delete_bool);
+/*
+ * Function that, in a single pass over the double linkedList, deletes every node whose key satisfies the given predicate.
+ * Returns the number of nodes that have been deleted, or -1 if an error has occurred.
+ * Arguments:
+ * dlinkedList -> the double linkedList to which delete the nodes.
+ * pred -> the predicate, called once per node with the node's key and 'opt'.
+ * opt -> optional argument of the 'pred' function.
+ * delete_bool -> 0 to just delete (free) the nodes, a number different from 0 to free their keys as well.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+int RICK45BLISTS_DoubleListSort(doubleList_t dlinkedList);
+/*
+ * Function that sorts the double linkedList in ascending order according to its key_cmp, with a stable bottom-up
+ * merge sort: nodes with equal keys keep their relative order. It takes O(n log n) time and no extra memory, as the
+ * nodes are only relinked.
+ * Returns -1 if an error has occurred, 0 otherwise.
+ * Arguments:
+ * dlinkedList -> the double linkedList to sort.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+int RICK45BLISTS_InsertSortedDouble(void *key, doubleList_t dlinkedList);
+/*
+ * Function that adds a key to a double linkedList sorted in ascending order, keeping it sorted: the new node goes
+ * after every node with a key lower than or equal to it. The place is searched for starting from the tail, so
+ * adding keys in (almost) ascending order takes O(1) time per key.
+ * Returns -1 if an error has occurred, 0 otherwise.
+ * Arguments:
+ * key -> the key to add.
+ * dlinkedList -> the sorted double linkedList where to add the key.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+int RICK45BLISTS_ConcatDouble(doubleList_t dst, doubleList_t src);
+/*
+ * Function that moves every node of 'src' to the end of 'dst', in O(1) time and without allocating anything.
+ * 'src' is left empty (but not destroyed). Since the nodes will be released by 'dst', both double linkedLists must
+ * take them from the same allocator, or from node pools (see RICK45BLISTS_ListUseNodePool, whose merge takes O(1) time as well).
+ * Returns -1 if an error has occurred, 0 otherwise.
+ * Arguments:
+ * dst -> the double linkedList that receives the nodes.
+ * src -> the double linkedList whose nodes are moved.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+int RICK45BLISTS_SpliceAfterDouble(doubleList_t dst, doubleListNode_t node, doubleList_t src, doubleListNode_t first, doubleListNode_t last);
+/*
+ * Function that moves the range of consecutive nodes of 'src' going from 'first' to 'last' (both included) into
+ * 'dst', right after 'node' (at the head if NULL), without allocating anything. The nodes are relinked in O(1)
+ * time, but they are counted to keep both sizes up to date, so the call takes O(k) time, k being their number.
+ * Both double linkedLists must take their nodes from the same allocator or from node pools, and must be different.
+ * Returns -1 if an error has occurred, 0 otherwise.
+ * Arguments:
+ * dst -> the double linkedList that receives the nodes.
+ * node -> node of 'dst' after which the range goes, or NULL.
+ * src -> the double linkedList whose nodes are moved.
+ * first -> first node of the range.
+ * last -> last node of the range.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+doubleList_t RICK45BLISTS_SplitAfterDouble(doubleList_t dlinkedList, doubleListNode_t node);
+/*
+ * Function that splits the double linkedList right after the given node: every following node is moved, without
+ * being reallocated, into a new double linkedList with the same comparator and allocator.
+ * The size of the two parts is found by walking away from 'node' in both directions at once, so the call takes
+ * O(min(k, n-k)) time, k being the number of moved nodes. The new double linkedList shares the node pool of the
+ * given one, if any.
+ * Returns the new double linkedList (empty if 'node' is the tail), or NULL if an error has occurred.
+ * Arguments:
+ * dlinkedList -> the double linkedList to split.
+ * node -> the node of the double linkedList that becomes its tail. If NULL, every node is moved.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+int RICK45BLISTS_SortedUnionDouble(doubleList_t dst, doubleList_t src, int delete_bool);
+/*
+ * Function that works like RICK45BLISTS_SortedUnion, on double linked lists.
+ * Returns -1 if an error has occurred, 0 otherwise.
+ * Arguments:
+ * dst -> the sorted double linked list that receives the union.
+ * src -> the sorted double linked list whose nodes are moved.
+ * delete_bool -> if different from 0, the keys of the released nodes are freed as well.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+int RICK45BLISTS_SortedIntersectionDouble(doubleList_t dst, doubleList_t src, int delete_bool);
+/*
+ * Function that works like RICK45BLISTS_SortedIntersection, on double linked lists.
+ * Returns the number of removed keys, or -1 if an error has occurred.
+ * Arguments:
+ * dst -> the sorted double linked list that keeps the intersection.
+ * src -> the other sorted double linked list.
+ * delete_bool -> if different from 0, the removed keys are freed as well.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+int RICK45BLISTS_SortedDifferenceDouble(doubleList_t dst, doubleList_t src, int delete_bool);
+/*
+ * Function that works like RICK45BLISTS_SortedDifference, on double linked lists.
+ * Returns the number of removed keys, or -1 if an error has occurred.
+ * Arguments:
+ * dst -> the sorted double linked list that keeps the difference.
+ * src -> the sorted double linked list of the keys to remove.
+ * delete_bool -> if different from 0, the removed keys are freed as well.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+int RICK45BLISTS_SortedDedupDouble(doubleList_t dlinkedList, int delete_bool);
+/*
+ * Function that works like RICK45BLISTS_SortedDedup, on a double linked list.
+ * Returns the number of removed keys, or -1 if an error has occurred.
+ * Arguments:
+ * dlinkedList -> the sorted double linked list.
+ * delete_bool -> if different from 0, the removed keys are freed as well.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+int RICK45BLISTS_SortedMergeDouble(doubleList_t dst, doubleList_t *srcs, size_t k);
+/*
+ * Function that works like RICK45BLISTS_SortedMerge, on double linked lists.
+ * Returns -1 if an error has occurred, 0 otherwise.
+ * Arguments:
+ * dst -> the sorted double linked list that receives every node.
+ * srcs -> array of k sorted double linked lists.
+ * k -> number of double linked lists in 'srcs'.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+int RICK45BLISTS_AddDoubleListNodeAfter(void *key, doubleList_t dlinkedList, doubleListNode_t node);
+/*
+ * Function used to add, in constant time, a node right after the given node of a double linked list.
+ * Returns -1 if an error has occurred, 0 otherwise.
+ * Arguments:
+ * key -> the key of the new node.
+ * dlinkedList -> the double linked list containing the given node.
+ * node -> a node of the double linked list, i.e. obtained from 'RICK45BLISTS_GetNodeByKeyDouble()' or from an iterator.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+int RICK45BLISTS_AddDoubleListNodeBefore(void *key, doubleList_t dlinkedList, doubleListNode_t node);
+/*
+ * Function used to add, in constant time, a node right before the given node of a double linked list.
+ * Returns -1 if an error has occurred, 0 otherwise.
+ * Arguments:
+ * key -> the key of the new node.
+ * dlinkedList -> the double linked list containing the given node.
+ * node -> a node of the double linked list.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+int RICK45BLISTS_RemoveByNodeDouble(doubleList_t dlinkedList, doubleListNode_t node, int delete_bool);
+/*
+ * Function used to remove, in constant time, the given node from a double linked list.
+ * Returns -1 if an error has occurred, 0 otherwise.
+ * Arguments:
+ * dlinkedList -> the double linked list containing the given node.
+ * node -> the node to remove.
+ * delete_bool -> an integer number, used to interrogate the client if he wants to
+ * delete the users data as well with the node. i.e:
+ * 0 -> just delete (free) the node, and not its content.
+ * A number different from 0 -> delete (free), together with the node, the user defined contents
+ * as well.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+void RICK45BLISTS_DoubleListRemoveAllNodes(doubleList_t dlinkedList, int delete_bool);
+/*
+ * Function that, given a double linked list, it deletes (if presents) all its nodes.
+ * Returns nothing.
+ * Arguments:
+ * dlinkedList -> the double linked list to which delete all the nodes.
+ * delete_bool -> an integer number, used to interrogate the client if he wants to
+ * delete the users data as well with the nodes. i.e:
+ *
+ * 0 -> just delete (free) the node, and not its content.
+ * A number different from 0 -> delete (free), together with the node, the user defined contents
+ * as well.
+ * Use a delete_bool different from 0 only if the double linked list doesn't contains any stack-allocated data!!
+*/
+
+int RICK45BLISTS_DoubleListRemoveHead(doubleList_t dlinkedList, int delete_bool);
+/*
+ * Function that, given a double linked list, it deletes (if presents) the node at the head.
+ * Returns -1 if an error has occurred, 0 otherwise.
+ * Arguments:
+ * dlinkedList -> the double linked list to which delete the head.
+ * delete_bool -> an integer number, used to interrogate the client if he wants to
+ * delete the users data as well with the node. i.e:
+ *
+ * 0 -> just delete (free) the node, and not its content.
+ * A number different from 0 -> delete (free), together with the node, the user defined contents
+ * as well.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+/*  ***Unrolled linked lists***   */
+/*
+ * An unrolled list stores up to RICK45BLISTS_UNROLLED_CAPACITY keys in every node, so walking it touches a few
+ * contiguous arrays instead of one node per key. Nodes are split when full, and merged with the following one
+ * when less than half full.
+*/
+
+unrolledList_t RICK45BLISTS_UnrolledListCreate(RICK45B_comparator_t key_cmp);
+/*
+ * Function used to initialize an unrolled list.
+ * Returns an unrolled list type, or NULL if an error occurred.
+ * Arguments:
+ * key_cmp -> function used to compare elements of the unrolled list.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+unrolledList_t RICK45BLISTS_UnrolledListCreateWithAllocator(RICK45B_comparator_t key_cmp, allocator_t allocator);
+/*
+ * Function used to initialize an unrolled list that allocates itself and all of its nodes through the given allocator.
+ * Returns an unrolled list type, or NULL if an error occurred.
+ * Arguments:
+ * key_cmp -> function used to compare elements of the unrolled list.
+ * allocator -> the allocator to use. It is copied into the list, so it doesn't need to outlive the call.
+ * If NULL, the functions given to 'RICK45B_LibStart()' will be used.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+void RICK45BLISTS_UnrolledListDestroy(unrolledList_t *ulist, int delete_bool);
+/*
+ * Function that, given an unrolled list, it destroys it.
+ * Returns nothing.
+ * Arguments:
+ * ulist -> the unrolled list which you'd like to destroy.
+ * delete_bool -> 0 to free just the nodes, a number different from 0 to free the keys as well.
+ * Use a delete_bool different from 0 only if the list doesn't contains any stack-allocated data!!
+*/
+
+int RICK45BLISTS_HeadAddUnrolledListKey(void *key, unrolledList_t ulist);
+/*
+ * Function that adds a key at the beginning of the unrolled list.
+ * Returns -1 if an error has occurred, 0 otherwise.
+ * Arguments:
+ * key -> the key to add.
+ * ulist -> the unrolled list where to add the key.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+int RICK45BLISTS_TailAddUnrolledListKey(void *key, unrolledList_t ulist);
+/*
+ * Function that adds a key at the end of the unrolled list, in O(1) time.
+ * Returns -1 if an error has occurred, 0 otherwise.
+ * Arguments:
+ * key -> the key to add.
+ * ulist -> the unrolled list where to add the key.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+int RICK45BLISTS_AddUnrolledListKey(void *key, unrolledList_t ulist, size_t position);
+/*
+ * Function that adds a key at the given position of the unrolled list (going from 0 to its size).
+ * Returns -1 if an error has occurred, 0 otherwise.
+ * Arguments:
+ * key -> the key to add.
+ * ulist -> the unrolled list where to add the key.
+ * position -> position of the new key.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+size_t RICK45BLISTS_GetUnrolledListSize(unrolledList_t ulist);
+/*
+ * Function that returns the number of keys of the given unrolled list (0 if it is NULL).
+*/
+
+void *RICK45BLISTS_GetKeyByPositionUnrolled(unrolledList_t ulist, size_t position);
+/*
+ * Function that, given a position and an unrolled list, it returns the key at that position.
+ * Returns a key, or NULL if an error has occurred.
+ * Arguments:
+ * ulist -> the unrolled list where to get the key from.
+ * position -> the position of the key to fetch, going from 0 to size-1.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+void *RICK45BLISTS_SetKeyByPositionUnrolled(unrolledList_t ulist, void *newkey, size_t position);
+/*
+ * Function that replaces the key at the given position of the unrolled list.
+ * Returns the old key, or NULL if an error has occurred.
+ * Arguments:
+ * ulist -> the unrolled list where to set the key.
+ * newkey -> the new key.
+ * position -> the position of the key to replace, going from 0 to size-1.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+void *RICK45BLISTS_GetKeyByKeyUnrolled(unrolledList_t ulist, void *key);
+/*
+ * Function that searches the unrolled list for a key.
+ * Returns the first key of the list equal to the given one (according to key_cmp), or NULL if it can't be
+ * found or an error has occurred.
+ * Arguments:
+ * ulist -> the unrolled list where to search in.
+ * key -> the key to search for.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+int RICK45BLISTS_RemoveKeyUnrolled(unrolledList_t ulist, size_t position, int delete_bool);
+/*
+ * Function that removes the key at the given position of the unrolled list.
+ * Returns -1 if an error has occurred, 0 otherwise.
+ * Arguments:
+ * ulist -> the unrolled list where to remove the key from.
+ * position -> the position of the key to remove, going from 0 to size-1.
+ * delete_bool -> a number different from 0 to free the key as well.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+int RICK45BLISTS_RemoveKeyByKeyUnrolled(unrolledList_t ulist, void *key, int delete_bool);
+/*
+ * Function that removes the first key of the unrolled list equal to the given one.
+ * Returns -1 if an error has occurred, 1 if a key was removed, 0 otherwise.
+ * Arguments:
+ * ulist -> the unrolled list where to remove the key from.
+ * key -> the key to search for.
+ * delete_bool -> a number different from 0 to free the removed key as well.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+void RICK45BLISTS_RemoveAllKeysUnrolled(unrolledList_t ulist, int delete_bool);
+/*
+ * Function that removes every key of the unrolled list, freeing them as well if delete_bool is different from 0.
+ * Returns nothing.
+*/
+
+int RICK45BLISTS_UnrolledListforEach(unrolledList_t ulist, RICK45B_forEach_t funct, void *opt);
+/*
+ * Function that applies funct to every key of the unrolled list, in order, with the 'opt' optional argument.
+ * The walk stops at the first call returning -1.
+ * Returns -1 if an error has occurred, 0 otherwise.
+ * Arguments:
+ * ulist -> the unrolled list to walk.
+ * funct -> the function to apply, that gets a key as its first argument.
+ * opt -> optional argument of the 'funct' function.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+int RICK45BLISTS_UnrolledIteratorInit(unrolledListIterator_t iterator, unrolledList_t ulist);
+/*
+ * Function that sets up a caller-owned iterator at the first key of the unrolled list. Like the list iterators,
+ * any number of them can read the same unrolled list at once, as long as nobody modifies it.
+ * Returns -1 if an error has occurred, 0 otherwise.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+int RICK45BLISTS_UnrolledIteratorHasNext(unrolledListIterator_t iterator);
+/*
+ * Function that returns 1 if the next step of the iterator will return a key, 0 otherwise (or if it is NULL).
+*/
+
+void *RICK45BLISTS_UnrolledIteratorNext(unrolledListIterator_t iterator);
+/*
+ * Function that returns the next key of the iterator and steps over it, or NULL at the end of the unrolled list.
+*/
+
+/*  ***Concurrent sorted lists***   */
+/*
+ * A concurrent list keeps its keys sorted and without duplicates, and can be used by any number of threads at once
+ * without any lock: insertions, removals and lookups are lock-free (Harris-Michael list). A removal marks the node
+ * as deleted before unlinking it, and any operation passing by unlinks the marked nodes it finds. Unlinked nodes are
+ * released only when no running operation holds a hazard pointer to them, so lookups never read freed memory.
+ * The allocator of a concurrent list must be thread-safe, like malloc and free are. Only creation and destruction
+ * must not run together with other operations.
+*/
+
+concurrentList_t RICK45BLISTS_ConcurrentListCreate(RICK45B_comparator_t key_cmp);
+/*
+ * Function used to initialize a concurrent list.
+ * Returns a concurrent list type, or NULL if an error occurred.
+ * Arguments:
+ * key_cmp -> function used to compare elements of the concurrent list. It must be safe to call from many threads.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+concurrentList_t RICK45BLISTS_ConcurrentListCreateWithAllocator(RICK45B_comparator_t key_cmp, allocator_t allocator);
+/*
+ * Function used to initialize a concurrent list that allocates itself, its nodes and its hazard records through the
+ * given allocator.
+ * Returns a concurrent list type, or NULL if an error occurred.
+ * Arguments:
+ * key_cmp -> function used to compare elements of the concurrent list. It must be safe to call from many threads.
+ * allocator -> the allocator to use, whose functions must be thread-safe. It is copied into the concurrent list,
+ * so it doesn't need to outlive the call. If NULL, the functions given to 'RICK45B_LibStart()' will be used.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+void RICK45BLISTS_ConcurrentListDestroy(concurrentList_t *clist, int delete_bool);
+/*
+ * Function that, given a concurrent list, it destroys it, releasing the nodes still waiting to be released as well.
+ * No other thread may be using the concurrent list.
+ * Returns nothing.
+ * Arguments:
+ * clist -> the concurrent list which you'd like to destroy.
+ * delete_bool -> an integer number, used to interrogate the client if he wants to
+ * delete the users data as well with the node. i.e:
+ * 0 -> just delete (free) the node, and not its content.
+ * A number different from 0 -> delete (free), together with the node, the user defined contents
+ * as well.
+*/
+
+int RICK45BLISTS_ConcurrentListInsert(void *key, concurrentList_t clist);
+/*
+ * Function that adds the given key to the concurrent list, in its sorted position, unless an equal key is already
+ * there. Lock-free.
+ * Returns 1 if the key has been added, 0 if an equal key was already in the concurrent list, -1 if an error has
+ * occurred.
+ * Arguments:
+ * key -> the key to add.
+ * clist -> the concurrent list where to add the key.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+int RICK45BLISTS_ConcurrentListRemove(concurrentList_t clist, void *key, int delete_bool);
+/*
+ * Function that removes the key equal to the given one from the concurrent list. Lock-free.
+ * Returns 1 if the key has been removed, 0 if it wasn't in the concurrent list, -1 if an error has occurred.
+ * Arguments:
+ * clist -> the concurrent list where to remove the key from.
+ * key -> the key to remove.
+ * delete_bool -> an integer number different from 0 if the removed key should be freed as well. The key is freed
+ * together with its node, once no other thread can be reading it.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+int RICK45BLISTS_ConcurrentListContains(concurrentList_t clist, void *key);
+/*
+ * Function that checks if a key equal to the given one is in the concurrent list. Lock-free.
+ * Returns 1 if TRUE, 0 if FALSE, -1 if an error has occurred.
+ * Arguments:
+ * clist -> the concurrent list where to search in.
+ * key -> the key to search.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+size_t RICK45BLISTS_GetConcurrentListSize(concurrentList_t clist);
+/*
+ * Function that returns the number of keys in the concurrent list (0 if it is NULL). While other threads are
+ * editing the concurrent list, the result may already be out of date.
+*/
+
+/*  ***Intrusive lists***   */
+/*
+ * An intrusive list links the caller's objects directly, through a 'struct intrusiveLink' field embedded in each of
+ * them: adding and removing objects never allocates, and a scan reads the objects themselves instead of a node
+ * pointing to them. The functions take and return the objects; RICK45BLISTS_CONTAINER_OF recovers an object from a
+ * link. An object can be in as many intrusive lists as the links it embeds, but only once in each of them, and it
+ * must outlive its stay in the list.
+*/
+
+intrusiveList_t RICK45BLISTS_IntrusiveListCreate(RICK45B_comparator_t key_cmp, size_t offset);
+/*
+ * Function used to initialize an intrusive list.
+ * Returns an intrusive list type, or NULL if an error occurred.
+ * Arguments:
+ * key_cmp -> function used to compare the objects of the intrusive list.
+ * offset -> offset of the 'struct intrusiveLink' field used by this list inside the objects, i.e.
+ * offsetof(struct myObject, link).
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+intrusiveList_t RICK45BLISTS_IntrusiveListCreateWithAllocator(RICK45B_comparator_t key_cmp, size_t offset, allocator_t allocator);
+/*
+ * Function used to initialize an intrusive list that allocates itself through the given allocator (the objects are
+ * never allocated by the list).
+ * Returns an intrusive list type, or NULL if an error occurred.
+ * Arguments:
+ * key_cmp -> function used to compare the objects of the intrusive list.
+ * offset -> offset of the 'struct intrusiveLink' field used by this list inside the objects.
+ * allocator -> the allocator to use. It is copied into the intrusive list, so it doesn't need to outlive the call.
+ * If NULL, the functions given to 'RICK45B_LibStart()' will be used.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+void RICK45BLISTS_IntrusiveListDestroy(intrusiveList_t *ilist, int delete_bool);
+/*
+ * Function that, given an intrusive list, it destroys it.
+ * Returns nothing.
+ * Arguments:
+ * ilist -> the intrusive list which you'd like to destroy.
+ * delete_bool -> an integer number, used to interrogate the client if he wants to
+ * delete the objects as well. i.e:
+ * 0 -> the objects are just unlinked.
+ * A number different from 0 -> the objects are deleted (freed) as well.
+*/
+
+int RICK45BLISTS_IntrusiveHeadAdd(void *object, intrusiveList_t ilist);
+/*
+ * Function that links the given object at the head of the intrusive list, in O(1) time and without allocating.
+ * Returns -1 if an error has occurred, 0 otherwise.
+ * Arguments:
+ * object -> the object to add, not in the intrusive list yet.
+ * ilist -> the intrusive list where to add the object.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+int RICK45BLISTS_IntrusiveTailAdd(void *object, intrusiveList_t ilist);
+/*
+ * Function that links the given object at the tail of the intrusive list, in O(1) time and without allocating.
+ * Returns -1 if an error has occurred, 0 otherwise.
+ * Arguments:
+ * object -> the object to add, not in the intrusive list yet.
+ * ilist -> the intrusive list where to add the object.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+int RICK45BLISTS_IntrusiveAddAfter(void *object, intrusiveList_t ilist, void *previous);
+/*
+ * Function that links the given object right after another one of the intrusive list, in O(1) time and without
+ * allocating.
+ * Returns -1 if an error has occurred, 0 otherwise.
+ * Arguments:
+ * object -> the object to add, not in the intrusive list yet.
+ * ilist -> the intrusive list where to add the object.
+ * previous -> an object of the intrusive list. If NULL, the object is added at the head.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+int RICK45BLISTS_IntrusiveRemove(intrusiveList_t ilist, void *object, int delete_bool);
+/*
+ * Function that unlinks the given object from the intrusive list, in O(1) time.
+ * Returns -1 if an error has occurred, 0 otherwise.
+ * Arguments:
+ * ilist -> the intrusive list where to remove the object from.
+ * object -> an object of the intrusive list.
+ * delete_bool -> an integer number different from 0 if the object should be deleted (freed) as well.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+void *RICK45BLISTS_IntrusiveRemoveHead(intrusiveList_t ilist);
+/*
+ * Function that unlinks the object at the head of the intrusive list.
+ * Returns the object, or NULL if the intrusive list is empty or an error has occurred.
+ * Arguments:
+ * ilist -> the intrusive list where to remove the object from.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+void *RICK45BLISTS_IntrusiveRemoveTail(intrusiveList_t ilist);
+/*
+ * Function that unlinks the object at the tail of the intrusive list.
+ * Returns the object, or NULL if the intrusive list is empty or an error has occurred.
+ * Arguments:
+ * ilist -> the intrusive list where to remove the object from.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+void *RICK45BLISTS_IntrusiveGetHead(intrusiveList_t ilist);
+/*
+ * Function that returns the object at the head of the intrusive list, or NULL if it is empty or NULL.
+*/
+
+void *RICK45BLISTS_IntrusiveGetTail(intrusiveList_t ilist);
+/*
+ * Function that returns the object at the tail of the intrusive list, or NULL if it is empty or NULL.
+*/
+
+void *RICK45BLISTS_IntrusiveGetNext(intrusiveList_t ilist, void *object);
+/*
+ * Function that returns the object following the given one in the intrusive list, or NULL if it is the tail (or an
+ * argument is NULL).
+*/
+
+void *RICK45BLISTS_IntrusiveGetPrevious(intrusiveList_t ilist, void *object);
+/*
+ * Function that returns the object preceding the given one in the intrusive list, or NULL if it is the head (or an
+ * argument is NULL).
+*/
+
+void *RICK45BLISTS_IntrusiveGetObjectByKey(intrusiveList_t ilist, void *key);
+/*
+ * Function used to get an object by key.
+ * Returns the first object of the intrusive list equal to the given key for the list's comparator, or NULL if none
+ * is found or an error has occurred.
+ * Arguments:
+ * ilist -> the intrusive list where to search in.
+ * key -> the key used for searching for the object, passed to the comparator as its second argument.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+int RICK45BLISTS_IntrusiveListforEach(intrusiveList_t ilist, RICK45B_forEach_t funct, void *opt);
+/*
+ * Function that calls funct on every object of the intrusive list, from the head to the tail. funct must not
+ * unlink the objects.
+ * Returns -1 if an error has occurred, 0 otherwise.
+ * Arguments:
+ * ilist -> the intrusive list to walk.
+ * funct -> function called with every object.
+ * opt -> optional argument passed to funct, for whatever user-defined purpose.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+size_t RICK45BLISTS_GetIntrusiveListSize(intrusiveList_t ilist);
+/*
+ * Function that returns the number of objects in the intrusive list (0 if it is NULL).
+*/
+
+/*  ***XOR linked lists***   */
+/*
+ * A XOR linked list is a double linked list whose nodes keep a single link, the XOR of the addresses of their
+ * previous and next nodes: a node takes two words instead of the three of a 'struct doubleListNode', so a third
+ * less memory. Given two adjacent nodes the list can be walked in both directions, so it can be iterated from
+ * either end and both ends can be edited in O(1) time; a node alone, though, doesn't tell where its neighbours
+ * are, so the list is walked with iterators and edited by key, never by node handle.
+ * With one allocation per node the allocator's own overhead usually hides the saving: for long lists consider
+ * RICK45BLISTS_XorListUseNodePool.
+*/
+
+xorList_t RICK45BLISTS_XorListCreate(RICK45B_comparator_t key_cmp);
+/*
+ * Function used to initialize a XOR linked list.
+ * Returns a xor list type, or NULL if an error occurred.
+ * Arguments:
+ * key_cmp -> the function used to compare the keys of the list.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+xorList_t RICK45BLISTS_XorListCreateWithAllocator(RICK45B_comparator_t key_cmp, allocator_t allocator);
+/*
+ * Function used to initialize a XOR linked list which uses the given allocator for itself and its nodes.
+ * Returns a xor list type, or NULL if an error occurred.
+ * Arguments:
+ * key_cmp -> the function used to compare the keys of the list.
+ * allocator -> the allocator to use. If NULL, the functions given to 'RICK45B_LibStart()' will be used.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+void RICK45BLISTS_XorListDestroy(xorList_t *xlist, int delete_bool);
+/*
+ * Function that destroys the given xor list and its nodes, and sets it to NULL.
+ * Returns nothing.
+ * Arguments:
+ * xlist -> the xor list which you'd like to destroy.
+ * delete_bool -> an integer number, used to interrogate the client if he wants to
+ * delete the users data as well with the node. i.e:
+ * 0 -> just delete (free) the node, and not its content.
+ * A number different from 0 -> delete (free), together with the node, the user defined contents
+ * as well.
+*/
+
+int RICK45BLISTS_XorListUseNodePool(xorList_t xlist, size_t nodesPerChunk);
+/*
+ * Function that makes the given xor list take its nodes from a private node pool, allocated through the list's
+ * allocator 'nodesPerChunk' nodes at a time (see RICK45BLISTS_ListUseNodePool). Can only be called on an empty list.
+ * Returns -1 if an error has occurred, 0 otherwise.
+ * Arguments:
+ * xlist -> the xor list which should use the pool.
+ * nodesPerChunk -> number of nodes allocated at once. If 0, RICK45B_POOL_DEFAULT_CHUNK will be used.
  *
  * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
 */
 
-doubleListNode_t RICK45BLISTS_GetNodeByKeyDouble(doubleList_t dlinkedList, void* key);
+int RICK45BLISTS_XorHeadAdd(void *key, xorList_t xlist);
 /*
- * Function used to get a Node by key.
- * Returns a the first doubleListNode_t with that key, or NULL if an error has occurred.
- * Arguments:
- * key -> the key used for searching for the node.
- * dlinkedList -> the double linked list where to search in.
+ * Function that adds a new node, holding the given key, at the head of the xor list in O(1) time.
+ * Returns -1 if an error has occurred, 0 otherwise.
  *
  * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
 */
 
-void *RICK45BLISTS_GetKeyByNodeDouble(doubleListNode_t node);
+int RICK45BLISTS_XorTailAdd(void *key, xorList_t xlist);
 /*
- * Function that, given a Node, it returns its key. It is pretty useless, but
- * might be useful to obtain a more verbose programming.
- * Returns a key, or NULL if an error has occurred.
- * Arguments:
- * node -> the node where to get the key from.
+ * Function that adds a new node, holding the given key, at the tail of the xor list in O(1) time.
+ * Returns -1 if an error has occurred, 0 otherwise.
  *
  * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
 */
 
-void *RICK45BLISTS_GetKeyByPositionDouble(doubleList_t dlinkedList, size_t position);
+int RICK45BLISTS_XorRemoveHead(xorList_t xlist, int delete_bool);
 /*
- * Function that, given a position and a double linkedList, it returns the key at that position.
- * Returns a key, or NULL if an error has occurred.
+ * Function that deletes, in O(1) time, the node at the head of the xor list.
+ * Returns -1 if an error has occurred (i.e. the list is empty), 0 otherwise.
  * Arguments:
- * dlinkedList -> the double linkedList where to get the key from.
- * position -> the position of the key in the double linkedList to fetch.
+ * xlist -> the xor list to which delete the head.
+ * delete_bool -> if different from 0, the key of the node is deleted (freed) as well.
  *
  * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
 */
 
-void *RICK45BLISTS_SetKeyByPositionDouble(doubleList_t dlinkedList, void* newkey, size_t position);
+int RICK45BLISTS_XorRemoveTail(xorList_t xlist, int delete_bool);
 /*
- * Function that, given a position, a double linkedList and a key, it sets the key of the node at that
- * position to newkey.
- * Return the previously stored key on that node, or NULL if an error has occurred.
+ * Function that deletes, in O(1) time, the node at the tail of the xor list.
+ * Returns -1 if an error has occurred (i.e. the list is empty), 0 otherwise.
  * Arguments:
- * dlinkedList -> the double linkedList where to set the key.
- * position -> the position of the node in the double linkedList at which to set the new key.
- * newkey -> the new key of the node at the specified position, that will replace the old one.
+ * xlist -> the xor list to which delete the tail.
+ * delete_bool -> if different from 0, the key of the node is deleted (freed) as well.
  *
  * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
 */
 
-void *RICK45BLISTS_SetKeyByNodeDouble(doubleList_t dlinkedList, void* newkey, doubleListNode_t node);
+int RICK45BLISTS_XorRemoveByKey(xorList_t xlist, void *key, int delete_bool);
 /*
- * Function that given a node, a double linkedList, and a key, sets the key of the given node to newkey.
- * Return the previously stored key on that node, or NULL if an error has occurred.
+ * Function that deletes the first node of the xor list whose key is equal to the given one.
+ * Returns -1 if an error has occurred, 1 if a node was deleted, 0 otherwise (no key can be found).
  * Arguments:
- * dlinkedList -> the double linkedList where to set the key.
- * newkey -> the new key of the node at the specified position, that will replace the old one.
- * node -> the node to which set the new key.
+ * xlist -> the xor list to which delete the node.
+ * key -> the key to look for.
+ * delete_bool -> if different from 0, the key of the node is deleted (freed) as well.
  *
  * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
 */
 
-int RICK45BLISTS_SetKeyByKeyDouble(doubleList_t dlinkedList, void* newkey, void* oldkey);
+void *RICK45BLISTS_XorGetHeadKey(xorList_t xlist);
 /*
- * Function that, given a new key, a double linkedList and a old key, sets all the keys of the given double linkedList
- * that equals to oldkey, to newkey.
- * Returns the number of replaced keys, -1 if an error has occurred.
- * Arguments:
- * dlinkedList -> the list where to set the key.
- * newkey -> the new key of the node, that will replace the old one.
- * oldkey -> the key that identifies all the nodes which their keys must be updated.
+ * Function that returns the key at the head of the xor list, or NULL if the list is empty or NULL.
+*/
+
+void *RICK45BLISTS_XorGetTailKey(xorList_t xlist);
+/*
+ * Function that returns the key at the tail of the xor list, or NULL if the list is empty or NULL.
+*/
+
+void *RICK45BLISTS_XorGetKeyByKey(xorList_t xlist, void *key);
+/*
+ * Function that returns the key held by the first node of the xor list which is equal to the given one.
+ * Returns the key found, or NULL if an error has occurred (i.e. no key can be found).
  *
  * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
 */
 
-int RICK45BLISTS_RemoveNodeDouble(doubleList_t dlinkedList, size_t position, int delete_bool);
+int RICK45BLISTS_XorListReverse(xorList_t xlist);
 /*
- * Function that, given a double linkedList and a position, it deletes the node at that position.
- * PLEASE, REMEMBER THAT THE LIST IS INDEXED LIKE AN ARRAY, STARTING FROM ZERO!
+ * Function that reverses the order of the xor list in O(1) time: since every link is the same in both
+ * directions, only the head and the tail are swapped.
  * Returns -1 if an error has occurred, 0 otherwise.
- * Arguments:
- * dlinkedList -> the double linkedList to which delete the node.
- * position -> the index of the node to delete.
- * delete_bool -> an integer number, used to interrogate the client if he wants to
- * delete the users data as well with the node. i.e:
- *
- * 0 -> just delete (free) the node, and not its content.
- * A number different from 0 -> delete (free), together with the node, the user defined contents
- * as well.
  *
  * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
 */
 
-int RICK45BLISTS_RemoveTailDouble(doubleList_t dlinkedList, int delete_bool);
+int RICK45BLISTS_XorListforEach(xorList_t xlist, RICK45B_forEach_t funct, void *opt);
 /*
- * Function that, given a double linkedList, it deletes (if presents) the node at it's tail.
+ * Function that calls 'funct' on every key of the xor list, from the head to the tail, stopping at the first
+ * call that returns -1.
  * Returns -1 if an error has occurred, 0 otherwise.
- * Arguments:
- * dlinkedList -> the double linkedList to which delete the tail.
- * delete_bool -> an integer number, used to interrogate the client if he wants to
- * delete the users data as well with the node. i.e:
- *
- * 0 -> just delete (free) the node, and not its content.
- * A number different from 0 -> delete (free), together with the node, the user defined contents
- * as well.
  *
  * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
 */
 
-int RICK45BLISTS_RemoveNodeByKeyDouble(doubleList_t dlinkedList, void *key, int delete_bool);
+int RICK45BLISTS_XorIteratorInit(xorListIterator_t iterator, xorList_t xlist);
 /*
- * Function that, given a double linkedList and a key value, it deletes (if presents) the first node it encounters with that key.
- * Returns 0 if nothing has been deleted, 1 if something has been deleted and -1 if an error has occurred.
+ * Function that sets up the given iterator at the head of the given xor list, so that it walks it forwards.
+ * Returns -1 if an error has occurred, 0 otherwise.
  * Arguments:
- * dlinkedList -> the double linkedList to which delete the node.
- * key -> they key of the node to remove.
- * delete_bool -> an integer number, used to interrogate the client if he wants to
- * delete the users data as well with the node. i.e:
- *
- * 0 -> just delete (free) the node, and not its content.
- * A number different from 0 -> delete (free), together with the node, the user defined contents
- * as well.
+ * iterator -> the iterator to set up, usually a 'struct xorListIterator' allocated on the stack.
+ * xlist -> the xor list to walk.
  *
  * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
 */
 
-int RICK45BLISTS_RemoveAllNodesByKeyDouble(doubleList_t dlinkedList, void *key, int delete_bool);
+int RICK45BLISTS_XorIteratorInitTail(xorListIterator_t iterator, xorList_t xlist);
 /*
- * Function that, given a double linkedList and a key value, it deletes (if present) all the nodes it encounters with that key.
- * Returns the number of nodes that have been deleted, or -1 if an error has occurred.
- * Arguments:
- * dlinkedList -> the double linkedList to which delete the nodes.
- * key -> they key of the nodes to remove.
- * delete_bool -> an integer number, used to interrogate the client if he wants to
- * delete the users data as well with the node. i.e:
- *
- * 0 -> just delete (free) the node, and not its content.
- * A number different from 0 -> delete (free), together with the node, the user defined contents
- * as well.
+ * Function that sets up the given iterator at the tail of the given xor list, so that it walks it backwards.
+ * Returns -1 if an error has occurred, 0 otherwise.
  *
  * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
 */
 
-void RICK45BLISTS_DoubleListRemoveAllNodes(doubleList_t dlinkedList, int delete_bool);
+void *RICK45BLISTS_XorIteratorNext(xorListIterator_t iterator);
 /*
- * Function that, given a double linked list, it deletes (if presents) all its nodes.
- * Returns nothing.
- * Arguments:
- * dlinkedList -> the double linked list to which delete all the nodes.
- * delete_bool -> an integer number, used to interrogate the client if he wants to
- * delete the users data as well with the nodes. i.e:
+ * Function that returns the key of the node the given iterator is on, and moves the iterator one node further in
+ * its direction. Returns NULL at the end of the walk. i.e:
  *
- * 0 -> just delete (free) the node, and not its content.
- * A number different from 0 -> delete (free), together with the node, the user defined contents
- * as well.
- * Use a delete_bool different from 0 only if the double linked list doesn't contains any stack-allocated data!!
+ * struct xorListIterator it;
+ * void *key;
+ * RICK45BLISTS_XorIteratorInitTail(&it, xlist);
+ * while ((key = RICK45BLISTS_XorIteratorNext(&it)) != NULL) ...
+ *
+ * Iterators must not be used across changes made to the list.
 */
 
-int RICK45BLISTS_DoubleListRemoveHead(doubleList_t dlinkedList, int delete_bool);
+int RICK45BLISTS_XorIteratorReverse(xorListIterator_t iterator);
 /*
- * Function that, given a double linked list, it deletes (if presents) the node at the head.
+ * Function that turns the given iterator around in O(1) time: its next step returns again the last key returned,
+ * and the following ones walk the list the opposite way. If nothing has been returned yet, the walk is over.
  * Returns -1 if an error has occurred, 0 otherwise.
- * Arguments:
- * dlinkedList -> the double linked list to which delete the head.
- * delete_bool -> an integer number, used to interrogate the client if he wants to
- * delete the users data as well with the node. i.e:
- *
- * 0 -> just delete (free) the node, and not its content.
- * A number different from 0 -> delete (free), together with the node, the user defined contents
- * as well.
  *
  * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
 */
 
+size_t RICK45BLISTS_GetXorListSize(xorList_t xlist);
+/*
+ * Function that returns the number of nodes in the xor list (0 if it is NULL).
+*/
+
 /***stack / queue***/
 
 stack_t RICK45BSTACK_StackCreate(RICK45B_comparator_t key_cmp, unsigned long int dim);
@@ -747,6 +2422,20 @@ stack_t RICK45BSTACK_StackCreate(RICK45B_comparator_t key_cmp, unsigned long int
  * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
 */
 
+stack_t RICK45BSTACK_StackCreateWithAllocator(RICK45B_comparator_t key_cmp, unsigned long int dim, allocator_t allocator);
+/*
+ * Function that works like 'RICK45BSTACK_StackCreate()', but allocates the stack and all of its nodes through
+ * the given allocator.
+ * Returns NULL if an error has occurred, a stack_t variable otherwise.
+ * Arguments:
+ * key_cmp -> used to compare the stack's keys.
+ * dim -> specify the max number of elements that can be contained inside the stack (0 = no max dimension).
+ * allocator -> the allocator to use. It is copied into the stack. If NULL, the functions given to 'RICK45B_LibStart()'
+ * will be used.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
 void RICK45BSTACK_StackDestroy(stack_t stack, int delete_bool);
 /*
  * Function that, given a stack, it destroys it.
@@ -763,6 +2452,49 @@ void RICK45BSTACK_StackDestroy(stack_t stack, int delete_bool);
  * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
 */
 
+int RICK45BSTACK_StackUseNodePool(stack_t stack, size_t nodesPerChunk);
+/*
+ * Function that makes the given stack take its nodes from a private node pool, allocated through the stack's
+ * allocator 'nodesPerChunk' nodes at a time. Released nodes are kept in the pool for reuse, and the whole pool is
+ * released at once when the stack is destroyed. Can only be called on an empty stack.
+ * Returns -1 if an error has occurred, 0 otherwise.
+ * Arguments:
+ * stack -> the stack which should use the pool.
+ * nodesPerChunk -> number of nodes allocated at once. If 0, RICK45B_POOL_DEFAULT_CHUNK will be used.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+int RICK45BSTACK_StackUseHashIndex(stack_t stack, RICK45B_hash_t hash);
+/*
+ * Function that makes the given stack keep a hash index of its keys (see RICK45BLISTS_ListUseHashIndex), so that
+ * RICK45BSTACK_ContainedInStack takes O(1) expected time instead of O(n).
+ * Returns -1 if an error has occurred, 0 otherwise.
+ * Arguments:
+ * stack -> the stack which should keep the index. It can already hold some keys.
+ * hash -> function used to hash the keys of the stack.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+int RICK45BSTACK_StackUseArray(stack_t stack, size_t capacity);
+/*
+ * Function that makes the given stack keep its keys in a contiguous array, allocated through the stack's allocator,
+ * instead of a list: pushes and pops then touch a single slot and don't allocate, unless the array is full and has
+ * to grow. A full array is moved to one twice as big (never bigger than the max dimension of the stack, if any) and
+ * it never shrinks, so once a stack has reached its working size it doesn't allocate anymore. A stack with a max
+ * dimension smaller than 'capacity' only allocates room for 'dim' keys.
+ * An array-backed stack can't use a node pool or a hash index: RICK45BSTACK_ContainedInStack scans the array.
+ * Can only be called on an empty stack.
+ * Returns -1 if an error has occurred, 0 otherwise.
+ * Arguments:
+ * stack -> the stack which should use the array.
+ * capacity -> number of keys the array can hold before its first growth. If 0, RICK45BSTACK_ARRAY_DEFAULT_CAPACITY
+ * will be used.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
 void *RICK45BSTACK_StackTop(stack_t stack);
 /*
  * Function that, provided a stack variable, returns the key at the top of it, but WITHOUT removing it from the stack.
@@ -822,6 +2554,20 @@ size_t RICK45BSTACK_GetStackSize(stack_t stack);
  * stack -> the stack from where to get the size from.
 */
 
+void **RICK45BSTACK_StackToArray(stack_t stack, void **array, int reverse);
+/*
+ * Function that writes the keys of the stack into a contiguous array, from the top to the bottom (or from the
+ * bottom to the top if 'reverse' is TRUE), without popping them.
+ * Returns the array, or NULL if an error has occurred.
+ * Arguments:
+ * stack -> the stack whose keys are copied.
+ * array -> array of at least RICK45BSTACK_GetStackSize(stack) entries. If NULL, a new one is allocated like
+ * RICK45BLISTS_ListToArray does.
+ * reverse -> TRUE to copy the keys in reverse order, FALSE otherwise.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
 int RICK45BSTACK_IsTop(stack_t stack, void *key);
 /*
  * Function that checks if a generic key is on top of the given stack.
@@ -858,6 +2604,20 @@ queue_t RICK45BQUEUE_QueueCreate(RICK45B_comparator_t key_cmp, unsigned long int
  * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
 */
 
+queue_t RICK45BQUEUE_QueueCreateWithAllocator(RICK45B_comparator_t key_cmp, unsigned long int dim, allocator_t allocator);
+/*
+ * Function that works like 'RICK45BQUEUE_QueueCreate()', but allocates the queue and all of its nodes through
+ * the given allocator.
+ * Returns NULL if an error has occurred, a queue_t variable otherwise.
+ * Arguments:
+ * key_cmp -> used to compare the queue's keys.
+ * dim -> specify the max number of elements that can be contained inside the queue (0 = no max dimension).
+ * allocator -> the allocator to use. It is copied into the queue. If NULL, the functions given to 'RICK45B_LibStart()'
+ * will be used.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
 void RICK45BQUEUE_QueueDestroy(queue_t queue, int delete_bool);
 /*
  * Function that, given a queue, it destroys it.
@@ -874,6 +2634,31 @@ void RICK45BQUEUE_QueueDestroy(queue_t queue, int delete_bool);
  * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
 */
 
+int RICK45BQUEUE_QueueUseNodePool(queue_t queue, size_t nodesPerChunk);
+/*
+ * Function that makes the given queue take its nodes from a private node pool, allocated through the queue's
+ * allocator 'nodesPerChunk' nodes at a time. Released nodes are kept in the pool for reuse, and the whole pool is
+ * released at once when the queue is destroyed. Can only be called on an empty queue.
+ * Returns -1 if an error has occurred, 0 otherwise.
+ * Arguments:
+ * queue -> the queue which should use the pool.
+ * nodesPerChunk -> number of nodes allocated at once. If 0, RICK45B_POOL_DEFAULT_CHUNK will be used.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+int RICK45BQUEUE_QueueUseHashIndex(queue_t queue, RICK45B_hash_t hash);
+/*
+ * Function that makes the given queue keep a hash index of its keys (see RICK45BLISTS_ListUseHashIndex), so that
+ * RICK45BQUEUE_ContainedInQueue takes O(1) expected time instead of O(n).
+ * Returns -1 if an error has occurred, 0 otherwise.
+ * Arguments:
+ * queue -> the queue which should keep the index. It can already hold some keys.
+ * hash -> function used to hash the keys of the queue.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
 int RICK45BQUEUE_Enqueue(queue_t queue, void *key);
 /*
  * Function that, given a key, enques it into the given queue, if space is avaiable.
@@ -923,6 +2708,20 @@ size_t RICK45BQUEUE_GetQueueSize(queue_t queue);
  * queue -> the queue from where to get the size from.
 */
 
+void **RICK45BQUEUE_QueueToArray(queue_t queue, void **array, int reverse);
+/*
+ * Function that writes the keys of the queue into a contiguous array, from the front to the rear (the order in
+ * which they would be dequeued), or from the rear to the front if 'reverse' is TRUE, without dequeuing them.
+ * Returns the array, or NULL if an error has occurred.
+ * Arguments:
+ * queue -> the queue whose keys are copied.
+ * array -> array of at least RICK45BQUEUE_GetQueueSize(queue) entries. If NULL, a new one is allocated like
+ * RICK45BLISTS_ListToArray does.
+ * reverse -> TRUE to copy the keys in reverse order, FALSE otherwise.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
 int RICK45BQUEUE_ContainedInQueue(queue_t queue, void *key);
 /*
  * Function that checks if a generic key is contained in the given queue.
@@ -968,6 +2767,19 @@ Btree_t RICK45BTREES_BtreeCreate(RICK45B_comparator_t key_cmp);
  * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
 */
 
+Btree_t RICK45BTREES_BtreeCreateWithAllocator(RICK45B_comparator_t key_cmp, allocator_t allocator);
+/*
+ * Function that works like 'RICK45BTREES_BtreeCreate()', but allocates the tree and all of its nodes through
+ * the given allocator.
+ * Returns NULL if an error has occurred, a valid Btree_t pointer otherwise.
+ * Arguments:
+ * key_cmp -> used to compare the tree's keys.
+ * allocator -> the allocator to use. It is copied into the tree. If NULL, the functions given to 'RICK45B_LibStart()'
+ * will be used.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
 int RICK45BTREES_BtreeDestroy(Btree_t Btree, int delete_value, int delete_key);
 /*
  * Function that, given a binary search tree, it destroys it.
@@ -984,6 +2796,19 @@ int RICK45BTREES_BtreeDestroy(Btree_t Btree, int delete_value, int delete_key);
  * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
 */
 
+int RICK45BTREES_BtreeUseNodePool(Btree_t Btree, size_t nodesPerChunk);
+/*
+ * Function that makes the given binary search tree take its nodes from a private node pool, allocated through the tree's
+ * allocator 'nodesPerChunk' nodes at a time. Released nodes are kept in the pool for reuse, and the whole pool is
+ * released at once when the tree is destroyed. Can only be called on an empty tree.
+ * Returns -1 if an error has occurred, 0 otherwise.
+ * Arguments:
+ * Btree -> the binary search tree which should use the pool.
+ * nodesPerChunk -> number of nodes allocated at once. If 0, RICK45B_POOL_DEFAULT_CHUNK will be used.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
 int RICK45BTREES_BtreeAddNode(Btree_t Btree, void *key, void *value);
 /*
  * Function that, given a binary search tree, it adds a new node to it.
@@ -1100,9 +2925,130 @@ int RICK45BTREES_BtreeNodesNum(Btree_t Btree);
 
 /***private functions***/
 
-treeNode_t RICK45BTREES_NodeCreate(void *key, void *value, unsigned int treeType);
+void RICK45BLISTS_LinkAfter(list_t linkedList, listNode_t prev, listNode_t node);
+/*
+ * Private function that links the given node right after 'prev' (at the head if 'prev' is NULL), keeping the
+ * list's head, tail, node before the tail and size up to date. The index of an indexed list is marked as not valid.
+*/
+
+void RICK45BLISTS_UnlinkAfter(list_t linkedList, listNode_t prev, int delete_bool);
+/*
+ * Private function that unlinks and frees the node following 'prev' (the head if 'prev' is NULL), keeping the
+ * list's fields (pointedNode included) up to date. The node must exist. The index of an indexed list is marked as
+ * not valid.
+*/
+
+int RICK45BLISTS_RemoveIfImpl(list_t linkedList, RICK45B_predicate_t pred, void *opt, int delete_bool);
+/*
+ * Private function with the single pass of RICK45BLISTS_RemoveIf, without argument checks.
+*/
+
+int RICK45BLISTS_RemoveIfDoubleImpl(doubleList_t dlinkedList, RICK45B_predicate_t pred, void *opt, int delete_bool);
+/*
+ * Private function with the single pass of RICK45BLISTS_RemoveIfDouble, without argument checks.
+*/
+
+listNode_t RICK45BLISTS_MergeSortNodes(listNode_t head, size_t size, RICK45B_comparator_t key_cmp, listNode_t *tail);
+/*
+ * Private function that sorts a NULL terminated chain of 'size' nodes, linked through their 'next' field, with a
+ * stable bottom-up merge sort. Returns the new first node and sets 'tail' to the new last one.
+*/
+
+doubleListNode_t RICK45BLISTS_MergeSortNodesDouble(doubleListNode_t head, size_t size, RICK45B_comparator_t key_cmp, doubleListNode_t *tail);
+/*
+ * Private function like RICK45BLISTS_MergeSortNodes, for double linked nodes: the 'previous' links are rebuilt
+ * once the chain is sorted.
+*/
+
+void RICK45BLISTS_SkipIndexClear(list_t linkedList);
+/*
+ * Private function that frees every tower of the list's index, leaving it empty and not valid.
+*/
+
+void RICK45BLISTS_SkipIndexRebuild(list_t linkedList);
+/*
+ * Private function that rebuilds the list's index from scratch, in O(n) time.
+*/
+
+listNode_t RICK45BLISTS_SkipIndexSeek(list_t linkedList, size_t rank, struct skipTower **update, size_t *ranks);
+/*
+ * Private function that returns the node at the given rank (position+1) of an indexed list, or NULL for rank 0.
+ * For every level in use, 'update' and 'ranks' get the last tower with rank not greater than 'rank' and its rank.
+ * The index must be valid.
+*/
+
+int RICK45BLISTS_SkipIndexInsert(list_t linkedList, void *key, size_t position);
+/*
+ * Private function that adds a new node with the given key at the given position (not validated) of an indexed
+ * list, updating the index. Returns -1 if an error has occurred, 0 otherwise.
+*/
+
+void RICK45BLISTS_SkipIndexRemove(list_t linkedList, size_t position, int delete_bool);
 /*
- * Function used to create a new node, with the specs given by the treeType parameter.
+ * Private function that removes the node at the given position (not validated) of an indexed list, updating the
+ * index.
+*/
+
+int RICK45BLISTS_HashIndexRebuild(list_t linkedList);
+/*
+ * Private function that rebuilds the list's hash index from scratch, in O(n) time, resizing its table to the
+ * list's size. Returns -1 if the table couldn't be allocated (the index is left not valid), 0 otherwise.
+*/
+
+void RICK45BLISTS_HashIndexInsert(list_t linkedList, listNode_t node);
+/*
+ * Private function that adds the given node to the list's hash index, if valid. If the table can't grow, the index
+ * is marked as not valid.
+*/
+
+void RICK45BLISTS_HashIndexRemove(list_t linkedList, listNode_t node);
+/*
+ * Private function that removes the given node, whose key must not have changed since its insertion, from the
+ * list's hash index, if valid.
+*/
+
+int RICK45BLISTS_HashIndexFind(list_t linkedList, void *key, listNode_t *node);
+/*
+ * Private function that looks the given key up in the list's hash index, rebuilding it if not valid.
+ * Returns -1 if the index can't be used, otherwise the number of nodes holding the key, up to 2: if it is 1, the
+ * node is stored in 'node'.
+*/
+
+void RICK45BLISTS_HashIndexInvalidate(list_t linkedList);
+/*
+ * Private function that marks the list's hash index, if any, as not valid.
+*/
+
+unrolledListNode_t RICK45BLISTS_UnrolledSeek(unrolledList_t ulist, size_t *position, unrolledListNode_t *prev);
+/*
+ * Private function that returns the node holding the key at the given position of the unrolled list, turning
+ * 'position' into the index inside that node and setting 'prev' to the node before it (NULL for the head).
+ * A position equal to the size gives the tail, with an index equal to its count.
+*/
+
+void RICK45BLISTS_UnrolledRemoveAt(unrolledList_t ulist, unrolledListNode_t node, unrolledListNode_t prev, size_t index, int delete_bool);
+/*
+ * Private function that removes the key at the given index of the node (whose previous node is 'prev'), merging
+ * the node with the following one, or releasing it, when it falls under half of its capacity.
+*/
+
+void RICK45BLISTS_LinkBetweenDouble(doubleList_t dlinkedList, doubleListNode_t prev, doubleListNode_t node, doubleListNode_t next);
+/*
+ * Private function that links the given node between the adjacent nodes 'prev' and 'next' (NULL at the ends of
+ * the double linked list), keeping the double linked list's head, tail and size up to date.
+*/
+
+void RICK45BLISTS_UnlinkNodeDouble(doubleList_t dlinkedList, doubleListNode_t node, int delete_bool);
+/*
+ * Private function that unlinks and frees the given node, keeping the double linked list's fields
+ * (pointedNode included) up to date.
+*/
+
+treeNode_t RICK45BTREES_NodeCreate(void *key, void *value, unsigned int treeType, allocator_t allocator);
+/*
+ * Function used to create a new node, with the specs given by the treeType parameter, through the given allocator
+ * (the functions given to 'RICK45B_LibStart()' if NULL). The childs are stored inside the node itself, so a node
+ * takes a single allocation. treeType cannot be bigger than 2: only binary trees are implemented.
  * Returns NULL if an error has occurred, a treeNode_t type value otherwise.
  *
  * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
@@ -1117,18 +3063,10 @@ int RICK45BTREES_BtreeforEachImpl(treeNode_t node, RICK45B_forEach_t funct, void
  * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
 */
 
-int RICK45BTREES_BtreeforEachDeleteNode(void *nodeIn, void *optIn);
+void RICK45BTREES_BtreeDestroyImpl(Btree_t Btree, treeNode_t node, int delete_value, int delete_key);
 /*
- * Private function used in the 'RICK45BTREES_BtreeforEachImpl' private function. It deletes every node passed as an argument.
- * The 'optIn' argument decides if the value and key of the node must be free'd as well. OptIn must be an array of integers.
- * i.e:
- * 0 | x -> free the value, but not the key.
- * x | 0 -> free the key, but not the value.
- * x | x -> free both.
- * 0 | 0 -> free neither.
- *
- * Returns -1 if an error has occurred, 0 otherwise. It's an implementation of the 'RICK45B_forEach_t' function's variable.
- * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+ * Private recursive function that implements the 'RICK45BTREES_BtreeDestroy' function. It deletes (post-order) every
+ * node of the subtree rooted in 'node' through the tree's allocator, and its value / key if requested.
 */
 
 treeNode_t RICK45BTREES_BtreeSearchNodeImpl(Btree_t Btree, treeNode_t root, void *key, int *state);
@@ -1178,7 +3116,7 @@ static __inline__ int RICK45B_LibStart(malloc_t malloc_funct, free_t free_funct)
 
     if(malloc_funct==NULL || free_funct==NULL)
     {
-        RICK45B_CopyString("Failed to initialize library: malloc_funct and free_funct functions CANNOT be NULL!", RICK45B.GetError, sizeof("Failed to initialize library: malloc_funct and free_funct functions CANNOT be NULL!"));
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Failed to initialize library: malloc_funct and free_funct functions CANNOT be NULL!");
         return -1;
     }
     mallocFun = malloc_funct;
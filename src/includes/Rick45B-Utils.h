@@ -27,12 +27,43 @@
 /*defines*/
 #define FALSE 0
 #define TRUE 1
+#define RICK45B_POOL_DEFAULT_CHUNK 256  /*default number of nodes per chunk of a node pool.*/
 
 #include <stddef.h>
 
+/*storage class of the error slot: every thread gets its own copy.*/
+#if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L && !defined(__STDC_NO_THREADS__)
+#define RICK45B_THREAD_LOCAL _Thread_local
+#else
+#define RICK45B_THREAD_LOCAL __thread
+#endif
+
+/*asks the CPU to start loading the given address, if the compiler can do that. It never faults.*/
+#if defined(__GNUC__)
+#define RICK45B_PREFETCH(address) __builtin_prefetch(address)
+#else
+#define RICK45B_PREFETCH(address) ((void)(address))
+#endif
+
+/*enums*/
+typedef enum{
+    RICK45B_NO_ERROR = 0,           /*no error has been set (or it has been cleared).*/
+    RICK45B_ERR_NULL_ADT,           /*the ADT passed as argument is NULL (not initialized).*/
+    RICK45B_ERR_INVALID_ARGUMENT,   /*an argument is NULL or not valid.*/
+    RICK45B_ERR_OUT_OF_RANGE,       /*a position is out of range for the given ADT.*/
+    RICK45B_ERR_EMPTY,              /*the ADT contains no elements.*/
+    RICK45B_ERR_FULL,               /*the ADT has reached its max dimension.*/
+    RICK45B_ERR_NOT_FOUND,          /*the given key couldn't be found.*/
+    RICK45B_ERR_NO_MEMORY,          /*memory allocation failed.*/
+    RICK45B_ERR_CORRUPTED,          /*the ADT's internal state is not consistent.*/
+    RICK45B_ERR_CALLBACK,           /*a user provided function returned an error.*/
+    RICK45B_ERR_INTERNAL            /*an internal operation of the library failed.*/
+}RICK45B_errorCode_t;
+
 /*structs*/
 typedef struct error{
-    char GetError[100];
+    RICK45B_errorCode_t code;
+    char *msg;      /*points to a static message: it is never copied.*/
 }error_rick45b;     /*needed for the client to get error info.*/
 
 typedef void (*free_t)(void*);
@@ -41,30 +72,169 @@ typedef void (*free_t)(void*);
 typedef void* (*malloc_t)(size_t);
 /*This is a private function's variable, and should not be used*/
 
+typedef void* (*RICK45B_alloc_t)(size_t size, void *ctx);
+/*Allocation function of an allocator. Must return NULL if no memory could be allocated. 'ctx' is the allocator's context.*/
+
+typedef void (*RICK45B_dealloc_t)(void *ptr, void *ctx);
+/*Deallocation function of an allocator. 'ctx' is the allocator's context.*/
+
+struct allocator{
+    RICK45B_alloc_t alloc_funct;
+    RICK45B_dealloc_t free_funct;
+    void *ctx;      /*user defined context (i.e. an arena), passed to both functions.*/
+};
+typedef struct allocator* allocator_t;
+/*
+ * An allocator can be given to the ADTs at creation time: the ADT copies it and uses it for all of its
+ * allocations (the ADT itself and its nodes). User data (keys / values) deleted by the ADTs is still released
+ * with the free function given to 'RICK45B_LibStart()'.
+*/
+
+struct nodePool{
+    size_t nodeSize;        /*size of every node, rounded up to a multiple of a pointer's size.*/
+    size_t nodesPerChunk;
+    void *freeNodes;        /*list of the released nodes, linked through their first word.*/
+    void *freeTail;         /*last node of 'freeNodes', so that merging pools doesn't walk the list.*/
+    char *chunks;           /*list of the allocated chunks, linked through their header.*/
+    char *chunksTail;       /*oldest chunk, last of 'chunks'.*/
+    char *bump;             /*next never used node of the newest chunk.*/
+    char *bumpEnd;          /*end of the newest chunk.*/
+    char *spare;            /*never used ranges of nodes left by merged pools, each one holding the next and its end.*/
+    char *spareTail;        /*last range of 'spare'.*/
+    struct allocator allocator;     /*used for the pool itself and its chunks.*/
+    size_t refs;            /*number of owners sharing the pool: the last one to destroy it releases it.*/
+    struct nodePool *forward;       /*pool this one has been merged into, or NULL.*/
+};
+typedef struct nodePool* nodePool_t;
+/*
+ * Fixed-size node pool: nodes are carved out of big chunks, and released nodes are kept in a free list
+ * for reuse. Chunks are only released all at once, when the pool is destroyed.
+*/
+
 /*global variables*/
 extern free_t freeFun;
 extern malloc_t mallocFun;
 
-/*needed for the client to get error info.*/
-extern error_rick45b RICK45B;
+/*allocator that forwards to the functions given to 'RICK45B_LibStart()'. Used when no allocator is given.*/
+extern struct allocator RICK45B_DefaultAllocator;
+
+/*needed for the client to get error info. Each thread has its own slot.*/
+extern RICK45B_THREAD_LOCAL error_rick45b RICK45B;
 
 char *RICK45B_GetError();
 /*
- * Funcion that, once called, returns the latest error message of the library.
- * Returns: a string containing the error's message.
+ * Funcion that, once called, returns the latest error message of the library set by the calling thread.
+ * Returns: a string containing the error's message (an empty string if no error has been set yet).
+ * No arguments must be provided.
+*/
+
+RICK45B_errorCode_t RICK45B_LastErrorCode();
+/*
+ * Function that, once called, returns the code of the latest error of the library set by the calling thread.
+ * Returns: a RICK45B_errorCode_t value, RICK45B_NO_ERROR if no error has been set since the last call
+ * to 'RICK45B_ClearError()'.
  * No arguments must be provided.
 */
 
+void RICK45B_ClearError();
+/*
+ * Function that resets the calling thread's error state to RICK45B_NO_ERROR.
+ * Errors are never cleared by the library on success, so call this function before an operation
+ * if you'd like to test its outcome with 'RICK45B_LastErrorCode()'.
+ * Returns nothing.
+*/
+
+nodePool_t RICK45B_NodePoolCreate(size_t nodeSize, size_t nodesPerChunk, allocator_t allocator);
+/*
+ * Function that creates a new pool of fixed-size nodes.
+ * Returns the new pool, or NULL if an error has occurred.
+ * Arguments:
+ * nodeSize -> the size of every node of the pool.
+ * nodesPerChunk -> number of nodes allocated at once. If 0, RICK45B_POOL_DEFAULT_CHUNK will be used.
+ * allocator -> the allocator used for the pool and its chunks. If NULL, the functions given to
+ * 'RICK45B_LibStart()' will be used.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+void RICK45B_NodePoolDestroy(nodePool_t pool);
+/*
+ * Function that drops one owner of a pool: when the last one is gone, the pool is destroyed and all of its
+ * chunks are released at once, and every node obtained from the pool becomes invalid.
+ * Returns nothing.
+*/
+
+int RICK45B_NodePoolMerge(nodePool_t dst, nodePool_t src);
+/*
+ * Function that moves every chunk of 'src' into 'dst', together with its free and never used nodes, so that the
+ * nodes taken from either pool can be given back to the other one. No node is copied, no memory is allocated, and
+ * the call takes O(1) time.
+ * The owners of 'src' can keep using it: its allocations and releases are forwarded to 'dst', which is kept
+ * alive until 'src' is destroyed by all of them. Merging two pools already merged together does nothing.
+ * Returns -1 if an error has occurred (the pools have different node sizes or allocators), 0 otherwise.
+ * Arguments:
+ * dst -> the pool receiving the chunks.
+ * src -> the pool to merge into 'dst'.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+nodePool_t RICK45B_NodePoolMerged(nodePool_t pool);
+/*
+ * Function that returns the pool which the given one has been merged into (see 'RICK45B_NodePoolMerge()'), or the
+ * given pool itself if it has never been merged.
+*/
+
+void *RICK45B_NodePoolAlloc(nodePool_t pool);
+/*
+ * Function that takes a node from the pool, allocating a new chunk only if no free node is left.
+ * Returns the node, or NULL if an error has occurred.
+ *
+ * If an error has occurred, the error message can be retrieved by using the function 'RICK45B_GetError()'.
+*/
+
+void RICK45B_NodePoolFree(nodePool_t pool, void *node);
+/*
+ * Function that gives a node back to the pool it was taken from, so that it can be reused.
+ * Returns nothing.
+*/
+
+struct allocator RICK45B_NodePoolAllocator(nodePool_t pool);
+/*
+ * Function that returns an allocator whose functions take nodes from / give nodes back to the given pool.
+ * Its allocation function fails for sizes bigger than the pool's node size.
+*/
+
 /*private functions: DO NOT USE THEM.*/
-void RICK45B_SetError(char *errorMsg);
+static __inline__ void *RICK45B_Alloc(struct allocator const *allocator, size_t size)
+{
+    return allocator->alloc_funct(size, allocator->ctx);
+}
+
+static __inline__ void RICK45B_Free(struct allocator const *allocator, void *ptr)
+{
+    allocator->free_funct(ptr, allocator->ctx);
+}
+/*
+ * Functions used by the ADTs to allocate / deallocate memory through their allocator.
+*/
+
+struct allocator RICK45B_PickAllocator(allocator_t allocator);
 /*
- * Simple function, used to set error msg in the "struct error" datatype, so that
- * string.h standard library is not necessarily required.
+ * Function that returns a copy of 'allocator', or RICK45B_DefaultAllocator if 'allocator' is NULL.
+*/
+
+void RICK45B_SetError(RICK45B_errorCode_t code, char *errorMsg);
+/*
+ * Simple function, used to set error code and msg in the calling thread's "struct error" slot.
+ * errorMsg MUST be a string with static storage duration (i.e. a string literal), as only
+ * its address is stored.
 */
 
 void RICK45B_CopyString(char const*source, char *dest, size_t lenght);
 /*
- * Simple function that mimics the string.h's 'strcpy' function.
+ * Simple function that mimics the string.h's 'strcpy' function. Copies a word at a time when source and
+ * dest share the same alignment.
  * returns nothing.
  * Arguments:
  * source -> the source string
@@ -74,12 +244,20 @@ void RICK45B_CopyString(char const*source, char *dest, size_t lenght);
 
 size_t RICK45B_Strlen(char const *string);
 /*
- * Function that mimics the string.h's function 'strlen'.
+ * Function that mimics the string.h's function 'strlen'. It is iterative and scans a word at a time.
  * Returns 0 if string is NULL.
 */
 
 int RICK45B_Stringcmp(char const *string1, char const *string2);
 /*
  * Function that mimics the string.h's function 'strcmp'.
- * Returns -1 if an error has occurred, 0 if the strings are equal, a number >0 otherwise.
+ * Returns -1 if an error has occurred (or the strings have different lenghts), 0 if the strings are equal,
+ * a number >0 otherwise.
+*/
+
+int RICK45B_StringEqual(char const *string1, char const *string2);
+/*
+ * Function that checks if two strings contain the same characters, in a single pass and a word at a time
+ * when both strings share the same alignment.
+ * Returns 1 if the strings are equal (or both NULL), 0 otherwise.
 */
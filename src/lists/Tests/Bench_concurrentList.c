@@ -0,0 +1,138 @@
+/*
+ * @LICENSE: This file has no copyright assigned and is placed in the Public Domain.
+ * @AUTHOR: Riccardo Giovanni Gualiumi 2024
+ * No Software Warranty. The Software and related documentation are provided “AS IS” and without any warranty of any kind and Seller EXPRESSLY DISCLAIMS ALL WARRANTIES, EXPRESS
+ * OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+*/
+
+/*
+ * Throughput benchmark of the lock-free concurrent list against a sorted list_t shared under a mutex, with 1 to
+ * MAX_THREADS threads running the same mix of operations (80% lookups, 10% insertions, 10% removals) on a set of
+ * KEYS keys, half of them in the list at the start.
+ * The times are wall-clock times: on a machine with fewer cores than threads the lock-free list can't scale past
+ * the number of cores.
+*/
+
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <pthread.h>
+#include "Rick45B-AlgorithmsADT.h"
+
+#define MAX_THREADS 16
+#define KEYS 1024
+#define OPS_PER_RUN (1024*1024)   /*every measure performs this many operations, split among the threads*/
+
+int RICK45B_DoubleCMP(const void *a, const void *b){
+    const double *aa = a;
+    const double *bb = b;
+    return (*aa > *bb) - (*aa < *bb);
+}
+
+double keys[KEYS];
+list_t locked;
+pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+concurrentList_t clist;
+
+struct worker{
+    int lockFree;       /*TRUE to use the concurrent list, FALSE for the list_t under the mutex.*/
+    size_t ops;
+    unsigned long long seed;
+    size_t hits;        /*keeps the compiler from dropping the lookups*/
+};
+
+void *Worker(void *arg)
+{
+    struct worker *worker = arg;
+    size_t i;
+    for (i = 0; i<worker->ops; i++)
+    {
+        worker->seed ^= worker->seed << 13;
+        worker->seed ^= worker->seed >> 7;
+        worker->seed ^= worker->seed << 17;
+        double *key = &keys[(worker->seed>>8)%KEYS];
+        size_t op = (size_t)(worker->seed>>40)%10;
+        if (worker->lockFree)
+        {
+            if (op == 0)    RICK45BLISTS_ConcurrentListInsert(key, clist);
+            else if (op == 1)   RICK45BLISTS_ConcurrentListRemove(clist, key, 0);
+            else    worker->hits += (size_t)RICK45BLISTS_ConcurrentListContains(clist, key);
+        }
+        else
+        {
+            pthread_mutex_lock(&lock);
+            if (op == 0)
+            {
+                if (RICK45BLISTS_GetNodeByKey(locked, key) == NULL)
+                    RICK45BLISTS_InsertSorted(key, locked);
+            }
+            else if (op == 1)   RICK45BLISTS_RemoveNodeByKey(locked, key, 0);
+            else    worker->hits += RICK45BLISTS_GetNodeByKey(locked, key) != NULL;
+            pthread_mutex_unlock(&lock);
+        }
+    }
+    return NULL;
+}
+
+/*returns the millions of operations per second of the given number of threads.*/
+double Measure(int lockFree, size_t threads)
+{
+    pthread_t ids[MAX_THREADS];
+    struct worker workers[MAX_THREADS];
+    struct timespec start, end;
+    size_t t;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (t = 0; t<threads; t++)
+    {
+        workers[t].lockFree = lockFree;
+        workers[t].ops = OPS_PER_RUN/threads;
+        workers[t].seed = 0x9E3779B97F4A7C15ULL*(t+1);
+        workers[t].hits = 0;
+        if (pthread_create(&ids[t], NULL, Worker, &workers[t]) != 0)
+        {
+            perror("Fatal Error: cannot start the benchmark's threads!");
+            exit(1);
+        }
+    }
+    for (t = 0; t<threads; t++)
+        pthread_join(ids[t], NULL);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    double seconds = (double)(end.tv_sec-start.tv_sec)+(double)(end.tv_nsec-start.tv_nsec)*1e-9;
+    return (double)(OPS_PER_RUN/threads*threads)/seconds*1e-6;
+}
+
+int main()
+{
+    RICK45B_LibStart(malloc, free);
+    locked = RICK45BLISTS_ListCreate(RICK45B_DoubleCMP);
+    clist = RICK45BLISTS_ConcurrentListCreate(RICK45B_DoubleCMP);
+    if (locked == NULL || clist == NULL)
+    {
+        perror("Fatal Error: cannot allocate the benchmark's lists!");
+        return 1;
+    }
+    size_t i, threads;
+    for (i = 0; i<KEYS; i++)
+    {
+        keys[i] = (double)i;
+        if (i%2)
+        {
+            RICK45BLISTS_TailAddListNode(&keys[i], locked);
+            RICK45BLISTS_ConcurrentListInsert(&keys[i], clist);
+        }
+    }
+
+    printf("%10s | %14s %14s   (millions of operations per second)\n", "threads", "list + mutex", "lock-free");
+    for (threads = 1; threads<=MAX_THREADS; threads*=2)
+    {
+        double lockedRate = Measure(FALSE, threads);
+        double lockFreeRate = Measure(TRUE, threads);
+        printf("%10lu | %14.2f %14.2f\n", (unsigned long)threads, lockedRate, lockFreeRate);
+    }
+
+    RICK45BLISTS_ListDestroy(&locked, 0);
+    RICK45BLISTS_ConcurrentListDestroy(&clist, 0);
+    return 0;
+}
@@ -0,0 +1,106 @@
+/*
+ * @LICENSE: This file has no copyright assigned and is placed in the Public Domain.
+ * @AUTHOR: Riccardo Giovanni Gualiumi 2024
+ * No Software Warranty. The Software and related documentation are provided “AS IS” and without any warranty of any kind and Seller EXPRESSLY DISCLAIMS ALL WARRANTIES, EXPRESS
+ * OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+*/
+
+/*
+ * Benchmark of full scans (a search for a missing key) on a list_t against an unrolled list holding the same keys,
+ * on lists going from 64K to 4M keys.
+ * Both lists are built by appending, and the list_t is measured twice: once in that order, where its nodes usually
+ * follow each other in memory, and once with its nodes relinked in a random order, like in a list that went through
+ * many insertions and removals. The first column is the fair comparison of the two layouts, the second one shows
+ * what the list_t loses when its nodes are scattered.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "Rick45B-AlgorithmsADT.h"
+
+#define MAX_KEYS (4*1024*1024)
+#define KEYS_PER_RUN (64*1024*1024)     /*every measure scans about this many keys*/
+
+int RICK45B_DoubleCMP(const void *a, const void *b){
+    const double *aa = a;
+    const double *bb = b;
+    return (*aa > *bb) - (*aa < *bb);
+}
+
+volatile size_t sink;   /*keeps the compiler from dropping the measured calls*/
+
+double Elapsed(clock_t start)
+{
+    return (double)(clock()-start)/CLOCKS_PER_SEC;
+}
+
+int main()
+{
+    RICK45B_LibStart(malloc, free);
+    double *keys = malloc(sizeof(double)*MAX_KEYS);
+    listNode_t *nodes = malloc(sizeof(listNode_t)*MAX_KEYS);
+    if (keys == NULL || nodes == NULL)
+    {
+        perror("Fatal Error: cannot allocate the benchmark's buffers!");
+        return 1;
+    }
+    double missing = -1;
+
+    printf("%10s | %14s %14s %14s   (ns per scanned key)\n", "keys", "list_t", "shuffled", "unrolled list");
+    size_t size, i, run;
+    srand(45);
+    for (size = 64*1024; size<=MAX_KEYS; size*=4)
+    {
+        list_t list = RICK45BLISTS_ListCreate(RICK45B_DoubleCMP);
+        unrolledList_t ulist = RICK45BLISTS_UnrolledListCreate(RICK45B_DoubleCMP);
+        for (i=0; i<size; i++)
+        {
+            keys[i] = (double)i;
+            RICK45BLISTS_TailAddListNode(&keys[i], list);
+            RICK45BLISTS_TailAddUnrolledListKey(&keys[i], ulist);
+        }
+
+        size_t runs = KEYS_PER_RUN/size;
+        clock_t start = clock();
+        for (run=0; run<runs; run++)
+            sink += (size_t)RICK45BLISTS_GetNodeByKey(list, &missing);
+        double listTime = Elapsed(start)*1e9/(double)(runs*size);
+
+        /*relinking the list's nodes in a random order*/
+        listNode_t node = list->head;
+        for (i=0; i<size; i++, node = node->next)
+            nodes[i] = node;
+        for (i=size-1; i>0; i--)
+        {
+            size_t j = ((size_t)rand()*((size_t)RAND_MAX+1)+(size_t)rand())%(i+1);
+            listNode_t temp = nodes[i];
+            nodes[i] = nodes[j];
+            nodes[j] = temp;
+        }
+        for (i=0; i+1<size; i++)
+            nodes[i]->next = nodes[i+1];
+        nodes[size-1]->next = NULL;
+        list->head = nodes[0];
+        list->tail = nodes[size-1];
+        list->tailPrevious = nodes[size-2];
+
+        start = clock();
+        for (run=0; run<runs; run++)
+            sink += (size_t)RICK45BLISTS_GetNodeByKey(list, &missing);
+        double shuffledTime = Elapsed(start)*1e9/(double)(runs*size);
+
+        start = clock();
+        for (run=0; run<runs; run++)
+            sink += (size_t)RICK45BLISTS_GetKeyByKeyUnrolled(ulist, &missing);
+        double unrolledTime = Elapsed(start)*1e9/(double)(runs*size);
+
+        printf("%10lu | %14.2f %14.2f %14.2f\n", (unsigned long)size, listTime, shuffledTime, unrolledTime);
+        RICK45BLISTS_ListDestroy(&list, 0);
+        RICK45BLISTS_UnrolledListDestroy(&ulist, 0);
+    }
+
+    free(keys);
+    free(nodes);
+    return 0;
+}
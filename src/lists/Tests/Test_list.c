@@ -10,6 +10,7 @@
 #include <assert.h>
 #include <unistd.h>
 #include <string.h>
+#include <pthread.h>
 #include "Rick45B-AlgorithmsADT.h"
 
 void destroy_createListTEST();
@@ -20,6 +21,25 @@ void destroy_createDoubleListTEST();
 void insert_removeDoubleListTEST();
 void ErrorDoubleListTEST();
 void nextPreviousTESTS();
+void allocatorListTEST();
+void tailListTEST();
+void iteratorListTEST();
+void editListTEST();
+void positionDoubleListTEST();
+void indexedListTEST();
+void unrolledListTEST();
+void removeIfListTEST();
+void sortListTEST();
+void spliceListTEST();
+void fromArrayListTEST();
+void toArrayListTEST();
+void parallelListTEST();
+void sortedSetListTEST();
+void hashIndexListTEST();
+void searchModeListTEST();
+void concurrentListTEST();
+void intrusiveListTEST();
+void xorListTEST();
 void VisualizerDouble(list_t list)
 {
     if (list == NULL)
@@ -129,6 +149,44 @@ int main()
     /*misc tests*/
     nextPreviousTESTS();
     printf("***nextPreviousTESTS was successful***\n\n");
+    allocatorListTEST();
+    printf("***allocatorListTEST was successful***\n\n");
+    tailListTEST();
+    printf("***tailListTEST was successful***\n\n");
+    iteratorListTEST();
+    printf("***iteratorListTEST was successful***\n\n");
+    editListTEST();
+    printf("***editListTEST was successful***\n\n");
+    positionDoubleListTEST();
+    printf("***positionDoubleListTEST was successful***\n\n");
+    indexedListTEST();
+    printf("***indexedListTEST was successful***\n\n");
+    unrolledListTEST();
+    printf("***unrolledListTEST was successful***\n\n");
+    removeIfListTEST();
+    printf("***removeIfListTEST was successful***\n\n");
+    sortListTEST();
+    printf("***sortListTEST was successful***\n\n");
+    spliceListTEST();
+    printf("***spliceListTEST was successful***\n\n");
+    fromArrayListTEST();
+    printf("***fromArrayListTEST was successful***\n\n");
+    toArrayListTEST();
+    printf("***toArrayListTEST was successful***\n\n");
+    parallelListTEST();
+    printf("***parallelListTEST was successful***\n\n");
+    sortedSetListTEST();
+    printf("***sortedSetListTEST was successful***\n\n");
+    hashIndexListTEST();
+    printf("***hashIndexListTEST was successful***\n\n");
+    searchModeListTEST();
+    printf("***searchModeListTEST was successful***\n\n");
+    concurrentListTEST();
+    printf("***concurrentListTEST was successful***\n\n");
+    intrusiveListTEST();
+    printf("***intrusiveListTEST was successful***\n\n");
+    xorListTEST();
+    printf("***xorListTEST was successful***\n\n");
     printf("\n***All test were successful***\n\n");
     return 0;
 }
@@ -695,3 +753,2049 @@ void nextPreviousTESTS()
     RICK45BLISTS_ListDestroy(&list, 0);
     RICK45BLISTS_DoubleListDestroy(&listDouble, 0);
 }
+
+void *CountingAlloc(size_t size, void *ctx)
+{
+    (*(int *)ctx)++;
+    return malloc(size);
+}
+
+void CountingFree(void *ptr, void *ctx)
+{
+    (*(int *)ctx)--;
+    free(ptr);
+}
+
+void allocatorListTEST()
+{
+    double array_keys[] = {1.0, 3.9, -2, 7.3, 9.81, 347, 8250.72};
+    int live = 0;   /*number of live allocations made through the allocator*/
+    struct allocator counting = {CountingAlloc, CountingFree, &live};
+    struct allocator broken = {CountingAlloc, NULL, &live};
+    int cnt;
+
+    /*single linked list*/
+    list_t list = RICK45BLISTS_ListCreateWithAllocator(RICK45B_DoubleCMP, &counting);
+    assert(list != NULL && live == 1);
+    for (cnt = 0; cnt<7; cnt++)
+        assert(RICK45BLISTS_TailAddListNode(&array_keys[cnt], list)==0);
+    assert(RICK45BLISTS_AddListNode(&array_keys[0], list, 3)==0);
+    assert(live == 9);
+    assert(RICK45BLISTS_RemoveHead(list, 0)==0 && RICK45BLISTS_RemoveNode(list, 2, 0)==0 && RICK45BLISTS_RemoveNodeByKey(list, &array_keys[5], 0)==1);
+    assert(live == 6);
+    RICK45BLISTS_ListDestroy(&list, 0);
+    assert(list == NULL && live == 0);
+
+    /*double linked list*/
+    doubleList_t dlist = RICK45BLISTS_DoubleListCreateWithAllocator(RICK45B_DoubleCMP, &counting);
+    assert(dlist != NULL && live == 1);
+    for (cnt = 0; cnt<7; cnt++)
+        assert(RICK45BLISTS_HeadAddDoubleListNode(&array_keys[cnt], dlist)==0);
+    assert(RICK45BLISTS_AddDoubleListNode(&array_keys[0], dlist, 3)==0);
+    assert(live == 9);
+    assert(RICK45BLISTS_DoubleListRemoveHead(dlist, 0)==0 && RICK45BLISTS_RemoveNodeDouble(dlist, 2, 0)==0 && RICK45BLISTS_RemoveTailDouble(dlist, 0)==0);
+    assert(live == 6);
+    RICK45BLISTS_DoubleListDestroy(&dlist, 0);
+    assert(dlist == NULL && live == 0);
+
+    /*node pools: 7 nodes with 4 nodes per chunk -> 2 chunks, reused after removals*/
+    list = RICK45BLISTS_ListCreateWithAllocator(RICK45B_DoubleCMP, &counting);
+    assert(RICK45BLISTS_ListUseNodePool(list, 4)==0 && live == 2);
+    assert(RICK45BLISTS_ListUseNodePool(list, 4)==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_INVALID_ARGUMENT);
+    for (cnt = 0; cnt<7; cnt++)
+        assert(RICK45BLISTS_TailAddListNode(&array_keys[cnt], list)==0);
+    assert(live == 4);
+    for (cnt = 0; cnt<100; cnt++)
+        assert(RICK45BLISTS_RemoveHead(list, 0)==0 && RICK45BLISTS_TailAddListNode(&array_keys[cnt%7], list)==0);
+    assert(live == 4 && RICK45BLISTS_GetListSize(list)==7);
+    assert(RICK45BLISTS_RemoveTail(list, 0)==0 && *(double *)RICK45BLISTS_GetKeyByPosition(list, 0)==array_keys[2]);
+    RICK45BLISTS_ListDestroy(&list, 0);
+    assert(live == 0);
+
+    dlist = RICK45BLISTS_DoubleListCreateWithAllocator(RICK45B_DoubleCMP, &counting);
+    assert(RICK45BLISTS_DoubleListUseNodePool(dlist, 0)==0 && live == 2);
+    for (cnt = 0; cnt<7; cnt++)
+        assert(RICK45BLISTS_HeadAddDoubleListNode(&array_keys[cnt], dlist)==0);
+    assert(live == 3);
+    assert(RICK45BLISTS_DoubleListUseNodePool(dlist, 0)==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_INVALID_ARGUMENT);
+    assert(RICK45BLISTS_RemoveTailDouble(dlist, 0)==0 && RICK45BLISTS_DoubleListRemoveHead(dlist, 0)==0);
+    RICK45BLISTS_DoubleListDestroy(&dlist, 0);
+    assert(live == 0);
+
+    /*errors*/
+    assert(RICK45BLISTS_ListUseNodePool(NULL, 0)==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_NULL_ADT);
+    assert(RICK45BLISTS_ListCreateWithAllocator(RICK45B_DoubleCMP, &broken)==NULL && RICK45B_LastErrorCode()==RICK45B_ERR_INVALID_ARGUMENT);
+    assert(RICK45BLISTS_DoubleListCreateWithAllocator(RICK45B_DoubleCMP, &broken)==NULL && RICK45B_LastErrorCode()==RICK45B_ERR_INVALID_ARGUMENT);
+    assert(live == 0);
+}
+
+/*checks the list's links, its size, its tail and (if known) the node before the tail.*/
+void CheckListLinks(list_t list)
+{
+    size_t cnt = 0;
+    listNode_t temp = list->head;
+    listNode_t old = NULL;
+    listNode_t oldOld = NULL;
+    while (temp!=NULL)
+    {
+        oldOld = old;
+        old = temp;
+        temp = temp->next;
+        cnt++;
+    }
+    assert(cnt == list->size && list->tail == old);
+    assert(list->tailPrevious == NULL || list->tailPrevious == oldOld);
+}
+
+void tailListTEST()
+{
+    double array_keys[] = {1.0, 3.9, -2, 7.3, 9.81, 347, 8250.72};
+    list_t list = RICK45BLISTS_ListCreate(RICK45B_DoubleCMP);
+    int cnt;
+
+    /*single node*/
+    assert(RICK45BLISTS_TailAddListNode(&array_keys[0], list)==0 && RICK45BLISTS_RemoveTail(list, 0)==0);
+    assert(list->head == NULL && list->tail == NULL && RICK45BLISTS_GetListSize(list)==0);
+    assert(RICK45BLISTS_RemoveTail(list, 0)==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_EMPTY);
+    assert(RICK45BLISTS_HeadAddListNode(&array_keys[0], list)==0 && RICK45BLISTS_RemoveHead(list, 0)==0);
+    assert(list->head == NULL && list->tail == NULL);
+    assert(RICK45BLISTS_TailAddListNode(&array_keys[1], list)==0);   /*the old tail must not be reused*/
+    CheckListLinks(list);
+
+    /*tail insertions / removals*/
+    for (cnt = 0; cnt<7; cnt++)
+    {
+        assert(RICK45BLISTS_TailAddListNode(&array_keys[cnt], list)==0);
+        CheckListLinks(list);
+    }
+    assert(list->tailPrevious != NULL);
+    assert(RICK45BLISTS_RemoveTail(list, 0)==0 && *(double *)list->tail->key == array_keys[5]);
+    CheckListLinks(list);
+    assert(RICK45BLISTS_RemoveTail(list, 0)==0 && *(double *)list->tail->key == array_keys[4]); /*predecessor not known*/
+    CheckListLinks(list);
+
+    /*every other operation keeps the node before the tail consistent*/
+    assert(RICK45BLISTS_TailAddListNode(&array_keys[6], list)==0);
+    assert(RICK45BLISTS_AddListNode(&array_keys[3], list, RICK45BLISTS_GetListSize(list)-1)==0);
+    CheckListLinks(list);
+    assert(*(double *)list->tailPrevious->key == array_keys[3]);
+    assert(RICK45BLISTS_RemoveNode(list, RICK45BLISTS_GetListSize(list)-2, 0)==0);
+    CheckListLinks(list);
+    assert(RICK45BLISTS_RemoveNodeByKey(list, &array_keys[4], 0)==1);
+    CheckListLinks(list);
+    assert(RICK45BLISTS_RemoveNodeByKey(list, &array_keys[6], 0)==1);
+    CheckListLinks(list);
+    assert(RICK45BLISTS_RemoveNode(list, RICK45BLISTS_GetListSize(list), 0)==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_OUT_OF_RANGE);
+    while (RICK45BLISTS_GetListSize(list)>2)
+        assert(RICK45BLISTS_RemoveHead(list, 0)==0);
+    assert(RICK45BLISTS_TailAddListNode(&array_keys[2], list)==0 && RICK45BLISTS_RemoveHead(list, 0)==0);
+    CheckListLinks(list);
+    assert(RICK45BLISTS_HeadAddListNode(&array_keys[5], list)==0);
+    CheckListLinks(list);
+    assert(list->tailPrevious == list->head->next);
+    while (RICK45BLISTS_GetListSize(list)>0)
+    {
+        assert(RICK45BLISTS_RemoveTail(list, 0)==0);
+        CheckListLinks(list);
+    }
+    RICK45BLISTS_ListDestroy(&list, 0);
+}
+
+#define READERS 4
+
+/*sums the keys of the list given as argument, walking it with its own iterator.*/
+void *SumReader(void *arg)
+{
+    struct listIterator it;
+    listNode_t node;
+    double *sum = malloc(sizeof(double));
+    int round;
+    *sum = 0;
+    for (round = 0; round<100; round++)
+    {
+        assert(RICK45BLISTS_IteratorInit(&it, (list_t)arg)==0);
+        while ((node = RICK45BLISTS_IteratorNext(&it)) != NULL)
+            *sum += *(double *)node->key;
+    }
+    return sum;
+}
+
+void iteratorListTEST()
+{
+    double array_keys[] = {1.0, 3.9, -2, 7.3, 9.81, 347, 8250.72};
+    list_t list = RICK45BLISTS_ListCreate(RICK45B_DoubleCMP);
+    doubleList_t dlist = RICK45BLISTS_DoubleListCreate(RICK45B_DoubleCMP);
+    struct listIterator it1, it2;
+    struct doubleListIterator dit;
+    listNode_t node;
+    int cnt;
+
+    /*empty lists*/
+    assert(RICK45BLISTS_IteratorInit(&it1, list)==0 && RICK45BLISTS_IteratorHasNext(&it1)==0 && RICK45BLISTS_IteratorNext(&it1)==NULL);
+    assert(RICK45BLISTS_DoubleIteratorInit(&dit, dlist)==0 && RICK45BLISTS_DoubleIteratorNext(&dit)==NULL && RICK45BLISTS_DoubleIteratorPrevious(&dit)==NULL);
+
+    for (cnt = 0; cnt<7; cnt++)
+    {
+        RICK45BLISTS_TailAddListNode(&array_keys[cnt], list);
+        RICK45BLISTS_TailAddDoubleListNode(&array_keys[cnt], dlist);
+    }
+
+    /*two independent iterators on the same list*/
+    RICK45BLISTS_IteratorInit(&it1, list);
+    RICK45BLISTS_IteratorInit(&it2, list);
+    assert(RICK45BLISTS_IteratorNext(&it1)==list->head && RICK45BLISTS_IteratorNext(&it1)==list->head->next);
+    for (cnt = 0; cnt<7; cnt++)
+    {
+        assert(RICK45BLISTS_IteratorHasNext(&it2)==1);
+        assert(*(double *)RICK45BLISTS_IteratorNext(&it2)->key == array_keys[cnt]);
+    }
+    assert(RICK45BLISTS_IteratorHasNext(&it2)==0 && RICK45BLISTS_IteratorNext(&it2)==NULL);
+    assert(*(double *)RICK45BLISTS_IteratorNext(&it1)->key == array_keys[2]);
+
+    /*removing the node just returned*/
+    RICK45BLISTS_IteratorInit(&it1, list);
+    while ((node = RICK45BLISTS_IteratorNext(&it1)) != NULL)
+        if (*(double *)node->key < 5)
+            assert(RICK45BLISTS_RemoveNodeByKey(list, node->key, 0)==1);
+    assert(RICK45BLISTS_GetListSize(list)==4 && *(double *)list->head->key == array_keys[3]);
+
+    /*double linked list, both directions*/
+    RICK45BLISTS_DoubleIteratorInit(&dit, dlist);
+    assert(RICK45BLISTS_DoubleIteratorHasPrevious(&dit)==0 && RICK45BLISTS_DoubleIteratorHasNext(&dit)==1);
+    for (cnt = 0; cnt<7; cnt++)
+        assert(*(double *)RICK45BLISTS_DoubleIteratorNext(&dit)->key == array_keys[cnt]);
+    assert(RICK45BLISTS_DoubleIteratorHasNext(&dit)==0 && RICK45BLISTS_DoubleIteratorNext(&dit)==NULL);
+    assert(RICK45BLISTS_DoubleIteratorPrevious(&dit)==dlist->tail);
+    assert(RICK45BLISTS_DoubleIteratorNext(&dit)==dlist->tail);
+    RICK45BLISTS_DoubleIteratorInitTail(&dit, dlist);
+    for (cnt = 6; cnt>=0; cnt--)
+        assert(*(double *)RICK45BLISTS_DoubleIteratorPrevious(&dit)->key == array_keys[cnt]);
+    assert(RICK45BLISTS_DoubleIteratorHasPrevious(&dit)==0 && RICK45BLISTS_DoubleIteratorPrevious(&dit)==NULL);
+
+    /*concurrent readers*/
+    pthread_t readers[READERS];
+    double expected = 0;
+    for (cnt = 0; cnt<7; cnt++)
+        RICK45BLISTS_TailAddListNode(&array_keys[cnt], list);
+    double *sum = SumReader(list);  /*same additions in the same order: the sums must match exactly*/
+    expected = *sum;
+    free(sum);
+    for (cnt = 0; cnt<READERS; cnt++)
+        assert(pthread_create(&readers[cnt], NULL, SumReader, list)==0);
+    for (cnt = 0; cnt<READERS; cnt++)
+    {
+        void *result;
+        assert(pthread_join(readers[cnt], &result)==0);
+        assert(*(double *)result == expected);
+        free(result);
+    }
+
+    /*errors*/
+    assert(RICK45BLISTS_IteratorInit(&it1, NULL)==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_NULL_ADT);
+    assert(RICK45BLISTS_IteratorNext(NULL)==NULL && RICK45B_LastErrorCode()==RICK45B_ERR_INVALID_ARGUMENT);
+    assert(RICK45BLISTS_DoubleIteratorInitTail(NULL, dlist)==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_INVALID_ARGUMENT);
+
+    RICK45BLISTS_ListDestroy(&list, 0);
+    RICK45BLISTS_DoubleListDestroy(&dlist, 0);
+}
+
+/*checks both links of every node of the double linked list, its size and its tail.*/
+void CheckDoubleListLinks(doubleList_t dlist)
+{
+    size_t cnt = 0;
+    doubleListNode_t temp = dlist->head;
+    doubleListNode_t old = NULL;
+    while (temp!=NULL)
+    {
+        assert(temp->previous == old);
+        old = temp;
+        temp = temp->next;
+        cnt++;
+    }
+    assert(cnt == dlist->size && dlist->tail == old);
+}
+
+void editListTEST()
+{
+    double array_keys[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    double added = 100;
+    list_t list = RICK45BLISTS_ListCreate(RICK45B_DoubleCMP);
+    doubleList_t dlist = RICK45BLISTS_DoubleListCreate(RICK45B_DoubleCMP);
+    struct listIterator it;
+    struct doubleListIterator dit;
+    listNode_t node;
+    doubleListNode_t dnode;
+    int cnt;
+
+    /*single linked list: building it through an iterator*/
+    RICK45BLISTS_IteratorInit(&it, list);
+    assert(RICK45BLISTS_IteratorRemove(&it, 0)==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_INVALID_ARGUMENT);
+    for (cnt = 0; cnt<10; cnt++)
+        assert(RICK45BLISTS_IteratorAdd(&it, &array_keys[cnt])==0);   /*0 -> 1 -> ... -> 9*/
+    CheckListLinks(list);
+    assert(RICK45BLISTS_IteratorNext(&it)==NULL && *(double *)list->tail->key == 9);
+
+    /*removing the odd keys and adding a key after every even one, in a single pass*/
+    RICK45BLISTS_IteratorInit(&it, list);
+    while ((node = RICK45BLISTS_IteratorNext(&it)) != NULL)
+    {
+        if ((int)*(double *)node->key % 2)
+            assert(RICK45BLISTS_IteratorRemove(&it, 0)==0);
+        else
+        {
+            assert(RICK45BLISTS_IteratorAdd(&it, &added)==0);
+            assert(RICK45BLISTS_IteratorRemove(&it, 0)==-1);   /*nothing to remove right after an add*/
+        }
+        CheckListLinks(list);
+    }
+    assert(RICK45BLISTS_GetListSize(list)==10);
+    for (cnt = 0; cnt<10; cnt++)
+        assert(*(double *)RICK45BLISTS_GetKeyByPosition(list, (size_t)cnt) == (cnt%2 ? added : cnt));
+
+    /*node handles*/
+    node = RICK45BLISTS_GetNodeByKey(list, &array_keys[8]);
+    assert(RICK45BLISTS_AddListNodeAfter(&array_keys[9], list, list->tail)==0 && *(double *)list->tail->key == 9);
+    assert(RICK45BLISTS_RemoveNodeAfter(list, list->tail, 0)==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_OUT_OF_RANGE);
+    assert(RICK45BLISTS_RemoveNodeAfter(list, node, 0)==0 && RICK45BLISTS_RemoveNodeAfter(list, node, 0)==0);
+    assert(list->tail == node);
+    CheckListLinks(list);
+    assert(RICK45BLISTS_AddListNodeAfter(&array_keys[1], list, list->head)==0 && *(double *)list->head->next->key == 1);
+    assert(RICK45BLISTS_AddListNodeAfter(NULL, list, list->head)==-1 && RICK45BLISTS_AddListNodeAfter(&added, list, NULL)==-1);
+    CheckListLinks(list);
+
+    /*removing everything through the iterator*/
+    RICK45BLISTS_IteratorInit(&it, list);
+    while (RICK45BLISTS_IteratorNext(&it) != NULL)
+        assert(RICK45BLISTS_IteratorRemove(&it, 0)==0);
+    assert(list->head == NULL && list->tail == NULL && RICK45BLISTS_GetListSize(list)==0);
+
+    /*double linked list: building it through an iterator, backwards*/
+    RICK45BLISTS_DoubleIteratorInit(&dit, dlist);
+    for (cnt = 9; cnt>=0; cnt--)
+    {
+        assert(RICK45BLISTS_DoubleIteratorAdd(&dit, &array_keys[cnt])==0);
+        RICK45BLISTS_DoubleIteratorPrevious(&dit);  /*steps back over the new node*/
+    }
+    CheckDoubleListLinks(dlist);
+    for (cnt = 0; cnt<10; cnt++)
+        assert(*(double *)RICK45BLISTS_GetKeyByPositionDouble(dlist, (size_t)cnt) == cnt);
+
+    /*removing the odd keys walking forward, then every other one walking backward*/
+    RICK45BLISTS_DoubleIteratorInit(&dit, dlist);
+    while ((dnode = RICK45BLISTS_DoubleIteratorNext(&dit)) != NULL)
+        if ((int)*(double *)dnode->key % 2)
+            assert(RICK45BLISTS_DoubleIteratorRemove(&dit, 0)==0);
+    CheckDoubleListLinks(dlist);
+    assert(RICK45BLISTS_GetDoubleListSize(dlist)==5);
+    RICK45BLISTS_DoubleIteratorInitTail(&dit, dlist);
+    while ((dnode = RICK45BLISTS_DoubleIteratorPrevious(&dit)) != NULL)
+        if ((int)*(double *)dnode->key % 4 == 0)
+        {
+            assert(RICK45BLISTS_DoubleIteratorRemove(&dit, 0)==0);
+            assert(RICK45BLISTS_DoubleIteratorRemove(&dit, 0)==-1);
+        }
+    CheckDoubleListLinks(dlist);
+    assert(RICK45BLISTS_GetDoubleListSize(dlist)==2);
+    assert(*(double *)dlist->head->key == 2 && *(double *)dlist->tail->key == 6);
+
+    /*node handles*/
+    assert(RICK45BLISTS_AddDoubleListNodeBefore(&array_keys[0], dlist, dlist->head)==0 && *(double *)dlist->head->key == 0);
+    assert(RICK45BLISTS_AddDoubleListNodeAfter(&array_keys[9], dlist, dlist->tail)==0 && *(double *)dlist->tail->key == 9);
+    assert(RICK45BLISTS_AddDoubleListNodeAfter(&array_keys[3], dlist, dlist->head->next)==0);
+    assert(RICK45BLISTS_AddDoubleListNodeBefore(&array_keys[5], dlist, dlist->tail->previous)==0);
+    CheckDoubleListLinks(dlist);    /*0 -> 2 -> 3 -> 5 -> 6 -> 9*/
+    assert(RICK45BLISTS_RemoveByNodeDouble(dlist, dlist->head, 0)==0 && RICK45BLISTS_RemoveByNodeDouble(dlist, dlist->tail, 0)==0);
+    assert(RICK45BLISTS_RemoveByNodeDouble(dlist, dlist->head->next, 0)==0);
+    CheckDoubleListLinks(dlist);    /*2 -> 5 -> 6*/
+    assert(*(double *)dlist->head->next->key == 5);
+    assert(RICK45BLISTS_RemoveByNodeDouble(dlist, NULL, 0)==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_INVALID_ARGUMENT);
+
+    /*removals by position keep both links consistent, down to an empty list*/
+    assert(RICK45BLISTS_DoubleListRemoveHead(dlist, 0)==0);
+    CheckDoubleListLinks(dlist);
+    assert(RICK45BLISTS_RemoveNodeDouble(dlist, 2, 0)==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_OUT_OF_RANGE);
+    assert(RICK45BLISTS_RemoveTailDouble(dlist, 0)==0 && RICK45BLISTS_RemoveTailDouble(dlist, 0)==0);
+    assert(dlist->head == NULL && dlist->tail == NULL && RICK45BLISTS_GetDoubleListSize(dlist)==0);
+
+    RICK45BLISTS_ListDestroy(&list, 0);
+    RICK45BLISTS_DoubleListDestroy(&dlist, 0);
+}
+
+/*checks every positional lookup of the double linked list against a walk from its head.*/
+void CheckDoubleListPositions(doubleList_t dlist)
+{
+    size_t cnt = 0;
+    doubleListNode_t temp = dlist->head;
+    while (temp!=NULL)
+    {
+        assert(RICK45BLISTS_GetNodeByPositionDouble(dlist, cnt) == temp);
+        temp = temp->next;
+        cnt++;
+    }
+    assert(RICK45BLISTS_GetNodeByPositionDouble(dlist, cnt)==NULL && RICK45B_LastErrorCode()==RICK45B_ERR_OUT_OF_RANGE);
+}
+
+void positionDoubleListTEST()
+{
+    double array_keys[100];
+    doubleList_t dlist = RICK45BLISTS_DoubleListCreate(RICK45B_DoubleCMP);
+    size_t cnt;
+
+    assert(RICK45BLISTS_GetKeyByPositionDouble(dlist, 0)==NULL && RICK45B_LastErrorCode()==RICK45B_ERR_OUT_OF_RANGE);
+    for (cnt = 0; cnt<100; cnt++)
+    {
+        array_keys[cnt] = (double)cnt;
+        RICK45BLISTS_TailAddDoubleListNode(&array_keys[cnt], dlist);
+    }
+
+    /*scanning forward and backward: every lookup starts from the previous one*/
+    for (cnt = 0; cnt<100; cnt++)
+    {
+        assert(*(double *)RICK45BLISTS_GetKeyByPositionDouble(dlist, cnt) == (double)cnt);
+        assert(dlist->cachedPosition == cnt && *(double *)dlist->cachedNode->key == (double)cnt);
+    }
+    for (cnt = 100; cnt>0; cnt--)
+        assert(*(double *)RICK45BLISTS_GetKeyByPositionDouble(dlist, cnt-1) == (double)(cnt-1));
+    assert(RICK45BLISTS_GetKeyByPositionDouble(dlist, 100)==NULL && RICK45B_LastErrorCode()==RICK45B_ERR_OUT_OF_RANGE);
+
+    /*the cache follows the insertions and the removals*/
+    assert(*(double *)RICK45BLISTS_GetKeyByPositionDouble(dlist, 40) == 40);
+    RICK45BLISTS_DoubleListRemoveHead(dlist, 0);
+    RICK45BLISTS_HeadAddDoubleListNode(&array_keys[0], dlist);
+    RICK45BLISTS_HeadAddDoubleListNode(&array_keys[1], dlist);
+    RICK45BLISTS_RemoveTailDouble(dlist, 0);
+    RICK45BLISTS_TailAddDoubleListNode(&array_keys[2], dlist);
+    assert(*(double *)RICK45BLISTS_GetKeyByPositionDouble(dlist, 41) == 40);
+    CheckDoubleListPositions(dlist);
+    RICK45BLISTS_AddDoubleListNode(&array_keys[3], dlist, 30);
+    RICK45BLISTS_RemoveNodeDouble(dlist, 60, 0);
+    CheckDoubleListPositions(dlist);
+    assert(*(double *)RICK45BLISTS_GetKeyByPositionDouble(dlist, 50) == 48);
+    RICK45BLISTS_RemoveByNodeDouble(dlist, RICK45BLISTS_GetNodeByPositionDouble(dlist, 50), 0);   /*removing the cached node*/
+    CheckDoubleListPositions(dlist);
+    RICK45BLISTS_DoubleListRemoveAllNodes(dlist, 0);
+    assert(dlist->cachedNode == NULL && RICK45BLISTS_GetNodeByPositionDouble(dlist, 0)==NULL);
+
+    RICK45BLISTS_DoubleListDestroy(&dlist, 0);
+}
+
+/*checks that every link of a valid skip list index skips over the right number of list nodes.*/
+void CheckSkipIndex(list_t list)
+{
+    size_t l;
+    assert(list->index->valid);
+    for (l = 0; l<list->index->levels; l++)
+    {
+        struct skipTower *tower = list->index->head;
+        listNode_t node = NULL;
+        while (tower->links[l].next != NULL)
+        {
+            size_t cnt;
+            assert(tower->height>l);
+            for (cnt = 0; cnt<tower->links[l].span; cnt++)
+                node = node!=NULL ? node->next : list->head;
+            tower = tower->links[l].next;
+            assert(node == tower->node);
+        }
+    }
+    for (l = list->index->levels; l<RICK45BLISTS_SKIP_MAX_LEVEL; l++)
+        assert(list->index->head->links[l].next == NULL);
+}
+
+void indexedListTEST()
+{
+    double array_keys[64];
+    list_t list = RICK45BLISTS_IndexedListCreate(RICK45B_DoubleCMP);
+    list_t reference = RICK45BLISTS_ListCreate(RICK45B_DoubleCMP);
+    struct listIterator it;
+    size_t cnt, position;
+
+    assert(RICK45BLISTS_IndexedListCreate(NULL)==NULL && RICK45B_LastErrorCode()==RICK45B_ERR_INVALID_ARGUMENT);
+    assert(RICK45BLISTS_GetNodeByPosition(list, 0)==NULL && RICK45B_LastErrorCode()==RICK45B_ERR_OUT_OF_RANGE);
+    for (cnt = 0; cnt<64; cnt++)
+        array_keys[cnt] = (double)cnt;
+
+    /*random positional edits, checked against a regular list*/
+    srand(45);
+    for (cnt = 0; cnt<20000; cnt++)
+    {
+        double *key = &array_keys[rand()%64];
+        switch (rand()%8)
+        {
+            case 0:
+            case 1:
+                position = (size_t)rand()%(list->size+1);
+                assert(RICK45BLISTS_AddListNode(key, list, position)==0);
+                assert(RICK45BLISTS_AddListNode(key, reference, position)==0);
+                break;
+            case 2:
+                assert(RICK45BLISTS_HeadAddListNode(key, list)==0 && RICK45BLISTS_HeadAddListNode(key, reference)==0);
+                break;
+            case 3:
+                assert(RICK45BLISTS_TailAddListNode(key, list)==0 && RICK45BLISTS_TailAddListNode(key, reference)==0);
+                break;
+            case 4:
+                if (list->size == 0)    break;
+                position = (size_t)rand()%list->size;
+                assert(RICK45BLISTS_RemoveNode(list, position, 0)==0 && RICK45BLISTS_RemoveNode(reference, position, 0)==0);
+                break;
+            case 5:
+                if (list->size == 0)    break;
+                if (rand()%2)
+                    assert(RICK45BLISTS_RemoveHead(list, 0)==0 && RICK45BLISTS_RemoveHead(reference, 0)==0);
+                else
+                    assert(RICK45BLISTS_RemoveTail(list, 0)==0 && RICK45BLISTS_RemoveTail(reference, 0)==0);
+                break;
+            default:
+                if (list->size == 0)    break;
+                position = (size_t)rand()%list->size;
+                assert(RICK45BLISTS_SetKeyByPosition(list, key, position) == RICK45BLISTS_SetKeyByPosition(reference, key, position));
+                assert(RICK45BLISTS_GetKeyByPosition(list, position) == key);
+                break;
+        }
+        if (cnt%1000 == 0)
+        {
+            CheckListLinks(list);
+            CheckSkipIndex(list);
+        }
+    }
+    CheckListLinks(list);
+    CheckSkipIndex(list);
+    assert(list->size == reference->size);
+    for (position = 0; position<list->size; position++)
+        assert(RICK45BLISTS_GetKeyByPosition(list, position) == RICK45BLISTS_GetKeyByPosition(reference, position));
+    assert(RICK45BLISTS_GetKeyByPosition(list, list->size)==NULL && RICK45B_LastErrorCode()==RICK45B_ERR_OUT_OF_RANGE);
+
+    /*edits by node drop the index, the next positional access rebuilds it*/
+    RICK45BLISTS_IteratorInit(&it, list);
+    while (RICK45BLISTS_IteratorNext(&it) != NULL)
+        if (rand()%2)
+            RICK45BLISTS_IteratorRemove(&it, 0);
+    RICK45BLISTS_RemoveNodeByKey(list, &array_keys[0], 0);
+    assert(!list->index->valid);
+    RICK45BLISTS_HeadAddListNode(&array_keys[1], list);
+    RICK45BLISTS_TailAddListNode(&array_keys[2], list);
+    RICK45BLISTS_RemoveHead(list, 0);
+    assert(RICK45BLISTS_GetKeyByPosition(list, list->size-1) == &array_keys[2]);
+    CheckListLinks(list);
+    CheckSkipIndex(list);
+
+    RICK45BLISTS_RemoveAllNodes(list, 0);
+    assert(list->size == 0 && list->index->levels == 0);
+    CheckSkipIndex(list);
+    for (cnt = 0; cnt<64; cnt++)
+        assert(RICK45BLISTS_AddListNode(&array_keys[cnt], list, cnt/2)==0);
+    CheckSkipIndex(list);
+
+    RICK45BLISTS_ListDestroy(&list, 0);
+    RICK45BLISTS_ListDestroy(&reference, 0);
+}
+
+/*checks the size, the tail and the node counts of an unrolled list.*/
+void CheckUnrolledList(unrolledList_t ulist)
+{
+    size_t cnt = 0;
+    unrolledListNode_t node = ulist->head;
+    unrolledListNode_t old = NULL;
+    while (node != NULL)
+    {
+        assert(node->count > 0 && node->count <= RICK45BLISTS_UNROLLED_CAPACITY);
+        cnt += node->count;
+        old = node;
+        node = node->next;
+    }
+    assert(cnt == ulist->size && ulist->tail == old);
+}
+
+int SumKeys(void *elem, void *opt)
+{
+    *(double *)opt += *(double *)elem;
+    return 0;
+}
+
+void unrolledListTEST()
+{
+    double array_keys[64];
+    unrolledList_t ulist = RICK45BLISTS_UnrolledListCreate(RICK45B_DoubleCMP);
+    list_t reference = RICK45BLISTS_ListCreate(RICK45B_DoubleCMP);
+    struct unrolledListIterator it;
+    size_t cnt, position;
+    double sum = 0, expected = 0;
+    void *key;
+
+    assert(RICK45BLISTS_UnrolledListCreate(NULL)==NULL && RICK45B_LastErrorCode()==RICK45B_ERR_INVALID_ARGUMENT);
+    assert(RICK45BLISTS_AddUnrolledListKey(&sum, NULL, 0)==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_NULL_ADT);
+    assert(RICK45BLISTS_AddUnrolledListKey(NULL, ulist, 0)==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_INVALID_ARGUMENT);
+    assert(RICK45BLISTS_AddUnrolledListKey(&sum, ulist, 1)==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_OUT_OF_RANGE);
+    assert(RICK45BLISTS_GetKeyByPositionUnrolled(ulist, 0)==NULL && RICK45B_LastErrorCode()==RICK45B_ERR_OUT_OF_RANGE);
+    assert(RICK45BLISTS_RemoveKeyUnrolled(ulist, 0, 0)==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_OUT_OF_RANGE);
+    assert(RICK45BLISTS_GetKeyByKeyUnrolled(ulist, &sum)==NULL && RICK45B_LastErrorCode()==RICK45B_ERR_NOT_FOUND);
+    for (cnt = 0; cnt<64; cnt++)
+        array_keys[cnt] = (double)cnt;
+
+    /*sequential appends fill the nodes up*/
+    for (cnt = 0; cnt<4*RICK45BLISTS_UNROLLED_CAPACITY; cnt++)
+        assert(RICK45BLISTS_TailAddUnrolledListKey(&array_keys[cnt%64], ulist)==0);
+    CheckUnrolledList(ulist);
+    assert(ulist->head->next->next->next == ulist->tail);
+    RICK45BLISTS_RemoveAllKeysUnrolled(ulist, 0);
+    assert(ulist->head == NULL && RICK45BLISTS_GetUnrolledListSize(ulist)==0);
+
+    /*random edits, checked against a regular list: nodes get split, merged and released*/
+    srand(45);
+    for (cnt = 0; cnt<20000; cnt++)
+    {
+        double *newKey = &array_keys[rand()%64];
+        switch (rand()%7)
+        {
+            case 0:
+            case 1:
+                position = (size_t)rand()%(ulist->size+1);
+                assert(RICK45BLISTS_AddUnrolledListKey(newKey, ulist, position)==0);
+                assert(RICK45BLISTS_AddListNode(newKey, reference, position)==0);
+                break;
+            case 2:
+                assert(RICK45BLISTS_HeadAddUnrolledListKey(newKey, ulist)==0 && RICK45BLISTS_HeadAddListNode(newKey, reference)==0);
+                break;
+            case 3:
+                assert(RICK45BLISTS_TailAddUnrolledListKey(newKey, ulist)==0 && RICK45BLISTS_TailAddListNode(newKey, reference)==0);
+                break;
+            case 4:
+            case 5:
+                if (ulist->size == 0)   break;
+                position = (size_t)rand()%ulist->size;
+                assert(RICK45BLISTS_RemoveKeyUnrolled(ulist, position, 0)==0 && RICK45BLISTS_RemoveNode(reference, position, 0)==0);
+                break;
+            default:
+                assert(RICK45BLISTS_RemoveKeyByKeyUnrolled(ulist, newKey, 0) == RICK45BLISTS_RemoveNodeByKey(reference, newKey, 0));
+                break;
+        }
+        if (cnt%500 == 0)
+            CheckUnrolledList(ulist);
+    }
+    CheckUnrolledList(ulist);
+    assert(ulist->size == reference->size);
+    for (position = 0; position<ulist->size; position++)
+        assert(RICK45BLISTS_GetKeyByPositionUnrolled(ulist, position) == RICK45BLISTS_GetKeyByPosition(reference, position));
+
+    /*search, set, iterator and forEach*/
+    key = RICK45BLISTS_GetKeyByPositionUnrolled(ulist, ulist->size/2);
+    assert(*(double *)RICK45BLISTS_GetKeyByKeyUnrolled(ulist, key) == *(double *)key);
+    assert(RICK45BLISTS_SetKeyByPositionUnrolled(ulist, &sum, ulist->size/2) == key);
+    assert(RICK45BLISTS_GetKeyByPositionUnrolled(ulist, ulist->size/2) == &sum);
+    RICK45BLISTS_SetKeyByPositionUnrolled(ulist, key, ulist->size/2);
+    RICK45BLISTS_UnrolledIteratorInit(&it, ulist);
+    position = 0;
+    while (RICK45BLISTS_UnrolledIteratorHasNext(&it))
+    {
+        key = RICK45BLISTS_UnrolledIteratorNext(&it);
+        assert(key == RICK45BLISTS_GetKeyByPosition(reference, position));
+        expected += *(double *)key;
+        position++;
+    }
+    assert(position == ulist->size && RICK45BLISTS_UnrolledIteratorNext(&it)==NULL);
+    assert(RICK45BLISTS_UnrolledListforEach(ulist, SumKeys, &sum)==0 && sum == expected);
+    assert(RICK45BLISTS_UnrolledListforEach(ulist, NULL, &sum)==-1);
+
+    /*removing everything, then destroying a list with heap-allocated keys*/
+    while (ulist->size > 0)
+        assert(RICK45BLISTS_RemoveKeyUnrolled(ulist, ulist->size/3, 0)==0);
+    assert(ulist->head == NULL && ulist->tail == NULL);
+    for (cnt = 0; cnt<100; cnt++)
+    {
+        double *heapKey = malloc(sizeof(double));
+        *heapKey = (double)cnt;
+        assert(RICK45BLISTS_AddUnrolledListKey(heapKey, ulist, cnt/2)==0);
+    }
+    assert(RICK45BLISTS_RemoveKeyByKeyUnrolled(ulist, &array_keys[10], 1)==1);
+    assert(RICK45BLISTS_RemoveKeyUnrolled(ulist, 0, 1)==0);
+    CheckUnrolledList(ulist);
+    RICK45BLISTS_UnrolledListDestroy(&ulist, 1);
+    assert(ulist == NULL);
+    RICK45BLISTS_ListDestroy(&reference, 0);
+}
+
+int IsOdd(const void *key, void *opt)
+{
+    (void)opt;
+    return (long)*(const double *)key % 2 != 0;
+}
+
+int IsGreater(const void *key, void *opt)
+{
+    return *(const double *)key > *(double *)opt;
+}
+
+void removeIfListTEST()
+{
+    double array_keys[] = {0, 1, 2, 3};
+    double threshold = 1;
+    list_t list = RICK45BLISTS_ListCreate(RICK45B_DoubleCMP);
+    doubleList_t dlist = RICK45BLISTS_DoubleListCreate(RICK45B_DoubleCMP);
+    size_t cnt;
+    listNode_t node;
+    doubleListNode_t dnode;
+
+    assert(RICK45BLISTS_RemoveIf(NULL, IsOdd, NULL, 0)==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_NULL_ADT);
+    assert(RICK45BLISTS_RemoveIf(list, NULL, NULL, 0)==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_INVALID_ARGUMENT);
+    assert(RICK45BLISTS_RemoveIfDouble(NULL, IsOdd, NULL, 0)==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_NULL_ADT);
+    assert(RICK45BLISTS_RemoveIfDouble(dlist, NULL, NULL, 0)==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_INVALID_ARGUMENT);
+    assert(RICK45BLISTS_RemoveIf(list, IsOdd, NULL, 0)==0 && RICK45BLISTS_RemoveAllNodesByKey(list, &array_keys[0], 0)==0);
+
+    /*half of a long list matches: a single pass removes all of it*/
+    for (cnt = 0; cnt<100000; cnt++)
+    {
+        RICK45BLISTS_TailAddListNode(&array_keys[cnt%4], list);
+        RICK45BLISTS_TailAddDoubleListNode(&array_keys[cnt%4], dlist);
+    }
+    assert(RICK45BLISTS_RemoveIf(list, IsOdd, NULL, 0)==50000);
+    assert(RICK45BLISTS_RemoveIfDouble(dlist, IsOdd, NULL, 0)==50000);
+    CheckListLinks(list);
+    CheckDoubleListLinks(dlist);
+    for (node = list->head; node != NULL; node = node->next)
+        assert(!IsOdd(node->key, NULL));
+    assert(RICK45BLISTS_RemoveAllNodesByKey(list, &array_keys[2], 0)==25000);
+    assert(RICK45BLISTS_RemoveAllNodesByKeyDouble(dlist, &array_keys[0], 0)==25000);
+    CheckListLinks(list);
+    CheckDoubleListLinks(dlist);
+    for (dnode = dlist->head; dnode != NULL; dnode = dnode->next)
+        assert(*(double *)dnode->key == 2);
+    assert(RICK45BLISTS_RemoveAllNodesByKey(list, &array_keys[2], 0)==0 && RICK45BLISTS_GetListSize(list)==25000);
+    RICK45BLISTS_RemoveAllNodes(list, 0);
+    RICK45BLISTS_DoubleListRemoveAllNodes(dlist, 0);
+
+    /*matches at both ends, with the predicate's optional argument and heap-allocated keys*/
+    for (cnt = 0; cnt<6; cnt++)
+    {
+        double *key = malloc(sizeof(double));
+        *key = (double)(cnt%3 == 1 ? 0 : 5);    /*5 -> 0 -> 5 -> 5 -> 0 -> 5*/
+        RICK45BLISTS_TailAddListNode(key, list);
+        key = malloc(sizeof(double));
+        *key = (double)(cnt%3 == 1 ? 0 : 5);
+        RICK45BLISTS_TailAddDoubleListNode(key, dlist);
+    }
+    list->pointedNode = list->head;
+    assert(RICK45BLISTS_RemoveIf(list, IsGreater, &threshold, 1)==4);
+    assert(RICK45BLISTS_RemoveIfDouble(dlist, IsGreater, &threshold, 1)==4);
+    CheckListLinks(list);
+    CheckDoubleListLinks(dlist);
+    assert(list->size == 2 && *(double *)list->head->key == 0 && *(double *)list->tail->key == 0);
+    assert(list->pointedNode == list->head);
+    assert(dlist->size == 2 && *(double *)dlist->head->key == 0 && *(double *)dlist->tail->key == 0);
+
+    RICK45BLISTS_ListDestroy(&list, 1);
+    RICK45BLISTS_DoubleListDestroy(&dlist, 1);
+}
+
+/*checks that the keys of the list are sorted, and that equal keys (stored in an array) kept their order.*/
+void CheckSortedList(list_t list)
+{
+    listNode_t node;
+    for (node = list->head; node != NULL && node->next != NULL; node = node->next)
+    {
+        double *key = node->key, *next = node->next->key;
+        assert(*key < *next || (*key == *next && key < next));
+    }
+}
+
+void CheckSortedDoubleList(doubleList_t dlist)
+{
+    doubleListNode_t node;
+    for (node = dlist->head; node != NULL && node->next != NULL; node = node->next)
+    {
+        double *key = node->key, *next = node->next->key;
+        assert(*key < *next || (*key == *next && key < next));
+    }
+}
+
+void sortListTEST()
+{
+    static double array_keys[20000];
+    list_t list = RICK45BLISTS_ListCreate(RICK45B_DoubleCMP);
+    list_t indexed = RICK45BLISTS_IndexedListCreate(RICK45B_DoubleCMP);
+    doubleList_t dlist = RICK45BLISTS_DoubleListCreate(RICK45B_DoubleCMP);
+    size_t cnt, size;
+
+    assert(RICK45BLISTS_ListSort(NULL)==-1 && RICK45BLISTS_DoubleListSort(NULL)==-1);
+    assert(RICK45BLISTS_InsertSorted(NULL, list)==-1 && RICK45BLISTS_InsertSortedDouble(NULL, dlist)==-1);
+    assert(RICK45BLISTS_ListSort(list)==0 && RICK45BLISTS_DoubleListSort(dlist)==0);
+    srand(45);
+    for (cnt = 0; cnt<20000; cnt++)
+        array_keys[cnt] = (double)(rand()%500);   /*plenty of equal keys*/
+
+    /*sizes around the powers of two, with the keys added in their array order*/
+    for (size = 1; size<=20000; size = size<64 ? size+1 : size*3)
+    {
+        listNode_t node;
+        for (cnt = 0; cnt<size; cnt++)
+        {
+            RICK45BLISTS_HeadAddListNode(&array_keys[size-1-cnt], list);
+            RICK45BLISTS_TailAddDoubleListNode(&array_keys[cnt], dlist);
+        }
+        assert(RICK45BLISTS_ListSort(list)==0 && RICK45BLISTS_DoubleListSort(dlist)==0);
+        CheckListLinks(list);
+        CheckDoubleListLinks(dlist);
+        CheckSortedList(list);
+        CheckSortedDoubleList(dlist);
+        for (node = list->head; node->next != NULL; node = node->next);
+        assert(node == list->tail);
+        RICK45BLISTS_RemoveAllNodes(list, 0);
+        RICK45BLISTS_DoubleListRemoveAllNodes(dlist, 0);
+    }
+
+    /*the nodes are relinked, not reallocated*/
+    int live = 0;
+    struct allocator counting = {CountingAlloc, CountingFree, &live};
+    list_t counted = RICK45BLISTS_ListCreateWithAllocator(RICK45B_DoubleCMP, &counting);
+    doubleList_t dcounted = RICK45BLISTS_DoubleListCreateWithAllocator(RICK45B_DoubleCMP, &counting);
+    for (cnt = 0; cnt<1000; cnt++)
+    {
+        RICK45BLISTS_TailAddListNode(&array_keys[cnt], counted);
+        RICK45BLISTS_TailAddDoubleListNode(&array_keys[cnt], dcounted);
+    }
+    assert(live == 2002);
+    RICK45BLISTS_ListSort(counted);
+    RICK45BLISTS_DoubleListSort(dcounted);
+    assert(live == 2002);
+    CheckSortedList(counted);
+    CheckSortedDoubleList(dcounted);
+    RICK45BLISTS_ListDestroy(&counted, 0);
+    RICK45BLISTS_DoubleListDestroy(&dcounted, 0);
+    assert(live == 0);
+
+    /*an indexed list is still usable by position after a sort*/
+    for (cnt = 0; cnt<1000; cnt++)
+        RICK45BLISTS_TailAddListNode(&array_keys[cnt], indexed);
+    RICK45BLISTS_ListSort(indexed);
+    CheckSortedList(indexed);
+    for (cnt = 1; cnt<1000; cnt++)
+        assert(*(double *)RICK45BLISTS_GetKeyByPosition(indexed, cnt-1) <= *(double *)RICK45BLISTS_GetKeyByPosition(indexed, cnt));
+    CheckSkipIndex(indexed);
+
+    /*keeping the lists sorted one key at a time*/
+    for (cnt = 0; cnt<3000; cnt++)
+    {
+        assert(RICK45BLISTS_InsertSorted(&array_keys[cnt], list)==0);
+        assert(RICK45BLISTS_InsertSortedDouble(&array_keys[cnt], dlist)==0);
+        assert(RICK45BLISTS_InsertSorted(&array_keys[cnt], indexed)==0);
+    }
+    CheckListLinks(list);
+    CheckDoubleListLinks(dlist);
+    CheckSortedList(list);
+    CheckSortedDoubleList(dlist);
+    assert(RICK45BLISTS_GetListSize(indexed)==4000 && *(double *)RICK45BLISTS_GetKeyByPosition(indexed, 3999) == 499);
+    CheckSkipIndex(indexed);
+
+    RICK45BLISTS_ListDestroy(&list, 0);
+    RICK45BLISTS_ListDestroy(&indexed, 0);
+    RICK45BLISTS_DoubleListDestroy(&dlist, 0);
+}
+
+/*checks that the list holds the keys array_keys[from], array_keys[from+1], ... array_keys[to-1].*/
+void CheckListRange(list_t list, double *array_keys, size_t from, size_t to)
+{
+    listNode_t temp = list->head;
+    CheckListLinks(list);
+    assert(list->size == to-from);
+    for (; from<to; from++, temp = temp->next)
+        assert(temp->key == &array_keys[from]);
+}
+
+void CheckDoubleListRange(doubleList_t dlist, double *array_keys, size_t from, size_t to)
+{
+    doubleListNode_t temp = dlist->head;
+    CheckDoubleListLinks(dlist);
+    assert(dlist->size == to-from);
+    for (; from<to; from++, temp = temp->next)
+        assert(temp->key == &array_keys[from]);
+}
+
+void spliceListTEST()
+{
+    double array_keys[100];
+    int live = 0;
+    struct allocator counting = {CountingAlloc, CountingFree, &live};
+    list_t list = RICK45BLISTS_ListCreateWithAllocator(RICK45B_DoubleCMP, &counting);
+    list_t other = RICK45BLISTS_ListCreateWithAllocator(RICK45B_DoubleCMP, &counting);
+    list_t plain = RICK45BLISTS_ListCreate(RICK45B_DoubleCMP);
+    doubleList_t dlist = RICK45BLISTS_DoubleListCreateWithAllocator(RICK45B_DoubleCMP, &counting);
+    doubleList_t dother = RICK45BLISTS_DoubleListCreateWithAllocator(RICK45B_DoubleCMP, &counting);
+    size_t cnt, split;
+    for (cnt = 0; cnt<100; cnt++)
+        array_keys[cnt] = (double)cnt;
+
+    /*errors*/
+    assert(RICK45BLISTS_Concat(NULL, list)==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_NULL_ADT);
+    assert(RICK45BLISTS_Concat(list, list)==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_INVALID_ARGUMENT);
+    assert(RICK45BLISTS_Concat(list, plain)==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_INVALID_ARGUMENT);
+    assert(RICK45BLISTS_SpliceAfter(list, NULL, other, NULL, NULL)==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_INVALID_ARGUMENT);
+    assert(RICK45BLISTS_SplitAfter(NULL, NULL)==NULL && RICK45B_LastErrorCode()==RICK45B_ERR_NULL_ADT);
+    assert(RICK45BLISTS_ConcatDouble(dlist, NULL)==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_NULL_ADT);
+    assert(RICK45BLISTS_ConcatDouble(dlist, dlist)==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_INVALID_ARGUMENT);
+    assert(RICK45BLISTS_SplitAfterDouble(NULL, NULL)==NULL && RICK45B_LastErrorCode()==RICK45B_ERR_NULL_ADT);
+    assert(RICK45BLISTS_Concat(list, other)==0 && RICK45BLISTS_GetListSize(list)==0);
+
+    /*concatenating moves the nodes in one step: no allocation, and the source becomes empty*/
+    for (cnt = 0; cnt<100; cnt++)
+    {
+        RICK45BLISTS_TailAddListNode(&array_keys[cnt], cnt<60 ? list : other);
+        RICK45BLISTS_TailAddDoubleListNode(&array_keys[cnt], cnt<60 ? dlist : dother);
+    }
+    live = 0;
+    assert(RICK45BLISTS_Concat(list, other)==0 && RICK45BLISTS_ConcatDouble(dlist, dother)==0 && live == 0);
+    CheckListRange(list, array_keys, 0, 100);
+    CheckDoubleListRange(dlist, array_keys, 0, 100);
+    assert(RICK45BLISTS_GetListSize(other)==0 && other->head == NULL && other->tail == NULL);
+    assert(RICK45BLISTS_GetDoubleListSize(dother)==0 && dother->head == NULL && dother->tail == NULL);
+    assert(RICK45BLISTS_RemoveTail(list, 0)==0 && RICK45BLISTS_RemoveTailDouble(dlist, 0)==0);
+    assert(RICK45BLISTS_TailAddListNode(&array_keys[99], list)==0 && RICK45BLISTS_TailAddDoubleListNode(&array_keys[99], dlist)==0);
+    live = 0;
+
+    /*splitting at every position, then joining the parts back*/
+    for (split = 0; split<=100; split++)
+    {
+        listNode_t node = split>0 ? RICK45BLISTS_GetNodeByPosition(list, split-1) : NULL;
+        doubleListNode_t dnode = split>0 ? RICK45BLISTS_GetNodeByPositionDouble(dlist, split-1) : NULL;
+        list_t tail = RICK45BLISTS_SplitAfter(list, node);
+        doubleList_t dtail = RICK45BLISTS_SplitAfterDouble(dlist, dnode);
+        assert(tail != NULL && dtail != NULL && live == 2);
+        CheckListRange(list, array_keys, 0, split);
+        CheckListRange(tail, array_keys, split, 100);
+        CheckDoubleListRange(dlist, array_keys, 0, split);
+        CheckDoubleListRange(dtail, array_keys, split, 100);
+        assert(RICK45BLISTS_Concat(list, tail)==0 && RICK45BLISTS_ConcatDouble(dlist, dtail)==0);
+        RICK45BLISTS_ListDestroy(&tail, 0);
+        RICK45BLISTS_DoubleListDestroy(&dtail, 0);
+        assert(live == 0);
+    }
+    CheckListRange(list, array_keys, 0, 100);
+    CheckDoubleListRange(dlist, array_keys, 0, 100);
+
+    /*moving a range [10, 19] to the front of another list and back in the middle*/
+    RICK45BLISTS_TailAddListNode(&array_keys[0], other);
+    RICK45BLISTS_TailAddDoubleListNode(&array_keys[0], dother);
+    assert(RICK45BLISTS_SpliceAfter(other, NULL, list, RICK45BLISTS_GetNodeByPosition(list, 9), RICK45BLISTS_GetNodeByPosition(list, 19))==0);
+    assert(RICK45BLISTS_SpliceAfterDouble(dother, NULL, dlist, RICK45BLISTS_GetNodeByPositionDouble(dlist, 10), RICK45BLISTS_GetNodeByPositionDouble(dlist, 19))==0);
+    CheckListLinks(list);
+    CheckListLinks(other);
+    CheckDoubleListLinks(dlist);
+    CheckDoubleListLinks(dother);
+    assert(RICK45BLISTS_GetListSize(list)==90 && RICK45BLISTS_GetListSize(other)==11);
+    assert(RICK45BLISTS_GetDoubleListSize(dlist)==90 && RICK45BLISTS_GetDoubleListSize(dother)==11);
+    assert(*(double *)RICK45BLISTS_GetKeyByPosition(list, 10)==20 && *(double *)RICK45BLISTS_GetKeyByPosition(other, 0)==10 && *(double *)RICK45BLISTS_GetKeyByPosition(other, 10)==0);
+    assert(*(double *)RICK45BLISTS_GetKeyByPositionDouble(dlist, 10)==20 && *(double *)RICK45BLISTS_GetKeyByPositionDouble(dother, 0)==10);
+    assert(RICK45BLISTS_SpliceAfter(list, RICK45BLISTS_GetNodeByPosition(list, 9), other, NULL, RICK45BLISTS_GetNodeByPosition(other, 9))==0);
+    assert(RICK45BLISTS_SpliceAfterDouble(dlist, RICK45BLISTS_GetNodeByPositionDouble(dlist, 9), dother, dother->head, RICK45BLISTS_GetNodeByPositionDouble(dother, 9))==0);
+    CheckListRange(list, array_keys, 0, 100);
+    CheckListRange(other, array_keys, 0, 1);
+    CheckDoubleListRange(dlist, array_keys, 0, 100);
+    CheckDoubleListRange(dother, array_keys, 0, 1);
+
+    /*moving the tail, and a range that isn't in the source*/
+    assert(RICK45BLISTS_SpliceAfter(other, other->tail, list, RICK45BLISTS_GetNodeByPosition(list, 97), list->tail)==0);
+    assert(RICK45BLISTS_SpliceAfterDouble(dother, dother->tail, dlist, RICK45BLISTS_GetNodeByPositionDouble(dlist, 98), dlist->tail)==0);
+    CheckListLinks(list);
+    CheckListLinks(other);
+    CheckDoubleListLinks(dlist);
+    CheckDoubleListLinks(dother);
+    assert(*(double *)RICK45BLISTS_GetKeyByPosition(list, 97)==97 && *(double *)RICK45BLISTS_GetKeyByPosition(other, 2)==99);
+    assert(RICK45BLISTS_RemoveTail(list, 0)==0 && RICK45BLISTS_RemoveTail(other, 0)==0);
+    assert(RICK45BLISTS_SpliceAfter(other, NULL, list, RICK45BLISTS_GetNodeByPosition(list, 9), list->head)==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_INVALID_ARGUMENT);
+    assert(RICK45BLISTS_SpliceAfterDouble(dother, NULL, dlist, dlist->tail, dlist->head)==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_INVALID_ARGUMENT);
+    CheckListLinks(list);
+    CheckDoubleListLinks(dlist);
+
+    /*an indexed list keeps working by position after being split and joined*/
+    list_t indexed = RICK45BLISTS_IndexedListCreate(RICK45B_DoubleCMP);
+    for (cnt = 0; cnt<100; cnt++)
+        RICK45BLISTS_TailAddListNode(&array_keys[cnt], indexed);
+    list_t second = RICK45BLISTS_SplitAfter(indexed, RICK45BLISTS_GetNodeByPosition(indexed, 49));
+    assert(second != NULL && second->index != NULL);
+    assert(*(double *)RICK45BLISTS_GetKeyByPosition(second, 10)==60 && *(double *)RICK45BLISTS_GetKeyByPosition(indexed, 49)==49);
+    CheckSkipIndex(second);
+    CheckSkipIndex(indexed);
+    assert(RICK45BLISTS_Concat(second, indexed)==0);
+    assert(*(double *)RICK45BLISTS_GetKeyByPosition(second, 50)==0 && *(double *)RICK45BLISTS_GetKeyByPosition(second, 99)==49);
+    CheckSkipIndex(second);
+    CheckListLinks(second);
+
+    /*a list using a node pool shares it with the lists taking its nodes, but can't mix them with other nodes*/
+    RICK45BLISTS_ListUseNodePool(plain, 0);
+    for (cnt = 0; cnt<10; cnt++)
+        RICK45BLISTS_TailAddListNode(&array_keys[cnt], plain);
+    list_t half = RICK45BLISTS_SplitAfter(plain, RICK45BLISTS_GetNodeByPosition(plain, 4));
+    assert(half != NULL && half->pool == plain->pool && plain->pool->refs == 2 && RICK45BLISTS_GetListSize(half)==5);
+    assert(RICK45BLISTS_GetListSize(list)>0 && list->pool == NULL);
+    assert(RICK45BLISTS_Concat(list, half)==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_INVALID_ARGUMENT);
+    assert(RICK45BLISTS_Concat(half, plain)==0 && RICK45BLISTS_GetListSize(half)==10);
+    RICK45BLISTS_ListDestroy(&plain, 0);
+    assert(half->pool->refs == 1 && *(double *)RICK45BLISTS_GetKeyByPosition(half, 9)==4);
+    CheckListLinks(half);
+    RICK45BLISTS_ListDestroy(&half, 0);
+
+    /*a splice failing on its arguments shares no pool*/
+    list_t pooled[2];
+    doubleList_t dpooled[2];
+    for (cnt = 0; cnt<2; cnt++)
+    {
+        pooled[cnt] = RICK45BLISTS_ListCreate(RICK45B_DoubleCMP);
+        dpooled[cnt] = RICK45BLISTS_DoubleListCreate(RICK45B_DoubleCMP);
+        RICK45BLISTS_ListUseNodePool(pooled[cnt], 0);
+        RICK45BLISTS_DoubleListUseNodePool(dpooled[cnt], 0);
+    }
+    for (cnt = 0; cnt<5; cnt++)
+    {
+        RICK45BLISTS_TailAddListNode(&array_keys[cnt], pooled[1]);
+        RICK45BLISTS_TailAddDoubleListNode(&array_keys[cnt], dpooled[1]);
+    }
+    plain = RICK45BLISTS_ListCreate(RICK45B_DoubleCMP);
+    doubleList_t dplain = RICK45BLISTS_DoubleListCreate(RICK45B_DoubleCMP);
+    assert(RICK45BLISTS_SpliceAfter(pooled[0], NULL, pooled[1], pooled[1]->tail, pooled[1]->tail)==-1);
+    assert(RICK45BLISTS_SpliceAfter(plain, NULL, pooled[1], pooled[1]->head, pooled[1]->head)==-1);
+    assert(RICK45BLISTS_SpliceAfterDouble(dpooled[0], NULL, dpooled[1], NULL, dpooled[1]->tail)==-1);
+    assert(RICK45BLISTS_SpliceAfterDouble(dplain, NULL, dpooled[1], dpooled[1]->tail, dpooled[1]->head)==-1);
+    assert(pooled[0]->pool->refs == 1 && pooled[1]->pool->refs == 1 && plain->pool == NULL);
+    assert(dpooled[0]->pool->refs == 1 && dpooled[1]->pool->refs == 1 && dplain->pool == NULL);
+    assert(RICK45BLISTS_SpliceAfter(plain, NULL, pooled[1], NULL, pooled[1]->head)==0 && plain->pool == pooled[1]->pool);
+    assert(RICK45BLISTS_SpliceAfterDouble(dplain, NULL, dpooled[1], dpooled[1]->head, dpooled[1]->head)==0 && dplain->pool == dpooled[1]->pool);
+    for (cnt = 0; cnt<2; cnt++)
+    {
+        RICK45BLISTS_ListDestroy(&pooled[cnt], 0);
+        RICK45BLISTS_DoubleListDestroy(&dpooled[cnt], 0);
+    }
+    assert(RICK45BLISTS_GetListSize(plain)==1 && RICK45BLISTS_GetDoubleListSize(dplain)==1);
+    RICK45BLISTS_DoubleListDestroy(&dplain, 0);
+
+    RICK45BLISTS_ListDestroy(&indexed, 0);
+    RICK45BLISTS_ListDestroy(&second, 0);
+    RICK45BLISTS_ListDestroy(&plain, 0);
+    RICK45BLISTS_ListDestroy(&list, 0);
+    RICK45BLISTS_ListDestroy(&other, 0);
+    RICK45BLISTS_DoubleListDestroy(&dlist, 0);
+    RICK45BLISTS_DoubleListDestroy(&dother, 0);
+}
+
+void fromArrayListTEST()
+{
+    double array_keys[1000];
+    void *keys[1000];
+    int live = 0;
+    struct allocator counting = {CountingAlloc, CountingFree, &live};
+    size_t cnt;
+    for (cnt = 0; cnt<1000; cnt++)
+    {
+        array_keys[cnt] = (double)cnt;
+        keys[cnt] = &array_keys[cnt];
+    }
+
+    /*errors and empty lists*/
+    assert(RICK45BLISTS_ListFromArray(NULL, 3, RICK45B_DoubleCMP, NULL)==NULL && RICK45B_LastErrorCode()==RICK45B_ERR_INVALID_ARGUMENT);
+    assert(RICK45BLISTS_DoubleListFromArray(keys, 3, NULL, NULL)==NULL && RICK45B_LastErrorCode()==RICK45B_ERR_INVALID_ARGUMENT);
+    keys[500] = NULL;
+    assert(RICK45BLISTS_ListFromArray(keys, 1000, RICK45B_DoubleCMP, &counting)==NULL && RICK45B_LastErrorCode()==RICK45B_ERR_INVALID_ARGUMENT);
+    assert(RICK45BLISTS_DoubleListFromArray(keys, 1000, RICK45B_DoubleCMP, &counting)==NULL && live == 0);
+    keys[500] = &array_keys[500];
+    list_t list = RICK45BLISTS_ListFromArray(NULL, 0, RICK45B_DoubleCMP, &counting);
+    doubleList_t dlist = RICK45BLISTS_DoubleListFromArray(keys, 0, RICK45B_DoubleCMP, &counting);
+    assert(list != NULL && dlist != NULL && list->size == 0 && dlist->size == 0 && live == 2);
+    RICK45BLISTS_ListDestroy(&list, 0);
+    RICK45BLISTS_DoubleListDestroy(&dlist, 0);
+    assert(live == 0);
+
+    /*the list, its pool and one block of nodes, linked in memory order*/
+    list = RICK45BLISTS_ListFromArray(keys, 1000, RICK45B_DoubleCMP, &counting);
+    assert(list != NULL && live == 3);
+    dlist = RICK45BLISTS_DoubleListFromArray(keys, 1000, RICK45B_DoubleCMP, &counting);
+    assert(dlist != NULL && live == 6);
+    CheckListRange(list, array_keys, 0, 1000);
+    CheckDoubleListRange(dlist, array_keys, 0, 1000);
+    listNode_t node;
+    doubleListNode_t dnode;
+    for (node = list->head; node->next != NULL; node = node->next)
+        assert((char *)node->next == (char *)node+list->pool->nodeSize);
+    for (dnode = dlist->head; dnode->next != NULL; dnode = dnode->next)
+        assert((char *)dnode->next == (char *)dnode+dlist->pool->nodeSize);
+
+    /*removed nodes go back to the pool and are reused, later nodes come in small chunks*/
+    for (cnt = 0; cnt<500; cnt++)
+    {
+        assert(RICK45BLISTS_RemoveHead(list, 0)==0 && RICK45BLISTS_RemoveTail(list, 0)==0);
+        assert(RICK45BLISTS_DoubleListRemoveHead(dlist, 0)==0 && RICK45BLISTS_RemoveNodeDouble(dlist, dlist->size/2, 0)==0);
+    }
+    assert(list->size == 0 && dlist->size == 0 && live == 6);
+    for (cnt = 0; cnt<1000+RICK45B_POOL_DEFAULT_CHUNK; cnt++)
+    {
+        assert(RICK45BLISTS_TailAddListNode(keys[cnt%1000], list)==0);
+        assert(RICK45BLISTS_HeadAddDoubleListNode(keys[cnt%1000], dlist)==0);
+    }
+    assert(live == 8);
+    CheckListLinks(list);
+    CheckDoubleListLinks(dlist);
+    RICK45BLISTS_ListDestroy(&list, 0);
+    RICK45BLISTS_DoubleListDestroy(&dlist, 0);
+    assert(live == 0);
+
+    /*lists built from arrays can give their nodes to each other: the blocks move, the nodes don't, and the emptied pools go*/
+    list_t parts[3];
+    doubleList_t dparts[3];
+    for (cnt = 0; cnt<3; cnt++)
+    {
+        parts[cnt] = RICK45BLISTS_ListFromArray(keys+cnt*100, 100, RICK45B_DoubleCMP, &counting);
+        dparts[cnt] = RICK45BLISTS_DoubleListFromArray(keys+cnt*100, 100, RICK45B_DoubleCMP, &counting);
+    }
+    assert(live == 18);
+    node = parts[1]->head;
+    assert(RICK45BLISTS_Concat(parts[0], parts[1])==0 && RICK45BLISTS_ConcatDouble(dparts[0], dparts[1])==0);
+    assert(live == 16 && parts[0]->pool == parts[1]->pool && RICK45BLISTS_GetNodeByPosition(parts[0], 100) == node);
+    CheckListRange(parts[0], array_keys, 0, 200);
+    CheckDoubleListRange(dparts[0], array_keys, 0, 200);
+    list = RICK45BLISTS_ListCreateWithAllocator(RICK45B_DoubleCMP, &counting);
+    dlist = RICK45BLISTS_DoubleListCreateWithAllocator(RICK45B_DoubleCMP, &counting);
+    list_t srcs[2];
+    doubleList_t dsrcs[2];
+    srcs[0] = parts[2]; srcs[1] = parts[0];
+    dsrcs[0] = dparts[2]; dsrcs[1] = dparts[0];
+    assert(RICK45BLISTS_SortedMerge(list, srcs, 2)==0 && RICK45BLISTS_SortedMergeDouble(dlist, dsrcs, 2)==0);
+    CheckListRange(list, array_keys, 0, 300);
+    CheckDoubleListRange(dlist, array_keys, 0, 300);
+    list_t tail = RICK45BLISTS_SplitAfter(list, RICK45BLISTS_GetNodeByPosition(list, 149));
+    assert(tail->pool == list->pool && RICK45BLISTS_GetListSize(tail)==150);
+    assert(RICK45BLISTS_SpliceAfter(parts[1], NULL, tail, NULL, tail->tail)==0 && RICK45BLISTS_GetListSize(parts[1])==150);
+    for (cnt = 0; cnt<3; cnt++)
+    {
+        RICK45BLISTS_ListDestroy(&parts[cnt], 0);
+        RICK45BLISTS_DoubleListDestroy(&dparts[cnt], 0);
+    }
+    RICK45BLISTS_ListDestroy(&tail, 0);
+    CheckListRange(list, array_keys, 0, 150);
+    assert(RICK45BLISTS_RemoveHead(list, 0)==0 && RICK45BLISTS_TailAddListNode(keys[0], list)==0);
+    RICK45BLISTS_ListDestroy(&list, 0);
+    RICK45BLISTS_DoubleListDestroy(&dlist, 0);
+    assert(live == 0);
+}
+
+void toArrayListTEST()
+{
+    double array_keys[1000];
+    void *keys[1000];
+    void *array[1000];
+    void **copy;
+    size_t cnt;
+    for (cnt = 0; cnt<1000; cnt++)
+    {
+        array_keys[cnt] = (double)cnt;
+        keys[cnt] = &array_keys[cnt];
+    }
+    list_t list = RICK45BLISTS_ListCreate(RICK45B_DoubleCMP);
+    doubleList_t dlist = RICK45BLISTS_DoubleListCreate(RICK45B_DoubleCMP);
+
+    /*errors and empty lists*/
+    assert(RICK45BLISTS_ListToArray(NULL, array, 0)==NULL && RICK45B_LastErrorCode()==RICK45B_ERR_NULL_ADT);
+    assert(RICK45BLISTS_DoubleListToArray(NULL, array, 0)==NULL && RICK45B_LastErrorCode()==RICK45B_ERR_NULL_ADT);
+    assert(RICK45BLISTS_ListToArray(list, array, 1)==array && RICK45BLISTS_DoubleListToArray(dlist, array, 1)==array);
+    copy = RICK45BLISTS_ListToArray(list, NULL, 0);
+    assert(copy != NULL);
+    free(copy);
+
+    /*round trip through an array, in both directions*/
+    RICK45BLISTS_ListDestroy(&list, 0);
+    RICK45BLISTS_DoubleListDestroy(&dlist, 0);
+    list = RICK45BLISTS_ListFromArray(keys, 1000, RICK45B_DoubleCMP, NULL);
+    dlist = RICK45BLISTS_DoubleListFromArray(keys, 1000, RICK45B_DoubleCMP, NULL);
+    assert(RICK45BLISTS_ListToArray(list, array, 0)==array);
+    for (cnt = 0; cnt<1000; cnt++)
+        assert(array[cnt] == keys[cnt]);
+    assert(RICK45BLISTS_DoubleListToArray(dlist, array, 1)==array);
+    for (cnt = 0; cnt<1000; cnt++)
+        assert(array[cnt] == keys[999-cnt]);
+    copy = RICK45BLISTS_ListToArray(list, NULL, 1);
+    for (cnt = 0; cnt<1000; cnt++)
+        assert(copy[cnt] == keys[999-cnt]);
+    free(copy);
+    copy = RICK45BLISTS_DoubleListToArray(dlist, NULL, 0);
+    for (cnt = 0; cnt<1000; cnt++)
+        assert(copy[cnt] == keys[cnt]);
+    free(copy);
+
+    RICK45BLISTS_ListDestroy(&list, 0);
+    RICK45BLISTS_DoubleListDestroy(&dlist, 0);
+}
+
+/*doubles the key of the given node (of a list or of a double linked list: the key comes first in both), failing on 'opt'.*/
+int DoubleKey(void *elem, void *opt)
+{
+    double *key = ((listNode_t)elem)->key;
+    if (opt != NULL && *key == *(double *)opt)
+        return -1;
+    *key *= 2;
+    return 0;
+}
+
+struct halves{
+    double *in;
+    double *out;
+};
+
+void *HalveKey(void *key, void *opt)
+{
+    struct halves *h = opt;
+    size_t idx = (size_t)((double *)key-h->in);
+    if (*(double *)key < 0)
+        return NULL;
+    h->out[idx] = *(double *)key/2;
+    return &h->out[idx];
+}
+
+int AddInto(void *acc, void *elem, void *opt)
+{
+    (void)opt;
+    *(double *)acc += *(double *)elem;
+    return 0;
+}
+
+void parallelListTEST()
+{
+    static double array_keys[10000], halved[10000];
+    static void *keys[10000];
+    double acc[RICK45BLISTS_MAX_THREADS];
+    double failOn = 20;
+    struct halves h = {array_keys, halved};
+    size_t cnt, threads[] = {0, 1, 2, 3, 8, RICK45BLISTS_MAX_THREADS}, t;
+    for (cnt = 0; cnt<10000; cnt++)
+    {
+        array_keys[cnt] = (double)cnt;
+        keys[cnt] = &array_keys[cnt];
+    }
+    list_t list = RICK45BLISTS_ListFromArray(keys, 10000, RICK45B_DoubleCMP, NULL);
+    doubleList_t dlist = RICK45BLISTS_DoubleListFromArray(keys, 10000, RICK45B_DoubleCMP, NULL);
+    list_t empty = RICK45BLISTS_ListCreate(RICK45B_DoubleCMP);
+
+    /*errors*/
+    assert(RICK45BLISTS_ListforEach(NULL, DoubleKey, NULL)==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_NULL_ADT);
+    assert(RICK45BLISTS_DoubleListforEach(dlist, NULL, NULL)==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_INVALID_ARGUMENT);
+    assert(RICK45BLISTS_ListParallelforEach(NULL, DoubleKey, NULL, 2)==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_NULL_ADT);
+    assert(RICK45BLISTS_ListParallelforEach(list, DoubleKey, NULL, RICK45BLISTS_MAX_THREADS+1)==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_INVALID_ARGUMENT);
+    assert(RICK45BLISTS_DoubleListParallelMap(NULL, HalveKey, &h, 2)==NULL && RICK45B_LastErrorCode()==RICK45B_ERR_NULL_ADT);
+    assert(RICK45BLISTS_ListParallelReduce(list, AddInto, NULL, acc, sizeof(double), NULL, 2)==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_INVALID_ARGUMENT);
+    assert(RICK45BLISTS_ListforEach(empty, DoubleKey, NULL)==0 && RICK45BLISTS_ListParallelforEach(empty, DoubleKey, NULL, 4)==0);
+
+    /*every key is visited exactly once, whatever the number of threads*/
+    assert(RICK45BLISTS_ListforEach(list, DoubleKey, NULL)==0 && RICK45BLISTS_DoubleListforEach(dlist, DoubleKey, NULL)==0);
+    for (t = 0; t<sizeof(threads)/sizeof(threads[0]); t++)
+    {
+        assert(RICK45BLISTS_ListParallelforEach(list, DoubleKey, NULL, threads[t])==0);
+        assert(RICK45BLISTS_DoubleListParallelforEach(dlist, DoubleKey, NULL, threads[t])==0);
+    }
+    for (cnt = 0; cnt<10000; cnt++)
+        assert(array_keys[cnt] == (double)cnt*(1<<14));
+    for (cnt = 0; cnt<10000; cnt++)
+        array_keys[cnt] = (double)cnt;
+
+    /*a failing call is reported, and stops its own chunk*/
+    assert(RICK45BLISTS_ListforEach(list, DoubleKey, &failOn)==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_CALLBACK);
+    assert(array_keys[19] == 38 && array_keys[20] == 20 && array_keys[21] == 21);
+    assert(RICK45BLISTS_DoubleListParallelforEach(dlist, DoubleKey, &failOn, 4)==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_CALLBACK);
+    assert(array_keys[20] == 20 && array_keys[9999] == 9999*2);
+    for (cnt = 0; cnt<10000; cnt++)
+        array_keys[cnt] = (double)cnt;
+
+    /*map*/
+    for (t = 0; t<sizeof(threads)/sizeof(threads[0]); t++)
+    {
+        list_t mapped = RICK45BLISTS_ListParallelMap(list, HalveKey, &h, threads[t]);
+        doubleList_t dmapped = RICK45BLISTS_DoubleListParallelMap(dlist, HalveKey, &h, threads[t]);
+        CheckListRange(mapped, halved, 0, 10000);
+        CheckDoubleListRange(dmapped, halved, 0, 10000);
+        assert(*(double *)RICK45BLISTS_GetKeyByPosition(mapped, 9999) == 4999.5);
+        RICK45BLISTS_ListDestroy(&mapped, 0);
+        RICK45BLISTS_DoubleListDestroy(&dmapped, 0);
+    }
+    array_keys[5000] = -1;
+    assert(RICK45BLISTS_ListParallelMap(list, HalveKey, &h, 3)==NULL && RICK45B_LastErrorCode()==RICK45B_ERR_CALLBACK);
+    array_keys[5000] = 5000;
+    list_t mapped = RICK45BLISTS_ListParallelMap(empty, HalveKey, &h, 3);
+    assert(mapped != NULL && RICK45BLISTS_GetListSize(mapped)==0);
+    RICK45BLISTS_ListDestroy(&mapped, 0);
+
+    /*the outputs of several maps can be merged or concatenated: their node pools become a single one*/
+    list_t outputs[3];
+    listNode_t node;
+    mapped = RICK45BLISTS_ListCreate(RICK45B_DoubleCMP);
+    for (t = 0; t<3; t++)
+        outputs[t] = RICK45BLISTS_ListParallelMap(list, HalveKey, &h, threads[t]);
+    assert(RICK45BLISTS_SortedMerge(mapped, outputs, 3)==0 && RICK45BLISTS_GetListSize(mapped)==30000);
+    CheckListLinks(mapped);
+    for (node = mapped->head, cnt = 0; node != NULL; node = node->next, cnt++)
+        assert(node->key == &halved[cnt/3]);
+    for (t = 0; t<3; t++)
+    {
+        assert(RICK45BLISTS_GetListSize(outputs[t])==0 && outputs[t]->pool == mapped->pool);
+        RICK45BLISTS_ListDestroy(&outputs[t], 0);
+    }
+    RICK45BLISTS_ListDestroy(&mapped, 0);
+    doubleList_t dfirst = RICK45BLISTS_DoubleListParallelMap(dlist, HalveKey, &h, 2);
+    doubleList_t dsecond = RICK45BLISTS_DoubleListParallelMap(dlist, HalveKey, &h, 4);
+    assert(RICK45BLISTS_ConcatDouble(dfirst, dsecond)==0 && RICK45BLISTS_GetDoubleListSize(dfirst)==20000);
+    assert(dfirst->pool == dsecond->pool && dsecond->head == NULL);
+    CheckDoubleListLinks(dfirst);
+    assert(RICK45BLISTS_GetKeyByPositionDouble(dfirst, 10000) == &halved[0] && dfirst->tail->key == &halved[9999]);
+    RICK45BLISTS_DoubleListDestroy(&dfirst, 0);
+    RICK45BLISTS_DoubleListDestroy(&dsecond, 0);
+
+    /*reduce: the sum of the keys*/
+    for (t = 0; t<sizeof(threads)/sizeof(threads[0]); t++)
+    {
+        for (cnt = 0; cnt<RICK45BLISTS_MAX_THREADS; cnt++)
+            acc[cnt] = 0;
+        assert(RICK45BLISTS_ListParallelReduce(list, AddInto, AddInto, acc, sizeof(double), NULL, threads[t])==0);
+        assert(acc[0] == 9999.0*10000/2);
+        for (cnt = 0; cnt<RICK45BLISTS_MAX_THREADS; cnt++)
+            acc[cnt] = 0;
+        assert(RICK45BLISTS_DoubleListParallelReduce(dlist, AddInto, AddInto, acc, sizeof(double), NULL, threads[t])==0);
+        assert(acc[0] == 9999.0*10000/2);
+    }
+    acc[0] = 0;
+    assert(RICK45BLISTS_ListParallelReduce(empty, AddInto, AddInto, acc, sizeof(double), NULL, 1)==0 && acc[0] == 0);
+
+    RICK45BLISTS_ListDestroy(&list, 0);
+    RICK45BLISTS_ListDestroy(&empty, 0);
+    RICK45BLISTS_DoubleListDestroy(&dlist, 0);
+}
+
+/*checks that the keys of the list are the values v in [0, 1000) for which 'expected' is TRUE, in order.*/
+void CheckListValues(list_t list, int (*expected)(size_t v))
+{
+    listNode_t node = list->head;
+    size_t v;
+    CheckListLinks(list);
+    for (v = 0; v<1000; v++)
+        if (expected(v))
+        {
+            assert(node != NULL && *(double *)node->key == (double)v);
+            node = node->next;
+        }
+    assert(node == NULL);
+}
+
+void CheckDoubleListValues(doubleList_t dlist, int (*expected)(size_t v))
+{
+    doubleListNode_t node = dlist->head;
+    size_t v;
+    CheckDoubleListLinks(dlist);
+    for (v = 0; v<1000; v++)
+        if (expected(v))
+        {
+            assert(node != NULL && *(double *)node->key == (double)v);
+            node = node->next;
+        }
+    assert(node == NULL);
+}
+
+int InA(size_t v)  {return v%2 == 0 && v<600;}
+int InB(size_t v)  {return v%3 == 0;}
+int InUnion(size_t v)  {return InA(v) || InB(v);}
+int InIntersection(size_t v)   {return InA(v) && InB(v);}
+int InDifference(size_t v) {return InA(v) && !InB(v);}
+
+void sortedSetListTEST()
+{
+    static double array_keys[1000], rows[6][300];
+    int live = 0;
+    struct allocator counting = {CountingAlloc, CountingFree, &live};
+    list_t a = RICK45BLISTS_ListCreateWithAllocator(RICK45B_DoubleCMP, &counting);
+    list_t b = RICK45BLISTS_ListCreateWithAllocator(RICK45B_DoubleCMP, &counting);
+    list_t plain = RICK45BLISTS_ListCreate(RICK45B_DoubleCMP);
+    doubleList_t da = RICK45BLISTS_DoubleListCreateWithAllocator(RICK45B_DoubleCMP, &counting);
+    doubleList_t db = RICK45BLISTS_DoubleListCreateWithAllocator(RICK45B_DoubleCMP, &counting);
+    size_t v, row, nA = 0, nB = 0, nUnion = 0, nIntersection = 0;
+    for (v = 0; v<1000; v++)
+    {
+        array_keys[v] = (double)v;
+        nA += (size_t)InA(v);
+        nB += (size_t)InB(v);
+        nUnion += (size_t)InUnion(v);
+        nIntersection += (size_t)InIntersection(v);
+    }
+
+    /*errors*/
+    assert(RICK45BLISTS_SortedUnion(NULL, b, 0)==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_NULL_ADT);
+    assert(RICK45BLISTS_SortedUnion(a, a, 0)==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_INVALID_ARGUMENT);
+    assert(RICK45BLISTS_SortedUnion(a, plain, 0)==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_INVALID_ARGUMENT);
+    assert(RICK45BLISTS_SortedIntersection(a, a, 0)==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_INVALID_ARGUMENT);
+    assert(RICK45BLISTS_SortedDifferenceDouble(da, NULL, 0)==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_NULL_ADT);
+    assert(RICK45BLISTS_SortedDedup(NULL, 0)==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_NULL_ADT);
+    assert(RICK45BLISTS_SortedMerge(a, NULL, 2)==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_INVALID_ARGUMENT);
+    assert(RICK45BLISTS_SortedMerge(a, &plain, 1)==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_INVALID_ARGUMENT);
+    assert(RICK45BLISTS_SortedMergeDouble(da, &da, 1)==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_INVALID_ARGUMENT);
+
+    /*union: the nodes of 'b' are moved, the ones holding a key already in 'a' are released*/
+    for (v = 0; v<1000; v++)
+    {
+        if (InA(v)) {RICK45BLISTS_TailAddListNode(&array_keys[v], a); RICK45BLISTS_TailAddDoubleListNode(&array_keys[v], da);}
+        if (InB(v)) {RICK45BLISTS_TailAddListNode(&array_keys[v], b); RICK45BLISTS_TailAddDoubleListNode(&array_keys[v], db);}
+    }
+    assert(live == (int)(4+2*(nA+nB)));
+    assert(RICK45BLISTS_SortedUnion(a, b, 0)==0 && RICK45BLISTS_SortedUnionDouble(da, db, 0)==0);
+    assert(live == (int)(4+2*nUnion));
+    CheckListValues(a, InUnion);
+    CheckDoubleListValues(da, InUnion);
+    assert(RICK45BLISTS_GetListSize(b)==0 && b->head == NULL && RICK45BLISTS_GetDoubleListSize(db)==0 && db->head == NULL);
+    assert(RICK45BLISTS_RemoveTail(a, 0)==0 && RICK45BLISTS_RemoveTailDouble(da, 0)==0);
+    RICK45BLISTS_RemoveAllNodes(a, 0);
+    RICK45BLISTS_DoubleListRemoveAllNodes(da, 0);
+
+    /*intersection and difference only remove nodes from the first list*/
+    for (v = 0; v<1000; v++)
+    {
+        if (InA(v)) {RICK45BLISTS_TailAddListNode(&array_keys[v], a); RICK45BLISTS_TailAddDoubleListNode(&array_keys[v], da);}
+        if (InB(v)) {RICK45BLISTS_TailAddListNode(&array_keys[v], b); RICK45BLISTS_TailAddDoubleListNode(&array_keys[v], db);}
+    }
+    list_t a2 = RICK45BLISTS_ListCreate(RICK45B_DoubleCMP);
+    doubleList_t da2 = RICK45BLISTS_DoubleListCreate(RICK45B_DoubleCMP);
+    for (v = 0; v<1000; v++)
+        if (InA(v)) {RICK45BLISTS_TailAddListNode(&array_keys[v], a2); RICK45BLISTS_TailAddDoubleListNode(&array_keys[v], da2);}
+    assert(RICK45BLISTS_SortedIntersection(a, b, 0)==(int)(nA-nIntersection) && RICK45BLISTS_SortedIntersectionDouble(da, db, 0)==(int)(nA-nIntersection));
+    CheckListValues(a, InIntersection);
+    CheckDoubleListValues(da, InIntersection);
+    assert(RICK45BLISTS_SortedDifference(a2, b, 0)==(int)nIntersection && RICK45BLISTS_SortedDifferenceDouble(da2, db, 0)==(int)nIntersection);
+    CheckListValues(a2, InDifference);
+    CheckDoubleListValues(da2, InDifference);
+    CheckListValues(b, InB);
+    CheckDoubleListValues(db, InB);
+    assert(RICK45BLISTS_SortedDifference(a2, a, 0)==0);
+    assert(RICK45BLISTS_SortedIntersection(a2, plain, 0)==(int)(nA-nIntersection) && RICK45BLISTS_GetListSize(a2)==0);
+    RICK45BLISTS_ListDestroy(&a2, 0);
+    RICK45BLISTS_DoubleListDestroy(&da2, 0);
+
+    /*dedup*/
+    RICK45BLISTS_RemoveAllNodes(a, 0);
+    RICK45BLISTS_DoubleListRemoveAllNodes(da, 0);
+    for (v = 0; v<300; v++)
+    {
+        RICK45BLISTS_TailAddListNode(&array_keys[v/3], a);
+        RICK45BLISTS_TailAddDoubleListNode(&array_keys[v/3], da);
+    }
+    assert(RICK45BLISTS_SortedDedup(a, 0)==200 && RICK45BLISTS_SortedDedupDouble(da, 0)==200);
+    assert(RICK45BLISTS_SortedDedup(a, 0)==0 && RICK45BLISTS_GetListSize(a)==100 && RICK45BLISTS_GetDoubleListSize(da)==100);
+    CheckListLinks(a);
+    CheckDoubleListLinks(da);
+    CheckSortedList(a);
+    CheckSortedDoubleList(da);
+    RICK45BLISTS_RemoveAllNodes(a, 0);
+    RICK45BLISTS_DoubleListRemoveAllNodes(da, 0);
+
+    /*k-way merge: equal keys keep the order of their lists (rows are laid out in memory in list order)*/
+    list_t srcs[5];
+    doubleList_t dsrcs[5];
+    srand(45);
+    for (row = 0; row<6; row++)
+    {
+        for (v = 0; v<300; v++)
+            rows[row][v] = (double)(rand()%200);
+        qsort(rows[row], 300, sizeof(double), RICK45B_DoubleCMP);
+    }
+    for (row = 0; row<5; row++)
+    {
+        srcs[row] = RICK45BLISTS_ListCreateWithAllocator(RICK45B_DoubleCMP, &counting);
+        dsrcs[row] = RICK45BLISTS_DoubleListCreateWithAllocator(RICK45B_DoubleCMP, &counting);
+    }
+    for (row = 0; row<6; row++)
+        for (v = 0; v<(row+1)*50; v++)
+        {
+            RICK45BLISTS_TailAddListNode(&rows[row][v], row==0 ? a : srcs[row-1]);
+            RICK45BLISTS_TailAddDoubleListNode(&rows[row][v], row==0 ? da : dsrcs[row-1]);
+        }
+    int before = live;
+    list_t repeated[3];
+    doubleList_t drepeated[3];
+    repeated[0] = srcs[0]; repeated[1] = srcs[1]; repeated[2] = srcs[0];
+    drepeated[0] = dsrcs[1]; drepeated[1] = dsrcs[1]; drepeated[2] = dsrcs[2];
+    assert(RICK45BLISTS_SortedMerge(a, repeated, 3)==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_INVALID_ARGUMENT);
+    assert(RICK45BLISTS_SortedMergeDouble(da, drepeated, 3)==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_INVALID_ARGUMENT);
+    assert(RICK45BLISTS_GetListSize(srcs[0])==100 && RICK45BLISTS_GetDoubleListSize(dsrcs[1])==150);
+    assert(RICK45BLISTS_GetListSize(a)==50 && RICK45BLISTS_GetDoubleListSize(da)==50 && live == before);
+    assert(RICK45BLISTS_SortedMerge(a, srcs, 5)==0 && RICK45BLISTS_SortedMergeDouble(da, dsrcs, 5)==0);
+    assert(live == before && RICK45BLISTS_GetListSize(a)==1050 && RICK45BLISTS_GetDoubleListSize(da)==1050);
+    CheckListLinks(a);
+    CheckDoubleListLinks(da);
+    CheckSortedList(a);
+    CheckSortedDoubleList(da);
+    for (row = 0; row<5; row++)
+    {
+        assert(RICK45BLISTS_GetListSize(srcs[row])==0 && RICK45BLISTS_GetDoubleListSize(dsrcs[row])==0);
+        RICK45BLISTS_ListDestroy(&srcs[row], 0);
+        RICK45BLISTS_DoubleListDestroy(&dsrcs[row], 0);
+    }
+    assert(RICK45BLISTS_SortedMerge(a, NULL, 0)==0);
+
+    /*a non-empty list without a pool can't be merged with lists using one, in any order: no list is changed*/
+    list_t mixed[2], m = RICK45BLISTS_ListCreateWithAllocator(RICK45B_DoubleCMP, &counting);
+    doubleList_t dmixed[2], dm = RICK45BLISTS_DoubleListCreateWithAllocator(RICK45B_DoubleCMP, &counting);
+    void *rowKeys[10];
+    for (v = 0; v<10; v++)
+        rowKeys[v] = &rows[5][v];
+    mixed[0] = RICK45BLISTS_ListCreateWithAllocator(RICK45B_DoubleCMP, &counting);
+    dmixed[0] = RICK45BLISTS_DoubleListCreateWithAllocator(RICK45B_DoubleCMP, &counting);
+    for (v = 0; v<10; v++)
+    {
+        RICK45BLISTS_TailAddListNode(&rows[4][v], mixed[0]);
+        RICK45BLISTS_TailAddDoubleListNode(&rows[4][v], dmixed[0]);
+    }
+    mixed[1] = RICK45BLISTS_ListFromArray(rowKeys, 10, RICK45B_DoubleCMP, &counting);
+    dmixed[1] = RICK45BLISTS_DoubleListFromArray(rowKeys, 10, RICK45B_DoubleCMP, &counting);
+    list_t pooled = mixed[1];
+    doubleList_t dpooled = dmixed[1];
+    before = live;
+    for (row = 0; row<2; row++)
+    {
+        assert(RICK45BLISTS_SortedMerge(m, mixed, 2)==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_INVALID_ARGUMENT);
+        assert(RICK45BLISTS_SortedMergeDouble(dm, dmixed, 2)==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_INVALID_ARGUMENT);
+        assert(m->pool == NULL && dm->pool == NULL && pooled->pool->refs == 1 && dpooled->pool->refs == 1);
+        assert(RICK45BLISTS_GetListSize(mixed[0])==10 && RICK45BLISTS_GetDoubleListSize(dmixed[1])==10 && live == before);
+        list_t swap = mixed[0];
+        mixed[0] = mixed[1];
+        mixed[1] = swap;
+        doubleList_t dswap = dmixed[0];
+        dmixed[0] = dmixed[1];
+        dmixed[1] = dswap;
+    }
+    RICK45BLISTS_RemoveAllNodes(mixed[0], 0);      /*an empty list without a pool is fine*/
+    RICK45BLISTS_DoubleListRemoveAllNodes(dmixed[0], 0);
+    assert(RICK45BLISTS_SortedMerge(m, mixed, 2)==0 && RICK45BLISTS_SortedMergeDouble(dm, dmixed, 2)==0);
+    assert(m->pool == pooled->pool && dm->pool == dpooled->pool);
+    CheckListLinks(m);
+    CheckSortedDoubleList(dm);
+    for (row = 0; row<2; row++)
+    {
+        RICK45BLISTS_ListDestroy(&mixed[row], 0);
+        RICK45BLISTS_DoubleListDestroy(&dmixed[row], 0);
+    }
+    assert(RICK45BLISTS_GetListSize(m)==10 && RICK45BLISTS_GetDoubleListSize(dm)==10);
+    RICK45BLISTS_ListDestroy(&m, 0);
+    RICK45BLISTS_DoubleListDestroy(&dm, 0);
+
+    RICK45BLISTS_ListDestroy(&a, 0);
+    RICK45BLISTS_ListDestroy(&b, 0);
+    RICK45BLISTS_ListDestroy(&plain, 0);
+    RICK45BLISTS_DoubleListDestroy(&da, 0);
+    RICK45BLISTS_DoubleListDestroy(&db, 0);
+    assert(live == 0);
+}
+
+size_t HashDouble(const void *key)
+{
+    return (size_t)*(const double *)key*2654435761u;
+}
+
+size_t HashCollide(const void *key)   /*every key in the same few slots: long clusters*/
+{
+    return (size_t)*(const double *)key%3;
+}
+
+/*checks that every node of the list is in its valid hash index, and nothing else.*/
+void CheckHashIndex(list_t list)
+{
+    struct hashIndex *hashIndex = list->hashIndex;
+    listNode_t node;
+    assert(hashIndex->valid && hashIndex->count == list->size && hashIndex->count*2 <= hashIndex->capacity);
+    for (node = list->head; node != NULL; node = node->next)
+    {
+        size_t i = hashIndex->hash(node->key) & (hashIndex->capacity-1);
+        while (hashIndex->slots[i].node != node)
+        {
+            assert(hashIndex->slots[i].node != NULL);
+            i = (i+1) & (hashIndex->capacity-1);
+        }
+        assert(hashIndex->slots[i].hash == hashIndex->hash(node->key));
+    }
+}
+
+void hashIndexListTEST()
+{
+    double array_keys[1000];
+    double missing = -1;
+    int live = 0;
+    struct allocator counting = {CountingAlloc, CountingFree, &live};
+    list_t list = RICK45BLISTS_ListCreateWithAllocator(RICK45B_DoubleCMP, &counting);
+    list_t other = RICK45BLISTS_ListCreateWithAllocator(RICK45B_DoubleCMP, &counting);
+    struct listIterator it;
+    size_t cnt;
+
+    assert(RICK45BLISTS_ListUseHashIndex(NULL, HashDouble)==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_NULL_ADT);
+    assert(RICK45BLISTS_ListUseHashIndex(list, NULL)==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_INVALID_ARGUMENT);
+    for (cnt = 0; cnt<1000; cnt++)
+        array_keys[cnt] = (double)cnt;
+
+    /*enabled on a list that already holds some nodes*/
+    for (cnt = 0; cnt<300; cnt++)
+        RICK45BLISTS_TailAddListNode(&array_keys[cnt], list);
+    int before = live;
+    assert(RICK45BLISTS_ListUseHashIndex(list, HashDouble)==0 && live == before+2);
+    assert(RICK45BLISTS_ListUseHashIndex(list, HashDouble)==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_INVALID_ARGUMENT);
+    CheckHashIndex(list);
+    for (cnt = 300; cnt<1000; cnt++)
+    {
+        if (cnt%2)  RICK45BLISTS_TailAddListNode(&array_keys[cnt], list);
+        else    RICK45BLISTS_HeadAddListNode(&array_keys[cnt], list);
+    }
+    CheckHashIndex(list);
+    CheckListLinks(list);
+    for (cnt = 0; cnt<1000; cnt++)
+        assert(RICK45BLISTS_GetNodeByKey(list, &array_keys[cnt])->key == &array_keys[cnt]);
+    assert(RICK45BLISTS_GetNodeByKey(list, &missing)==NULL && RICK45B_LastErrorCode()==RICK45B_ERR_NOT_FOUND);
+
+    /*removals and key changes*/
+    for (cnt = 0; cnt<1000; cnt += 3)
+        assert(RICK45BLISTS_RemoveNodeByKey(list, &array_keys[cnt], 0)==1);
+    assert(RICK45BLISTS_RemoveNodeByKey(list, &array_keys[0], 0)==0);
+    assert(RICK45BLISTS_RemoveHead(list, 0)==0 && RICK45BLISTS_RemoveTail(list, 0)==0);
+    assert(RICK45BLISTS_RemoveNode(list, 10, 0)==0 && RICK45BLISTS_AddListNode(&array_keys[0], list, 5)==0);
+    assert(RICK45BLISTS_SetKeyByKey(list, &missing, &array_keys[1])==1);
+    assert(RICK45BLISTS_SetKeyByPosition(list, &array_keys[1], 7)!=NULL);
+    assert(RICK45BLISTS_SetKeyByNode(list, &array_keys[3], RICK45BLISTS_GetNodeByKey(list, &missing))==&missing);
+    RICK45BLISTS_IteratorInit(&it, list);
+    while (RICK45BLISTS_IteratorHasNext(&it))
+        if (*(double *)RICK45BLISTS_IteratorNext(&it)->key > 900)
+            RICK45BLISTS_IteratorRemove(&it, 0);
+    CheckHashIndex(list);
+    CheckListLinks(list);
+    for (cnt = 0; cnt<1000; cnt++)
+    {
+        listNode_t node, scan = list->head;
+        while (scan != NULL && RICK45B_DoubleCMP(scan->key, &array_keys[cnt]))
+            scan = scan->next;
+        node = RICK45BLISTS_GetNodeByKey(list, &array_keys[cnt]);
+        assert(node == scan);
+    }
+    assert(RICK45BLISTS_GetNodeByKey(list, &missing)==NULL);
+
+    /*duplicated keys: the first node is still the one returned*/
+    RICK45BLISTS_TailAddListNode(&array_keys[2], list);
+    RICK45BLISTS_HeadAddListNode(&array_keys[2], list);
+    assert(RICK45BLISTS_GetNodeByKey(list, &array_keys[2]) == list->head);
+    assert(RICK45BLISTS_RemoveAllNodesByKey(list, &array_keys[2], 0)==3);
+    CheckHashIndex(list);
+
+    /*bulk edits: rebuilt by the next lookup*/
+    for (cnt = 0; cnt<10; cnt++)
+        RICK45BLISTS_TailAddListNode(&array_keys[cnt], other);
+    assert(RICK45BLISTS_Concat(list, other)==0 && !list->hashIndex->valid);
+    assert(RICK45BLISTS_GetNodeByKey(list, &array_keys[9]) == list->tail);
+    CheckHashIndex(list);
+    assert(RICK45BLISTS_ListSort(list)==0 && RICK45BLISTS_SortedDedup(list, 0)>0);
+    CheckHashIndex(list);
+    RICK45BLISTS_RemoveAllNodes(list, 0);
+    assert(RICK45BLISTS_GetNodeByKey(list, &array_keys[9])==NULL);
+    RICK45BLISTS_ListDestroy(&list, 0);
+    RICK45BLISTS_ListDestroy(&other, 0);
+    assert(live == 0);
+
+    /*colliding hashes*/
+    list = RICK45BLISTS_ListCreate(RICK45B_DoubleCMP);
+    assert(RICK45BLISTS_ListUseHashIndex(list, HashCollide)==0);
+    for (cnt = 0; cnt<200; cnt++)
+        RICK45BLISTS_InsertSorted(&array_keys[(cnt*7)%200], list);
+    CheckHashIndex(list);
+    for (cnt = 0; cnt<200; cnt += 2)
+        assert(RICK45BLISTS_RemoveNodeByKey(list, &array_keys[(cnt*13)%200], 0)==1);
+    CheckHashIndex(list);
+    for (cnt = 0; cnt<200; cnt++)
+        assert((RICK45BLISTS_GetNodeByKey(list, &array_keys[(cnt*13)%200])!=NULL) == (cnt%2));
+    RICK45BLISTS_ListDestroy(&list, 0);
+}
+
+/*checks that the lists hold the keys of 'order', in the same order.*/
+void CheckListOrder(list_t list, doubleList_t dlist, double **order, size_t n)
+{
+    size_t cnt;
+    listNode_t node = list->head;
+    doubleListNode_t dnode = dlist->head;
+    for (cnt = 0; cnt<n; cnt++, node = node->next, dnode = dnode->next)
+        assert(node->key == order[cnt] && dnode->key == order[cnt]);
+    CheckListLinks(list);
+    CheckDoubleListLinks(dlist);
+}
+
+void searchModeListTEST()
+{
+    double array_keys[50];
+    double *order[50];
+    double missing = -1;
+    int mode;
+    size_t cnt, found, lookup;
+
+    list_t indexed = RICK45BLISTS_IndexedListCreate(RICK45B_DoubleCMP);
+    assert(RICK45BLISTS_ListSetSearchMode(NULL, RICK45BLISTS_SEARCH_PLAIN)==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_NULL_ADT);
+    assert(RICK45BLISTS_DoubleListSetSearchMode(NULL, RICK45BLISTS_SEARCH_PLAIN)==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_NULL_ADT);
+    assert(RICK45BLISTS_ListSetSearchMode(indexed, 3)==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_INVALID_ARGUMENT);
+    assert(RICK45BLISTS_ListSetSearchMode(indexed, RICK45BLISTS_SEARCH_TRANSPOSE)==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_INVALID_ARGUMENT);
+    assert(RICK45BLISTS_ListSetSearchMode(indexed, RICK45BLISTS_SEARCH_PLAIN)==0);
+    RICK45BLISTS_ListDestroy(&indexed, 0);
+
+    for (mode = RICK45BLISTS_SEARCH_MOVE_TO_FRONT; mode<=RICK45BLISTS_SEARCH_TRANSPOSE; mode++)
+    {
+        list_t list = RICK45BLISTS_ListCreate(RICK45B_DoubleCMP);
+        doubleList_t dlist = RICK45BLISTS_DoubleListCreate(RICK45B_DoubleCMP);
+        assert(RICK45BLISTS_ListSetSearchMode(list, mode)==0 && RICK45BLISTS_DoubleListSetSearchMode(dlist, mode)==0);
+        assert(RICK45BLISTS_DoubleListSetSearchMode(dlist, -1)==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_INVALID_ARGUMENT);
+        assert(RICK45BLISTS_GetNodeByKey(list, &missing)==NULL && RICK45BLISTS_GetNodeByKeyDouble(dlist, &missing)==NULL);
+        for (cnt = 0; cnt<50; cnt++)
+        {
+            array_keys[cnt] = (double)cnt;
+            order[cnt] = &array_keys[cnt];
+            RICK45BLISTS_TailAddListNode(&array_keys[cnt], list);
+            RICK45BLISTS_TailAddDoubleListNode(&array_keys[cnt], dlist);
+        }
+
+        /*skewed lookups: the tail and a few hot keys most of the times*/
+        srand(45);
+        for (lookup = 0; lookup<500; lookup++)
+        {
+            double key = lookup%5 ? (double)(rand()%4*10+9) : (double)(rand()%50);
+            for (found = 0; *order[found] != key; found++);
+            double *hit = order[found];
+            if (found>0 && mode == RICK45BLISTS_SEARCH_TRANSPOSE)
+            {
+                order[found] = order[found-1];
+                order[found-1] = hit;
+            }
+            else if (found>0)
+            {
+                memmove(&order[1], &order[0], found*sizeof(double *));
+                order[0] = hit;
+            }
+            assert(RICK45BLISTS_GetNodeByKey(list, &key)->key == hit);
+            assert(RICK45BLISTS_GetNodeByKeyDouble(dlist, &key)->key == hit);
+            CheckListOrder(list, dlist, order, 50);
+            assert(RICK45BLISTS_GetKeyByPositionDouble(dlist, found>0 ? found-1 : 0) == order[found>0 ? found-1 : 0]);
+        }
+        if (mode == RICK45BLISTS_SEARCH_MOVE_TO_FRONT)  /*the last key looked up (a hot one) is the head*/
+            assert((long)*(double *)list->head->key%10 == 9 && list->head->key == dlist->head->key);
+        assert(RICK45BLISTS_GetNodeByKey(list, &missing)==NULL && RICK45B_LastErrorCode()==RICK45B_ERR_NOT_FOUND);
+
+        /*back to plain lookups: nothing moves*/
+        assert(RICK45BLISTS_ListSetSearchMode(list, RICK45BLISTS_SEARCH_PLAIN)==0);
+        assert(RICK45BLISTS_DoubleListSetSearchMode(dlist, RICK45BLISTS_SEARCH_PLAIN)==0);
+        assert(RICK45BLISTS_GetNodeByKey(list, order[49])==list->tail && RICK45BLISTS_GetNodeByKeyDouble(dlist, order[30])->key==order[30]);
+        CheckListOrder(list, dlist, order, 50);
+        RICK45BLISTS_ListDestroy(&list, 0);
+        RICK45BLISTS_DoubleListDestroy(&dlist, 0);
+    }
+}
+
+#define STRESS_THREADS 8
+#define STRESS_KEYS 1024        /*the first half is split among the threads, the second one is shared*/
+#define STRESS_STEPS 20000
+
+void *AtomicCountingAlloc(size_t size, void *ctx)
+{
+    __atomic_fetch_add((int *)ctx, 1, __ATOMIC_RELAXED);
+    return malloc(size);
+}
+
+void AtomicCountingFree(void *ptr, void *ctx)
+{
+    __atomic_fetch_sub((int *)ctx, 1, __ATOMIC_RELAXED);
+    free(ptr);
+}
+
+struct stressArg{
+    concurrentList_t clist;
+    double *keys;
+    size_t thread;
+    long sharedBalance;     /*insertions minus removals of shared keys that succeeded*/
+    char present[STRESS_KEYS/2];    /*expected state of the keys owned by the thread*/
+};
+
+void *StressWorker(void *arg)
+{
+    struct stressArg *stress = arg;
+    unsigned long long seed = 0x9E3779B97F4A7C15ULL*(stress->thread+1);
+    size_t step;
+    for (step = 0; step<STRESS_STEPS; step++)
+    {
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+        size_t op = (size_t)(seed>>32)%3;
+        if (seed & 1)   /*owned key: every result is known in advance*/
+        {
+            size_t k = ((size_t)(seed>>8)%(STRESS_KEYS/2/STRESS_THREADS))*STRESS_THREADS+stress->thread;
+            if (op == 0)
+            {
+                assert(RICK45BLISTS_ConcurrentListInsert(&stress->keys[k], stress->clist) == !stress->present[k]);
+                stress->present[k] = 1;
+            }
+            else if (op == 1)
+            {
+                assert(RICK45BLISTS_ConcurrentListRemove(stress->clist, &stress->keys[k], 0) == stress->present[k]);
+                stress->present[k] = 0;
+            }
+            else
+                assert(RICK45BLISTS_ConcurrentListContains(stress->clist, &stress->keys[k]) == stress->present[k]);
+        }
+        else
+        {
+            size_t k = STRESS_KEYS/2+(size_t)(seed>>8)%(STRESS_KEYS/2);
+            if (op == 0)
+                stress->sharedBalance += RICK45BLISTS_ConcurrentListInsert(&stress->keys[k], stress->clist);
+            else if (op == 1)
+                stress->sharedBalance -= RICK45BLISTS_ConcurrentListRemove(stress->clist, &stress->keys[k], 0);
+            else
+                assert(RICK45BLISTS_ConcurrentListContains(stress->clist, &stress->keys[k]) != -1);
+        }
+    }
+    return NULL;
+}
+
+void concurrentListTEST()
+{
+    double keys[STRESS_KEYS];
+    double missing = -1;
+    int live = 0;
+    struct allocator counting = {AtomicCountingAlloc, AtomicCountingFree, &live};
+    struct stressArg stress[STRESS_THREADS];
+    pthread_t threads[STRESS_THREADS];
+    size_t cnt, t;
+
+    assert(RICK45BLISTS_ConcurrentListCreate(NULL)==NULL && RICK45B_LastErrorCode()==RICK45B_ERR_INVALID_ARGUMENT);
+    assert(RICK45BLISTS_ConcurrentListInsert(&missing, NULL)==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_NULL_ADT);
+    assert(RICK45BLISTS_ConcurrentListRemove(NULL, &missing, 0)==-1 && RICK45BLISTS_ConcurrentListContains(NULL, &missing)==-1);
+    assert(RICK45BLISTS_GetConcurrentListSize(NULL)==0);
+    for (cnt = 0; cnt<STRESS_KEYS; cnt++)
+        keys[cnt] = (double)cnt;
+
+    /*single thread: sorted, without duplicates*/
+    concurrentList_t clist = RICK45BLISTS_ConcurrentListCreateWithAllocator(RICK45B_DoubleCMP, &counting);
+    assert(RICK45BLISTS_ConcurrentListInsert(NULL, clist)==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_INVALID_ARGUMENT);
+    for (cnt = 0; cnt<100; cnt++)
+        assert(RICK45BLISTS_ConcurrentListInsert(&keys[(cnt*37)%100], clist)==1);
+    assert(RICK45BLISTS_ConcurrentListInsert(&keys[5], clist)==0 && RICK45BLISTS_GetConcurrentListSize(clist)==100);
+    for (cnt = 0; cnt<100; cnt += 2)
+        assert(RICK45BLISTS_ConcurrentListRemove(clist, &keys[cnt], 0)==1);
+    assert(RICK45BLISTS_ConcurrentListRemove(clist, &keys[0], 0)==0 && RICK45BLISTS_ConcurrentListRemove(clist, &missing, 0)==0);
+    for (cnt = 0; cnt<100; cnt++)
+        assert(RICK45BLISTS_ConcurrentListContains(clist, &keys[cnt]) == (int)(cnt%2));
+    concurrentListNode_t node = clist->head;
+    for (cnt = 1; cnt<100; cnt += 2, node = node->next)
+        assert(node->key == &keys[cnt]);
+    assert(node == NULL && RICK45BLISTS_GetConcurrentListSize(clist)==50);
+
+    /*removed keys are freed once released*/
+    double *owned = malloc(sizeof(double));
+    *owned = 0.5;
+    assert(RICK45BLISTS_ConcurrentListInsert(owned, clist)==1 && RICK45BLISTS_ConcurrentListRemove(clist, owned, 1)==1);
+    owned = malloc(sizeof(double));
+    *owned = 0.5;
+    assert(RICK45BLISTS_ConcurrentListInsert(owned, clist)==1);
+    RICK45BLISTS_ConcurrentListRemove(clist, &keys[1], 0);
+    RICK45BLISTS_ConcurrentListRemove(clist, owned, 1);
+    RICK45BLISTS_ConcurrentListDestroy(&clist, 0);
+    assert(clist == NULL && live == 0);
+
+    /*stress: owned keys check every result, shared keys check the final count*/
+    clist = RICK45BLISTS_ConcurrentListCreateWithAllocator(RICK45B_DoubleCMP, &counting);
+    for (t = 0; t<STRESS_THREADS; t++)
+    {
+        stress[t].clist = clist;
+        stress[t].keys = keys;
+        stress[t].thread = t;
+        stress[t].sharedBalance = 0;
+        memset(stress[t].present, 0, sizeof(stress[t].present));
+        assert(pthread_create(&threads[t], NULL, StressWorker, &stress[t])==0);
+    }
+    for (t = 0; t<STRESS_THREADS; t++)
+        pthread_join(threads[t], NULL);
+
+    long shared = 0;
+    size_t size = 0;
+    for (t = 0; t<STRESS_THREADS; t++)
+        shared += stress[t].sharedBalance;
+    double previous = -1;
+    for (node = clist->head; node != NULL; node = node->next, size++)
+    {
+        size_t k = (size_t)*(double *)node->key;
+        assert(((size_t)node->next & 3) == 0 && *(double *)node->key > previous);   /*nothing left marked*/
+        previous = *(double *)node->key;
+        if (k<STRESS_KEYS/2)
+            assert(stress[k%STRESS_THREADS].present[k]);
+        else
+            shared--;
+    }
+    for (cnt = 0; cnt<STRESS_KEYS/2; cnt++)
+        if (stress[cnt%STRESS_THREADS].present[cnt])
+            assert(RICK45BLISTS_ConcurrentListContains(clist, &keys[cnt])==1);
+    assert(shared == 0 && size == RICK45BLISTS_GetConcurrentListSize(clist));
+    RICK45BLISTS_ConcurrentListDestroy(&clist, 0);
+    assert(live == 0);
+}
+
+struct intrusiveItem{
+    double value;
+    struct intrusiveLink link;
+};
+
+void intrusiveListTEST()
+{
+    struct intrusiveItem items[10];
+    struct intrusiveItem *item;
+    double missing = -1, sum = 0;
+    int live = 0;
+    struct allocator counting = {CountingAlloc, CountingFree, &live};
+    size_t offset = offsetof(struct intrusiveItem, link);
+    size_t cnt;
+
+    assert(RICK45BLISTS_IntrusiveListCreate(NULL, offset)==NULL && RICK45B_LastErrorCode()==RICK45B_ERR_INVALID_ARGUMENT);
+    assert(RICK45BLISTS_IntrusiveTailAdd(&items[0], NULL)==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_NULL_ADT);
+    assert(RICK45BLISTS_IntrusiveRemoveHead(NULL)==NULL && RICK45BLISTS_GetIntrusiveListSize(NULL)==0);
+    for (cnt = 0; cnt<10; cnt++)
+        items[cnt].value = (double)cnt;
+    assert(RICK45BLISTS_CONTAINER_OF(&items[3].link, struct intrusiveItem, link) == &items[3]);
+
+    /*the only allocation is the list itself: linking an object never allocates*/
+    intrusiveList_t ilist = RICK45BLISTS_IntrusiveListCreateWithAllocator(RICK45B_DoubleCMP, offset, &counting);
+    assert(live == 1);
+    assert(RICK45BLISTS_IntrusiveTailAdd(NULL, ilist)==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_INVALID_ARGUMENT);
+    assert(RICK45BLISTS_IntrusiveRemoveHead(ilist)==NULL && RICK45BLISTS_IntrusiveGetHead(ilist)==NULL);
+    for (cnt = 2; cnt<8; cnt++)
+        assert(RICK45BLISTS_IntrusiveTailAdd(&items[cnt], ilist)==0);
+    assert(RICK45BLISTS_IntrusiveHeadAdd(&items[1], ilist)==0 && RICK45BLISTS_IntrusiveAddAfter(&items[0], ilist, NULL)==0);
+    assert(RICK45BLISTS_IntrusiveAddAfter(&items[8], ilist, &items[7])==0 && RICK45BLISTS_IntrusiveAddAfter(&items[9], ilist, &items[8])==0);
+    assert(live == 1 && RICK45BLISTS_GetIntrusiveListSize(ilist)==10);
+
+    /*both directions*/
+    for (cnt = 0, item = RICK45BLISTS_IntrusiveGetHead(ilist); item != NULL; item = RICK45BLISTS_IntrusiveGetNext(ilist, item), cnt++)
+        assert(item == &items[cnt]);
+    assert(cnt == 10);
+    for (item = RICK45BLISTS_IntrusiveGetTail(ilist); item != NULL; item = RICK45BLISTS_IntrusiveGetPrevious(ilist, item))
+        assert(item == &items[--cnt]);
+    assert(cnt == 0);
+    assert(RICK45BLISTS_IntrusiveListforEach(ilist, SumKeys, &sum)==0 && sum == 45);
+
+    /*lookup and removal*/
+    assert(RICK45BLISTS_IntrusiveGetObjectByKey(ilist, &items[6].value) == &items[6]);
+    assert(RICK45BLISTS_IntrusiveGetObjectByKey(ilist, &missing)==NULL && RICK45B_LastErrorCode()==RICK45B_ERR_NOT_FOUND);
+    assert(RICK45BLISTS_IntrusiveRemove(ilist, &items[5], 0)==0 && items[5].link.next==NULL && items[5].link.previous==NULL);
+    assert(RICK45BLISTS_IntrusiveGetNext(ilist, &items[4]) == &items[6] && RICK45BLISTS_IntrusiveGetPrevious(ilist, &items[6]) == &items[4]);
+    assert(RICK45BLISTS_IntrusiveRemoveHead(ilist) == &items[0] && RICK45BLISTS_IntrusiveRemoveTail(ilist) == &items[9]);
+    assert(RICK45BLISTS_IntrusiveGetHead(ilist) == &items[1] && RICK45BLISTS_IntrusiveGetTail(ilist) == &items[8]);
+    assert(RICK45BLISTS_GetIntrusiveListSize(ilist)==7);
+
+    /*an object can move to another list once unlinked*/
+    intrusiveList_t other = RICK45BLISTS_IntrusiveListCreateWithAllocator(RICK45B_DoubleCMP, offset, &counting);
+    assert(RICK45BLISTS_IntrusiveTailAdd(&items[5], other)==0 && RICK45BLISTS_IntrusiveGetHead(other) == &items[5]);
+    RICK45BLISTS_IntrusiveListDestroy(&other, 0);
+    assert(other == NULL && items[5].value == 5);
+
+    /*delete_bool frees the objects*/
+    struct intrusiveItem *heap = malloc(sizeof(struct intrusiveItem));
+    heap->value = 42;
+    assert(RICK45BLISTS_IntrusiveRemove(ilist, &items[4], 0)==0);
+    assert(RICK45BLISTS_IntrusiveTailAdd(heap, ilist)==0 && RICK45BLISTS_IntrusiveRemove(ilist, heap, 1)==0);
+    RICK45BLISTS_IntrusiveListDestroy(&ilist, 0);
+    assert(ilist == NULL && live == 0);
+}
+
+/*walks the xor list from both ends, checking it holds keys[order[0]] ... keys[order[n-1]]*/
+void CheckXorList(xorList_t xlist, double *keys, size_t *order, size_t n)
+{
+    struct xorListIterator it;
+    size_t cnt = 0;
+    void *key;
+    assert(RICK45BLISTS_GetXorListSize(xlist) == n);
+    RICK45BLISTS_XorIteratorInit(&it, xlist);
+    while ((key = RICK45BLISTS_XorIteratorNext(&it)) != NULL)
+        assert(cnt<n && key == &keys[order[cnt++]]);
+    assert(cnt == n);
+    RICK45BLISTS_XorIteratorInitTail(&it, xlist);
+    while ((key = RICK45BLISTS_XorIteratorNext(&it)) != NULL)
+        assert(cnt>0 && key == &keys[order[--cnt]]);
+    assert(cnt == 0);
+}
+
+void xorListTEST()
+{
+    double keys[10];
+    double missing = -1, sum = 0;
+    size_t order[10];
+    int live = 0;
+    struct allocator counting = {CountingAlloc, CountingFree, &live};
+    struct xorListIterator it;
+    size_t cnt;
+
+    assert(sizeof(struct xorListNode)*3 == sizeof(struct doubleListNode)*2);
+    assert(RICK45BLISTS_XorListCreate(NULL)==NULL && RICK45B_LastErrorCode()==RICK45B_ERR_INVALID_ARGUMENT);
+    assert(RICK45BLISTS_XorTailAdd(&missing, NULL)==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_NULL_ADT);
+    assert(RICK45BLISTS_XorGetHeadKey(NULL)==NULL && RICK45BLISTS_GetXorListSize(NULL)==0);
+    for (cnt = 0; cnt<10; cnt++)
+        keys[cnt] = (double)cnt;
+
+    xorList_t xlist = RICK45BLISTS_XorListCreateWithAllocator(RICK45B_DoubleCMP, &counting);
+    assert(RICK45BLISTS_XorRemoveHead(xlist, 0)==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_EMPTY);
+    assert(RICK45BLISTS_XorTailAdd(NULL, xlist)==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_INVALID_ARGUMENT);
+    CheckXorList(xlist, keys, order, 0);
+    for (cnt = 5; cnt<10; cnt++)
+        assert(RICK45BLISTS_XorTailAdd(&keys[cnt], xlist)==0);
+    for (cnt = 5; cnt>0; cnt--)
+        assert(RICK45BLISTS_XorHeadAdd(&keys[cnt-1], xlist)==0);
+    for (cnt = 0; cnt<10; cnt++)
+        order[cnt] = cnt;
+    CheckXorList(xlist, keys, order, 10);
+    assert(live == 11 && RICK45BLISTS_XorGetHeadKey(xlist) == &keys[0] && RICK45BLISTS_XorGetTailKey(xlist) == &keys[9]);
+    assert(RICK45BLISTS_XorListforEach(xlist, SumKeys, &sum)==0 && sum == 45);
+
+    /*turning an iterator around*/
+    RICK45BLISTS_XorIteratorInit(&it, xlist);
+    assert(RICK45BLISTS_XorIteratorNext(&it) == &keys[0] && RICK45BLISTS_XorIteratorNext(&it) == &keys[1]);
+    assert(RICK45BLISTS_XorIteratorNext(&it) == &keys[2] && RICK45BLISTS_XorIteratorReverse(&it)==0);
+    assert(RICK45BLISTS_XorIteratorNext(&it) == &keys[2] && RICK45BLISTS_XorIteratorNext(&it) == &keys[1]);
+    assert(RICK45BLISTS_XorIteratorNext(&it) == &keys[0] && RICK45BLISTS_XorIteratorNext(&it) == NULL);
+    RICK45BLISTS_XorIteratorInitTail(&it, xlist);
+    assert(RICK45BLISTS_XorIteratorReverse(&it)==0 && RICK45BLISTS_XorIteratorNext(&it) == NULL);
+
+    /*removals from both ends and from the middle*/
+    assert(RICK45BLISTS_XorRemoveHead(xlist, 0)==0 && RICK45BLISTS_XorRemoveTail(xlist, 0)==0);
+    assert(RICK45BLISTS_XorRemoveByKey(xlist, &keys[5], 0)==1 && RICK45BLISTS_XorRemoveByKey(xlist, &keys[1], 0)==1);
+    assert(RICK45BLISTS_XorRemoveByKey(xlist, &keys[8], 0)==1);
+    RICK45B_ClearError();
+    assert(RICK45BLISTS_XorRemoveByKey(xlist, &missing, 0)==0 && RICK45B_LastErrorCode()==RICK45B_NO_ERROR);   /*not an error*/
+    order[0] = 2; order[1] = 3; order[2] = 4; order[3] = 6; order[4] = 7;
+    CheckXorList(xlist, keys, order, 5);
+    assert(RICK45BLISTS_XorGetKeyByKey(xlist, &keys[6]) == &keys[6] && RICK45BLISTS_XorGetKeyByKey(xlist, &keys[8])==NULL);
+
+    /*reversal in O(1), then editing both ends again*/
+    assert(RICK45BLISTS_XorListReverse(xlist)==0);
+    order[0] = 7; order[1] = 6; order[2] = 4; order[3] = 3; order[4] = 2;
+    CheckXorList(xlist, keys, order, 5);
+    assert(RICK45BLISTS_XorHeadAdd(&keys[9], xlist)==0 && RICK45BLISTS_XorTailAdd(&keys[0], xlist)==0);
+    assert(RICK45BLISTS_XorRemoveByKey(xlist, &keys[4], 0)==1);
+    order[0] = 9; order[1] = 7; order[2] = 6; order[3] = 3; order[4] = 2; order[5] = 0;
+    CheckXorList(xlist, keys, order, 6);
+    while (RICK45BLISTS_GetXorListSize(xlist) > 0)
+        assert(RICK45BLISTS_XorRemoveTail(xlist, 0)==0);
+    assert(xlist->head == NULL && xlist->tail == NULL && live == 1);
+
+    /*nodes from a pool*/
+    assert(RICK45BLISTS_XorListUseNodePool(xlist, 4)==0 && RICK45BLISTS_XorListUseNodePool(xlist, 4)==-1);
+    for (cnt = 0; cnt<10; cnt++)
+    {
+        assert(RICK45BLISTS_XorTailAdd(&keys[cnt], xlist)==0);
+        order[cnt] = cnt;
+    }
+    assert(RICK45BLISTS_XorListUseNodePool(xlist, 4)==-1);
+    CheckXorList(xlist, keys, order, 10);
+    RICK45BLISTS_XorListDestroy(&xlist, 0);
+    assert(xlist == NULL && live == 0);
+
+    /*delete_bool frees the keys*/
+    xlist = RICK45BLISTS_XorListCreate(RICK45B_DoubleCMP);
+    for (cnt = 0; cnt<3; cnt++)
+    {
+        double *key = malloc(sizeof(double));
+        *key = (double)cnt;
+        assert(RICK45BLISTS_XorHeadAdd(key, xlist)==0);
+    }
+    assert(RICK45BLISTS_XorRemoveByKey(xlist, &keys[1], 1)==1 && RICK45BLISTS_XorRemoveTail(xlist, 1)==0);
+    RICK45BLISTS_XorListDestroy(&xlist, 1);
+    assert(xlist == NULL);
+}
@@ -23,52 +23,524 @@
 */
 
 #include "Rick45B-AlgorithmsADT.h"
+#ifndef RICK45B_NO_THREADS
+#include <pthread.h>
+#endif
 
 list_t RICK45BLISTS_ListCreate(RICK45B_comparator_t key_cmp){
 
+    return RICK45BLISTS_ListCreateWithAllocator(key_cmp, NULL);
+}
+
+list_t RICK45BLISTS_ListCreateWithAllocator(RICK45B_comparator_t key_cmp, allocator_t allocator){
+
     if (key_cmp == NULL)
     {
-        RICK45B_CopyString("Invalid Argument: key_cmp function cannot be NULL!", RICK45B.GetError, sizeof("Invalid Argument: key_cmp function cannot be NULL!"));
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: key_cmp function cannot be NULL!");
+        return NULL;
+    }
+    if (allocator != NULL && (allocator->alloc_funct == NULL || allocator->free_funct == NULL))
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: the allocator's functions cannot be NULL!");
         return NULL;
     }
 
+    struct allocator alloc = RICK45B_PickAllocator(allocator);
     list_t out = NULL;
-    out = mallocFun(sizeof(struct list));
+    out = RICK45B_Alloc(&alloc, sizeof(struct list));
 
     if (out == NULL)
     {
-        RICK45B_CopyString("Fatal Error: Cannot allocate memory for new list_t type. Perhaps the heap is full?", RICK45B.GetError, sizeof("Fatal Error: Cannot allocate memory for new list_t type. Perhaps the heap is full?"));
+        RICK45B_SetError(RICK45B_ERR_NO_MEMORY, "Fatal Error: Cannot allocate memory for new list_t type. Perhaps the heap is full?");
         return NULL;
     }
     out->head = NULL;
     out->tail = NULL;
+    out->tailPrevious = NULL;
     out->pointedNode = NULL;
     out -> key_cmp = key_cmp;
     out -> size = 0;
+    out -> allocator = alloc;
+    out -> nodeAllocator = alloc;
+    out -> pool = NULL;
+    out -> index = NULL;
+    out -> hashIndex = NULL;
+    out -> searchMode = RICK45BLISTS_SEARCH_PLAIN;
+    return out;
+}
+
+list_t RICK45BLISTS_IndexedListCreate(RICK45B_comparator_t key_cmp){
+
+    return RICK45BLISTS_IndexedListCreateWithAllocator(key_cmp, NULL);
+}
+
+list_t RICK45BLISTS_IndexedListCreateWithAllocator(RICK45B_comparator_t key_cmp, allocator_t allocator){
+
+    list_t out = RICK45BLISTS_ListCreateWithAllocator(key_cmp, allocator);
+    if (out == NULL)
+        return NULL;
+
+    struct skipIndex *index = RICK45B_Alloc(&out->allocator, sizeof(struct skipIndex));
+    struct skipTower *head = RICK45B_Alloc(&out->allocator, sizeof(struct skipTower)+RICK45BLISTS_SKIP_MAX_LEVEL*sizeof(struct skipLink));
+    if (index == NULL || head == NULL)
+    {
+        if (index != NULL)  RICK45B_Free(&out->allocator, index);
+        if (head != NULL)   RICK45B_Free(&out->allocator, head);
+        RICK45BLISTS_ListDestroy(&out, FALSE);
+        RICK45B_SetError(RICK45B_ERR_NO_MEMORY, "Fatal Error: Cannot allocate memory for the list's index. Perhaps the heap is full?");
+        return NULL;
+    }
+    size_t l;
+    for (l = 0; l<RICK45BLISTS_SKIP_MAX_LEVEL; l++)
+    {
+        head->links[l].next = NULL;
+        head->links[l].span = 0;
+    }
+    head->node = NULL;
+    head->height = RICK45BLISTS_SKIP_MAX_LEVEL;
+    index->head = head;
+    index->levels = 0;
+    index->valid = TRUE;
+    index->seed = 0x9E3779B97F4A7C15ULL;
+    out->index = index;
     return out;
 }
 
 void RICK45BLISTS_ListDestroy(list_t *linkedList, int delete_bool){
 
-    if (linkedList != NULL)
+    if (linkedList != NULL && *linkedList != NULL)
     {
-        RICK45BLISTS_RemoveAllNodes(*linkedList, delete_bool);
-        freeFun(*linkedList);
+        struct allocator alloc = (*linkedList)->allocator;
+        if ((*linkedList)->index != NULL)
+        {
+            RICK45BLISTS_SkipIndexClear(*linkedList);
+            RICK45B_Free(&alloc, (*linkedList)->index->head);
+            RICK45B_Free(&alloc, (*linkedList)->index);
+            (*linkedList)->index = NULL;
+        }
+        if ((*linkedList)->hashIndex != NULL)
+        {
+            if ((*linkedList)->hashIndex->slots != NULL)
+                RICK45B_Free(&alloc, (*linkedList)->hashIndex->slots);
+            RICK45B_Free(&alloc, (*linkedList)->hashIndex);
+            (*linkedList)->hashIndex = NULL;
+        }
+        if ((*linkedList)->pool != NULL && (*linkedList)->pool->refs == 1 && (*linkedList)->pool->forward == NULL)    /*the nodes are released all at once, together with their pool*/
+        {
+            listNode_t node;
+            if (delete_bool)
+                for (node = (*linkedList)->head; node != NULL; node = node->next)
+                    freeFun(node->key);
+            RICK45B_NodePoolDestroy((*linkedList)->pool);
+        }
+        else
+        {
+            RICK45BLISTS_RemoveAllNodes(*linkedList, delete_bool);   /*a shared pool keeps the nodes for its other owners*/
+            RICK45B_NodePoolDestroy((*linkedList)->pool);
+        }
+        RICK45B_Free(&alloc, *linkedList);
         *linkedList = NULL;
     }
 
 }
 
+int RICK45BLISTS_ListUseNodePool(list_t linkedList, size_t nodesPerChunk)
+{
+    if (linkedList == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list.");
+        return -1;
+    }
+    if (linkedList->size != 0)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: a node pool can only be attached to an empty list!");
+        return -1;
+    }
+    if (linkedList->pool != NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: the list already uses a node pool!");
+        return -1;
+    }
+    nodePool_t pool = RICK45B_NodePoolCreate(sizeof(struct listNode), nodesPerChunk, &linkedList->allocator);
+    if (pool == NULL)   return -1;
+    linkedList->pool = pool;
+    linkedList->nodeAllocator = RICK45B_NodePoolAllocator(pool);
+    return 0;
+}
+
+int RICK45BLISTS_ListUseHashIndex(list_t linkedList, RICK45B_hash_t hash)
+{
+    if (linkedList == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list.");
+        return -1;
+    }
+    if (hash == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: hash function cannot be NULL!");
+        return -1;
+    }
+    if (linkedList->hashIndex != NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: the list already uses a hash index!");
+        return -1;
+    }
+    struct hashIndex *hashIndex = RICK45B_Alloc(&linkedList->allocator, sizeof(struct hashIndex));
+    if (hashIndex == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NO_MEMORY, "Fatal Error: Cannot allocate memory for the list's hash index. Perhaps the heap is full?");
+        return -1;
+    }
+    hashIndex->hash = hash;
+    hashIndex->slots = NULL;
+    hashIndex->capacity = 0;
+    hashIndex->count = 0;
+    hashIndex->valid = FALSE;
+    linkedList->hashIndex = hashIndex;
+    if (RICK45BLISTS_HashIndexRebuild(linkedList) == -1)
+    {
+        RICK45B_Free(&linkedList->allocator, hashIndex);
+        linkedList->hashIndex = NULL;
+        RICK45B_SetError(RICK45B_ERR_NO_MEMORY, "Fatal Error: Cannot allocate memory for the list's hash index. Perhaps the heap is full?");
+        return -1;
+    }
+    return 0;
+}
+
+int RICK45BLISTS_ListSetSearchMode(list_t linkedList, int mode)
+{
+    if (linkedList == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list.");
+        return -1;
+    }
+    if (mode != RICK45BLISTS_SEARCH_PLAIN && mode != RICK45BLISTS_SEARCH_MOVE_TO_FRONT && mode != RICK45BLISTS_SEARCH_TRANSPOSE)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: unknown search mode!");
+        return -1;
+    }
+    if (linkedList->index != NULL && mode != RICK45BLISTS_SEARCH_PLAIN)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: the nodes of an indexed list can't be moved by the lookups!");
+        return -1;
+    }
+    linkedList->searchMode = mode;
+    return 0;
+}
+
+list_t RICK45BLISTS_ListFromArray(void **keys, size_t n, RICK45B_comparator_t key_cmp, allocator_t allocator)
+{
+    size_t cnt;
+    if (keys == NULL && n != 0)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: keys cannot be NULL!");
+        return NULL;
+    }
+    for (cnt = 0; cnt<n; cnt++)
+        if (keys[cnt] == NULL)
+        {
+            RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: key cannot be NULL!");
+            return NULL;
+        }
+    list_t out = RICK45BLISTS_ListCreateWithAllocator(key_cmp, allocator);
+    if (out == NULL || n == 0)
+        return out;
+    if (RICK45BLISTS_ListUseNodePool(out, n) == -1)
+    {
+        RICK45BLISTS_ListDestroy(&out, 0);
+        return NULL;
+    }
+
+    /*the first node allocates the whole block, the others are carved out of it in order*/
+    listNode_t prev = NULL;
+    for (cnt = 0; cnt<n; cnt++)
+    {
+        listNode_t node = RICK45B_NodePoolAlloc(out->pool);
+        if (node == NULL)
+        {
+            RICK45BLISTS_ListDestroy(&out, 0);
+            return NULL;
+        }
+        node->key = keys[cnt];
+        if (prev == NULL)   out->head = node;
+        else    prev->next = node;
+        out->tailPrevious = prev;
+        prev = node;
+    }
+    prev->next = NULL;
+    out->tail = prev;
+    out->size = n;
+    out->pool->nodesPerChunk = RICK45B_POOL_DEFAULT_CHUNK;  /*nodes added later don't need another block that big*/
+    return out;
+}
+
+void **RICK45BLISTS_ListToArray(list_t linkedList, void **array, int reverse)
+{
+    if (linkedList == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list.");
+        return NULL;
+    }
+    if (array == NULL)
+    {
+        array = RICK45B_Alloc(&RICK45B_DefaultAllocator, sizeof(void *)*(linkedList->size!=0 ? linkedList->size : 1));
+        if (array == NULL)
+        {
+            RICK45B_SetError(RICK45B_ERR_NO_MEMORY, "Fatal Error: Cannot allocate memory for the array of keys. Maybe the heap is full?");
+            return NULL;
+        }
+    }
+
+    if (linkedList->size == 0)
+        return array;
+
+    /*the list can only be walked forward: in reverse, the array is filled from its end*/
+    void **slot = reverse ? array+linkedList->size-1 : array;
+    ptrdiff_t step = reverse ? -1 : 1;
+    listNode_t node;
+    for (node = linkedList->head; node != NULL; node = node->next, slot += step)
+    {
+        if (node->next != NULL)     /*the next miss overlaps with this copy*/
+            RICK45B_PREFETCH(node->next->next);
+        *slot = node->key;
+    }
+    return array;
+}
+
+int RICK45BLISTS_ListforEach(list_t linkedList, RICK45B_forEach_t funct, void *opt)
+{
+    if (linkedList == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list.");
+        return -1;
+    }
+    if (funct == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: funct cannot be NULL!");
+        return -1;
+    }
+
+    listNode_t node;
+    RICK45BLISTS_HashIndexInvalidate(linkedList);     /*the keys may change*/
+    for (node = linkedList->head; node != NULL; node = node->next)
+        if (funct(node, opt) == -1)
+        {
+            RICK45B_SetError(RICK45B_ERR_CALLBACK, "Provided function error!");
+            return -1;
+        }
+    return 0;
+}
+
+/*a chunk of consecutive nodes walked by one thread of a parallel function, and what to do with them.*/
+struct parallelChunk{
+    void *first;                /*first node of the chunk (listNode_t or doubleListNode_t).*/
+    size_t position;            /*position of 'first' inside its list.*/
+    size_t count;               /*number of nodes of the chunk.*/
+    int doubleNodes;            /*TRUE if the nodes are doubleListNode_t.*/
+    RICK45B_forEach_t funct;    /*forEach: applied to every node.*/
+    RICK45B_map_t map;          /*map: applied to every key, the results go in 'results' at the keys' positions.*/
+    void **results;
+    RICK45B_combine_t fold;     /*reduce: folds every key into 'acc'.*/
+    void *acc;
+    size_t accSize;
+    void *opt;
+    int result;                 /*-1 if a call of the user function failed.*/
+};
+
+static void *RICK45BLISTS_ChunkNext(void *node, int doubleNodes)
+{
+    return doubleNodes ? (void *)((doubleListNode_t)node)->next : (void *)((listNode_t)node)->next;
+}
+
+static void *RICK45BLISTS_ParallelWorker(void *arg)
+{
+    struct parallelChunk *chunk = arg;
+    void *node = chunk->first;
+    size_t cnt;
+    chunk->result = 0;
+    for (cnt = 0; cnt<chunk->count && chunk->result != -1; cnt++)
+    {
+        void *key = chunk->doubleNodes ? ((doubleListNode_t)node)->key : ((listNode_t)node)->key;
+        if (chunk->funct != NULL)
+            chunk->result = chunk->funct(node, chunk->opt);
+        else if (chunk->map != NULL)
+        {
+            chunk->results[chunk->position+cnt] = chunk->map(key, chunk->opt);
+            if (chunk->results[chunk->position+cnt] == NULL)
+                chunk->result = -1;
+        }
+        else
+            chunk->result = chunk->fold(chunk->acc, key, chunk->opt);
+        node = RICK45BLISTS_ChunkNext(node, chunk->doubleNodes);
+    }
+    return NULL;
+}
+
+/*
+ * splits the 'size' nodes starting from 'head' into (at most) 'threads' chunks, and runs 'job' on each of them: the
+ * first one on the calling thread, the others on their own threads. Every chunk gets the next accumulator, if any.
+*/
+static int RICK45BLISTS_RunParallel(void *head, size_t size, struct parallelChunk const *job, size_t threads)
+{
+    struct parallelChunk chunks[RICK45BLISTS_MAX_THREADS];
+    size_t nChunks = threads<size ? threads : size;
+    size_t c, position = 0;
+    void *node = head;
+
+    /*a single walk finds where every chunk starts*/
+    for (c = 0; c<nChunks; c++)
+    {
+        size_t start = c*size/nChunks;
+        for (; position<start; position++)
+            node = RICK45BLISTS_ChunkNext(node, job->doubleNodes);
+        chunks[c] = *job;
+        chunks[c].first = node;
+        chunks[c].position = start;
+        chunks[c].count = (c+1)*size/nChunks-start;
+        if (job->acc != NULL)
+            chunks[c].acc = (char *)job->acc+c*job->accSize;
+    }
+
+#ifndef RICK45B_NO_THREADS
+    pthread_t workers[RICK45BLISTS_MAX_THREADS];
+    int started[RICK45BLISTS_MAX_THREADS];
+    for (c = 1; c<nChunks; c++)
+        started[c] = pthread_create(&workers[c], NULL, RICK45BLISTS_ParallelWorker, &chunks[c]) == 0;
+    if (nChunks > 0)
+        RICK45BLISTS_ParallelWorker(&chunks[0]);
+    for (c = 1; c<nChunks; c++)
+    {
+        if (started[c])
+            pthread_join(workers[c], NULL);
+        else    /*no thread could be started for this chunk: the calling thread walks it*/
+            RICK45BLISTS_ParallelWorker(&chunks[c]);
+    }
+#else
+    for (c = 0; c<nChunks; c++)
+        RICK45BLISTS_ParallelWorker(&chunks[c]);
+#endif
+
+    for (c = 0; c<nChunks; c++)
+        if (chunks[c].result == -1)
+        {
+            RICK45B_SetError(RICK45B_ERR_CALLBACK, "Provided function error!");
+            return -1;
+        }
+    return 0;
+}
+
+/*checks the arguments shared by every parallel function, and returns the number of threads to use (0 on error).*/
+static size_t RICK45BLISTS_ParallelThreads(int missingFunct, size_t threads)
+{
+    if (missingFunct)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: funct cannot be NULL!");
+        return 0;
+    }
+    if (threads > RICK45BLISTS_MAX_THREADS)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: too many threads, the limit is RICK45BLISTS_MAX_THREADS!");
+        return 0;
+    }
+    return threads!=0 ? threads : 1;
+}
+
+/*runs a reduce on the given nodes, and then combines the accumulators into the first one.*/
+static int RICK45BLISTS_ParallelReduce(void *head, size_t size, int doubleNodes, RICK45B_combine_t fold, RICK45B_combine_t combine, void *accumulators, size_t accSize, void *opt, size_t threads)
+{
+    if (combine == NULL || accumulators == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: combine and accumulators cannot be NULL!");
+        return -1;
+    }
+    struct parallelChunk job = {NULL, 0, 0, FALSE, NULL, NULL, NULL, NULL, NULL, 0, NULL, 0};
+    job.doubleNodes = doubleNodes;
+    job.fold = fold;
+    job.acc = accumulators;
+    job.accSize = accSize;
+    job.opt = opt;
+    if (RICK45BLISTS_RunParallel(head, size, &job, threads) == -1)
+        return -1;
+    size_t c;
+    for (c = 1; c<threads; c++)
+        if (combine(accumulators, (char *)accumulators+c*accSize, opt) == -1)
+        {
+            RICK45B_SetError(RICK45B_ERR_CALLBACK, "Provided function error!");
+            return -1;
+        }
+    return 0;
+}
+
+int RICK45BLISTS_ListParallelforEach(list_t linkedList, RICK45B_forEach_t funct, void *opt, size_t threads)
+{
+    if (linkedList == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list.");
+        return -1;
+    }
+    threads = RICK45BLISTS_ParallelThreads(funct == NULL, threads);
+    if (threads == 0)
+        return -1;
+    struct parallelChunk job = {NULL, 0, 0, FALSE, NULL, NULL, NULL, NULL, NULL, 0, NULL, 0};
+    job.funct = funct;
+    job.opt = opt;
+    RICK45BLISTS_HashIndexInvalidate(linkedList);     /*the keys may change*/
+    return RICK45BLISTS_RunParallel(linkedList->head, linkedList->size, &job, threads);
+}
+
+list_t RICK45BLISTS_ListParallelMap(list_t linkedList, RICK45B_map_t funct, void *opt, size_t threads)
+{
+    if (linkedList == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list.");
+        return NULL;
+    }
+    threads = RICK45BLISTS_ParallelThreads(funct == NULL, threads);
+    if (threads == 0)
+        return NULL;
+    if (linkedList->size == 0)
+        return RICK45BLISTS_ListFromArray(NULL, 0, linkedList->key_cmp, &linkedList->allocator);
+
+    void **results = RICK45B_Alloc(&linkedList->allocator, sizeof(void *)*linkedList->size);
+    if (results == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NO_MEMORY, "Fatal Error: Cannot allocate memory for the array of keys. Maybe the heap is full?");
+        return NULL;
+    }
+    struct parallelChunk job = {NULL, 0, 0, FALSE, NULL, NULL, NULL, NULL, NULL, 0, NULL, 0};
+    job.map = funct;
+    job.results = results;
+    job.opt = opt;
+    list_t out = NULL;
+    if (RICK45BLISTS_RunParallel(linkedList->head, linkedList->size, &job, threads) == 0)
+        out = RICK45BLISTS_ListFromArray(results, linkedList->size, linkedList->key_cmp, &linkedList->allocator);
+    RICK45B_Free(&linkedList->allocator, results);
+    return out;
+}
+
+int RICK45BLISTS_ListParallelReduce(list_t linkedList, RICK45B_combine_t fold, RICK45B_combine_t combine, void *accumulators, size_t accSize, void *opt, size_t threads)
+{
+    if (linkedList == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list.");
+        return -1;
+    }
+    threads = RICK45BLISTS_ParallelThreads(fold == NULL, threads);
+    if (threads == 0)
+        return -1;
+    return RICK45BLISTS_ParallelReduce(linkedList->head, linkedList->size, FALSE, fold, combine, accumulators, accSize, opt, threads);
+}
+
 listNode_t RICK45BLISTS_GetNextNode(list_t linkedList)
 {
     if (linkedList == NULL)
     {
-        RICK45B_CopyString("Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list.", RICK45B.GetError, sizeof("Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list."));
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list.");
         return NULL;
     }
     if (RICK45BLISTS_GetListSize(linkedList)==0)
     {
-        RICK45B_CopyString("List is empty!", RICK45B.GetError, sizeof("List is empty!"));
+        RICK45B_SetError(RICK45B_ERR_EMPTY, "List is empty!");
         return NULL;
     }
     if (linkedList->pointedNode->next!=NULL)
@@ -81,12 +553,12 @@ int RICK45BLISTS_HasNext(list_t linkedList)
 {
     if (linkedList == NULL)
     {
-        RICK45B_CopyString("Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list.", RICK45B.GetError, sizeof("Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list."));
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list.");
         return -1;
     }
     if (RICK45BLISTS_GetListSize(linkedList)==0)
     {
-        RICK45B_CopyString("List is empty!", RICK45B.GetError, sizeof("List is empty!"));
+        RICK45B_SetError(RICK45B_ERR_EMPTY, "List is empty!");
         return -1;
     }
     return linkedList->pointedNode->next!=NULL?1:0;
@@ -96,12 +568,12 @@ listNode_t RICK45BLISTS_GetCurrentNode(list_t linkedList)
 {
     if (linkedList == NULL)
     {
-        RICK45B_CopyString("Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list.", RICK45B.GetError, sizeof("Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list."));
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list.");
         return NULL;
     }
     if (RICK45BLISTS_GetListSize(linkedList)==0)
     {
-        RICK45B_CopyString("List is empty!", RICK45B.GetError, sizeof("List is empty!"));
+        RICK45B_SetError(RICK45B_ERR_EMPTY, "List is empty!");
         return NULL;
     }
 
@@ -112,12 +584,12 @@ int RICK45BLISTS_RewindList(list_t linkedList)
 {
     if (linkedList == NULL)
     {
-        RICK45B_CopyString("Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list.", RICK45B.GetError, sizeof("Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list."));
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list.");
         return -1;
     }
     if (RICK45BLISTS_GetListSize(linkedList)==0 || linkedList->head == NULL)
     {
-        RICK45B_CopyString("List is empty!", RICK45B.GetError, sizeof("List is empty!"));
+        RICK45B_SetError(RICK45B_ERR_EMPTY, "List is empty!");
         return -1;
     }
 
@@ -127,25 +599,118 @@ int RICK45BLISTS_RewindList(list_t linkedList)
     return 0;
 }
 
+int RICK45BLISTS_IteratorInit(listIterator_t iterator, list_t linkedList)
+{
+    if (iterator == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: iterator cannot be NULL!");
+        return -1;
+    }
+    if (linkedList == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list.");
+        return -1;
+    }
+    iterator->linkedList = linkedList;
+    iterator->next = linkedList->head;
+    iterator->current = NULL;
+    iterator->previous = NULL;
+    return 0;
+}
+
+int RICK45BLISTS_IteratorHasNext(listIterator_t iterator)
+{
+    if (iterator == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: iterator cannot be NULL!");
+        return -1;
+    }
+    return iterator->next!=NULL?1:0;
+}
+
+listNode_t RICK45BLISTS_IteratorNext(listIterator_t iterator)
+{
+    if (iterator == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: iterator cannot be NULL!");
+        return NULL;
+    }
+    listNode_t out = iterator->next;
+    if (out != NULL)
+    {
+        if (iterator->current != NULL)
+            iterator->previous = iterator->current;
+        iterator->current = out;
+        iterator->next = out->next;
+    }
+    return out;
+}
+
+int RICK45BLISTS_IteratorAdd(listIterator_t iterator, void *key)
+{
+    if (iterator == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: iterator cannot be NULL!");
+        return -1;
+    }
+    if (key == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: key cannot be NULL!");
+        return -1;
+    }
+    listNode_t node = RICK45B_Alloc(&iterator->linkedList->nodeAllocator, sizeof(struct listNode));
+    if (node == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NO_MEMORY, "Fatal Error: Cannot allocate memory for new node. Maybe the heap is full?");
+        return -1;
+    }
+    node->key = key;
+    /*the new node goes right before the one the next step will return*/
+    listNode_t prev = iterator->current!=NULL ? iterator->current : iterator->previous;
+    RICK45BLISTS_LinkAfter(iterator->linkedList, prev, node);
+    iterator->previous = node;
+    iterator->current = NULL;
+    return 0;
+}
+
+int RICK45BLISTS_IteratorRemove(listIterator_t iterator, int delete_bool)
+{
+    if (iterator == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: iterator cannot be NULL!");
+        return -1;
+    }
+    if (iterator->current == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: the iterator has no node to remove! Please consider calling RICK45BLISTS_IteratorNext first.");
+        return -1;
+    }
+    RICK45BLISTS_UnlinkAfter(iterator->linkedList, iterator->previous, delete_bool);
+    iterator->current = NULL;
+    return 0;
+}
+
 int RICK45BLISTS_HeadAddListNode(void *key, list_t linkedList){
 
     if (linkedList == NULL)
     {
-        RICK45B_CopyString("Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list.", RICK45B.GetError, sizeof("Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list."));
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list.");
         return -1;
     }
     if (key == NULL)
     {
-        RICK45B_CopyString("Invalid Argument: key cannot be NULL!", RICK45B.GetError, sizeof("Invalid Argument: key cannot be NULL!"));
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: key cannot be NULL!");
         return -1;
     }
+    if (linkedList->index != NULL && linkedList->index->valid)
+        return RICK45BLISTS_SkipIndexInsert(linkedList, key, 0);
 
     listNode_t node = NULL;
-    node = mallocFun(sizeof(struct listNode));
+    node = RICK45B_Alloc(&linkedList->nodeAllocator, sizeof(struct listNode));
 
     if (node == NULL)
     {
-        RICK45B_CopyString("Fatal Error: Cannot allocate memory for new node. Maybe the heap is full?", RICK45B.GetError, sizeof("Fatal Error: Cannot allocate memory for new node. Maybe the heap is full?"));
+        RICK45B_SetError(RICK45B_ERR_NO_MEMORY, "Fatal Error: Cannot allocate memory for new node. Maybe the heap is full?");
         return -1;
     }
 
@@ -158,9 +723,14 @@ int RICK45BLISTS_HeadAddListNode(void *key, list_t linkedList){
         linkedList->tail = node;
     }
     else
+    {
+        if (linkedList->head == linkedList->tail)   /*the new head comes right before the tail*/
+            linkedList->tailPrevious = node;
         linkedList->head = node;
+    }
 
     linkedList->size++;
+    RICK45BLISTS_HashIndexInsert(linkedList, node);
     return 0;
 }
 
@@ -168,18 +738,20 @@ int RICK45BLISTS_TailAddListNode(void *key, list_t linkedList){
 
     if (linkedList == NULL)
     {
-        RICK45B_CopyString("Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list.", RICK45B.GetError, sizeof("Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list."));
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list.");
         return -1;
     }
     if (key == NULL)
     {
-        RICK45B_CopyString("Invalid Argument: key cannot be NULL!", RICK45B.GetError, sizeof("Invalid Argument: key cannot be NULL!"));
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: key cannot be NULL!");
         return -1;
     }
-    listNode_t node = mallocFun(sizeof(struct listNode));
+    if (linkedList->index != NULL && linkedList->index->valid)
+        return RICK45BLISTS_SkipIndexInsert(linkedList, key, linkedList->size);
+    listNode_t node = RICK45B_Alloc(&linkedList->nodeAllocator, sizeof(struct listNode));
     if (node == NULL)
     {
-        RICK45B_CopyString("Fatal Error: Cannot allocate memory for new node. Maybe the heap is full?", RICK45B.GetError, sizeof("Fatal Error: Cannot allocate memory for new node. Maybe the heap is full?"));
+        RICK45B_SetError(RICK45B_ERR_NO_MEMORY, "Fatal Error: Cannot allocate memory for new node. Maybe the heap is full?");
         return -1;
     }
 
@@ -194,10 +766,12 @@ int RICK45BLISTS_TailAddListNode(void *key, list_t linkedList){
     else
     {
         linkedList->tail->next = node;
+        linkedList->tailPrevious = linkedList->tail;
         linkedList->tail = node;
     }
 
     linkedList->size++;
+    RICK45BLISTS_HashIndexInsert(linkedList, node);
     return 0;
 }
 
@@ -205,20 +779,26 @@ int RICK45BLISTS_AddListNode(void *key, list_t linkedList, size_t position){
 
     if (linkedList == NULL)
     {
-        RICK45B_CopyString("Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list.", RICK45B.GetError, sizeof("Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list."));
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list.");
         return -1;
     }
     if (key == NULL)
     {
-        RICK45B_CopyString("Invalid Argument: key cannot be NULL!", RICK45B.GetError, sizeof("Invalid Argument: key cannot be NULL!"));
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: key cannot be NULL!");
         return -1;
     }
 
     if (position > linkedList->size)
     {
-        RICK45B_CopyString("Invalid Argument: Position value out of range for the given linkedList!", RICK45B.GetError, sizeof("Invalid Argument: Position value out of range for the given linkedList!"));
+        RICK45B_SetError(RICK45B_ERR_OUT_OF_RANGE, "Invalid Argument: Position value out of range for the given linkedList!");
         return -1;
     }
+    if (linkedList->index != NULL)
+    {
+        if (!linkedList->index->valid)
+            RICK45BLISTS_SkipIndexRebuild(linkedList);
+        return RICK45BLISTS_SkipIndexInsert(linkedList, key, position);
+    }
 
     if (position == linkedList->size)
         RICK45BLISTS_TailAddListNode(key, linkedList);
@@ -227,22 +807,9 @@ int RICK45BLISTS_AddListNode(void *key, list_t linkedList, size_t position){
         if (position == 0)
             RICK45BLISTS_HeadAddListNode(key, linkedList);
         else
-        {
-            listNode_t node = NULL;
-            node = mallocFun(sizeof(struct listNode));
-            if (node==NULL)
-            {
-                RICK45B_CopyString("Fatal Error: Cannot allocate memory for new node. Maybe the heap is full?", RICK45B.GetError, sizeof("Fatal Error: Cannot allocate memory for new node. Maybe the heap is full?"));
-                return -1;
-            }
-
-            node->key = key;
-            node->next = RICK45BLISTS_GetNodeByPosition(linkedList, position);
-            RICK45BLISTS_GetNodeByPosition(linkedList, position-1)->next = node;
-            linkedList->size++;
-        }
-    }
-    return 0;
+            return RICK45BLISTS_AddListNodeAfter(key, linkedList, RICK45BLISTS_GetNodeByPosition(linkedList, position-1));
+    }
+    return 0;
 
 }
 
@@ -256,18 +823,26 @@ listNode_t RICK45BLISTS_GetNodeByPosition(list_t linkedList, size_t position){
 
     if (linkedList == NULL)
     {
-        RICK45B_CopyString("Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list.", RICK45B.GetError, sizeof("Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list."));
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list.");
         return NULL;
     }
 
     int i = 0;
     listNode_t temp = linkedList->head;
 
-    if (position > linkedList->size)
+    if (position >= linkedList->size)
     {
-        RICK45B_CopyString("Invalid Argument: Position value out of range for the given linkedList!", RICK45B.GetError, sizeof("Invalid Argument: Position value out of range for the given linkedList!"));
+        RICK45B_SetError(RICK45B_ERR_OUT_OF_RANGE, "Invalid Argument: Position value out of range for the given linkedList!");
         return NULL;
     }
+    if (linkedList->index != NULL)
+    {
+        struct skipTower *update[RICK45BLISTS_SKIP_MAX_LEVEL];
+        size_t ranks[RICK45BLISTS_SKIP_MAX_LEVEL];
+        if (!linkedList->index->valid)
+            RICK45BLISTS_SkipIndexRebuild(linkedList);
+        return RICK45BLISTS_SkipIndexSeek(linkedList, position+1, update, ranks);
+    }
 
     if (position==0)
         return linkedList->head;
@@ -290,25 +865,79 @@ listNode_t RICK45BLISTS_GetNodeByPosition(list_t linkedList, size_t position){
 
 }
 
+/*scans the list for the first node with the given key, and moves it as the list's search mode says.*/
+static listNode_t RICK45BLISTS_SelfOrganizingFind(list_t linkedList, void *key)
+{
+    listNode_t before = NULL, prev = NULL, node = linkedList->head;
+    while (node != NULL && linkedList->key_cmp(node->key, key))
+    {
+        before = prev;
+        prev = node;
+        node = node->next;
+    }
+    if (node == NULL || prev == NULL)   /*not found, or already the head*/
+        return node;
+
+    prev->next = node->next;
+    if (node == linkedList->tail)
+    {
+        linkedList->tail = prev;
+        linkedList->tailPrevious = before;
+    }
+    else if (node == linkedList->tailPrevious)
+        linkedList->tailPrevious = prev;
+
+    if (linkedList->searchMode == RICK45BLISTS_SEARCH_TRANSPOSE && before != NULL)
+    {
+        node->next = prev;
+        before->next = node;
+    }
+    else
+    {
+        node->next = linkedList->head;
+        linkedList->head = node;
+    }
+    if (node->next == linkedList->tail)
+        linkedList->tailPrevious = node;
+    return node;
+}
+
 listNode_t RICK45BLISTS_GetNodeByKey(list_t linkedList, void* key){
 
     if (linkedList == NULL)
     {
-        RICK45B_CopyString("Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list.", RICK45B.GetError, sizeof("Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list."));
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list.");
         return NULL;
     }
     if (key == NULL)
     {
-        RICK45B_CopyString("Invalid Argument: key cannot be NULL!", RICK45B.GetError, sizeof("Invalid Argument: key cannot be NULL!"));
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: key cannot be NULL!");
         return NULL;
     }
     if (linkedList->head == NULL && linkedList->tail == NULL)
     {
-        RICK45B_CopyString("RICK45BLISTS_GetNodeByKey error: no key can be found!", RICK45B.GetError, sizeof("RICK45BLISTS_GetNodeByKey error: no key can be found!"));
+        RICK45B_SetError(RICK45B_ERR_NOT_FOUND, "RICK45BLISTS_GetNodeByKey error: no key can be found!");
         return NULL;     /*no keys can be found*/
     }
 
     listNode_t temp = NULL;
+    switch (RICK45BLISTS_HashIndexFind(linkedList, key, &temp))
+    {
+        case 0:
+            RICK45B_SetError(RICK45B_ERR_NOT_FOUND, "RICK45BLISTS_GetNodeByKey error: no key can be found!");
+            return NULL;
+        case 1:
+            return temp;
+        default:    /*no index, or more nodes with that key: the first one is found by the scan*/
+            break;
+    }
+    if (linkedList->searchMode != RICK45BLISTS_SEARCH_PLAIN)
+    {
+        temp = RICK45BLISTS_SelfOrganizingFind(linkedList, key);
+        if (temp == NULL)
+            RICK45B_SetError(RICK45B_ERR_NOT_FOUND, "RICK45BLISTS_GetNodeByKey error: no key can be found!");
+        return temp;
+    }
 
     if (linkedList->key_cmp(linkedList->head->key, key)==0)
         temp = linkedList->head;
@@ -326,21 +955,21 @@ listNode_t RICK45BLISTS_GetNodeByKey(list_t linkedList, void* key){
 
     if (temp == NULL)
     {
-        RICK45B_CopyString("RICK45BLISTS_GetNodeByKey error: no key can be found!", RICK45B.GetError, sizeof("RICK45BLISTS_GetNodeByKey error: no key can be found!"));
+        RICK45B_SetError(RICK45B_ERR_NOT_FOUND, "RICK45BLISTS_GetNodeByKey error: no key can be found!");
         return NULL;     /*no keys can be found*/
     }
 
     if (linkedList->key_cmp(temp->key, key)==0)
         return temp;
 
-    RICK45B_CopyString("RICK45BLISTS_GetNodeByKey error: no key can be found!", RICK45B.GetError, sizeof("RICK45BLISTS_GetNodeByKey error: no key can be found!"));
+    RICK45B_SetError(RICK45B_ERR_NOT_FOUND, "RICK45BLISTS_GetNodeByKey error: no key can be found!");
     return NULL;
 }
 
 void *RICK45BLISTS_GetKeyByNode(listNode_t node){
     if (node==NULL)
     {
-        RICK45B_CopyString("Invalid Argument: Node cannot be NULL!", RICK45B.GetError, sizeof("Invalid Argument: Node cannot be NULL!"));
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: Node cannot be NULL!");
         return NULL;
     }
 
@@ -349,62 +978,29 @@ void *RICK45BLISTS_GetKeyByNode(listNode_t node){
 
 void *RICK45BLISTS_GetKeyByPosition(list_t linkedList, size_t position){
 
-    if (linkedList == NULL)
-    {
-        RICK45B_CopyString("Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list.", RICK45B.GetError, sizeof("Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list."));
-        return NULL;
-    }
-
-    if (position > linkedList->size)
-    {
-        RICK45B_CopyString("Invalid Argument: Position value out of range for the given linkedList!", RICK45B.GetError, sizeof("Invalid Argument: Position value out of range for the given linkedList!"));
+    listNode_t node = RICK45BLISTS_GetNodeByPosition(linkedList, position);
+    if (node == NULL)
         return NULL;
-    }
-
-    if (position==0)
-        return linkedList->head->key;
-    if (position == linkedList->size)
-        return linkedList->tail->key;
-
-    int i = 0;
-    listNode_t temp = linkedList->head;
-
-    if (temp == NULL)
-    {
-        RICK45B_CopyString("RICK45BLISTS_GetNodeByKey error: no key can be found!", RICK45B.GetError, sizeof("RICK45BLISTS_GetNodeByKey error: no key can be found!"));
-        return NULL;     /*no keys can be found*/
-    }
-
-    while (temp->next!=NULL && i<(int)position)
-    {
-        temp = temp->next;
-        i++;
-    }
-
-    if (i==(int)position)
-        return temp->key;
-
-    RICK45B_CopyString("RICK45BLISTS_GetNodeByKey error: no key can be found!", RICK45B.GetError, sizeof("RICK45BLISTS_GetNodeByKey error: no key can be found!"));
-    return NULL;
+    return node->key;
 }
 
 void *RICK45BLISTS_SetKeyByPosition(list_t linkedList, void* newkey, size_t position)
 {
     if (linkedList == NULL)
     {
-        RICK45B_CopyString("Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list.", RICK45B.GetError, sizeof("Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list."));
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list.");
         return NULL;
     }
 
     if (position > linkedList->size)
     {
-        RICK45B_CopyString("Invalid Argument: Position value out of range for the given linkedList!", RICK45B.GetError, sizeof("Invalid Argument: Position value out of range for the given linkedList!"));
+        RICK45B_SetError(RICK45B_ERR_OUT_OF_RANGE, "Invalid Argument: Position value out of range for the given linkedList!");
         return NULL;
     }
 
     if (newkey == NULL)
     {
-        RICK45B_CopyString("Invalid Argument: new key cannot be NULL!", RICK45B.GetError, sizeof("Invalid Argument: new key cannot be NULL!"));
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: new key cannot be NULL!");
         return NULL;
     }
 
@@ -412,12 +1008,14 @@ void *RICK45BLISTS_SetKeyByPosition(list_t linkedList, void* newkey, size_t posi
     temp = RICK45BLISTS_GetNodeByPosition(linkedList, position);
     if (temp == NULL)
     {
-        RICK45B_CopyString("Fatal error: couldn't fetch node at that position!", RICK45B.GetError, sizeof("Fatal error: couldn't fetch node at that position!"));
+        RICK45B_SetError(RICK45B_ERR_INTERNAL, "Fatal error: couldn't fetch node at that position!");
         return NULL;
     }
 
     void *out = temp->key;
+    RICK45BLISTS_HashIndexRemove(linkedList, temp);
     temp->key = newkey;
+    RICK45BLISTS_HashIndexInsert(linkedList, temp);
     return out;
 }
 
@@ -425,25 +1023,25 @@ void *RICK45BLISTS_SetKeyByNode(list_t linkedList, void* newkey, listNode_t node
 {
     if (linkedList == NULL)
     {
-        RICK45B_CopyString("Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list.", RICK45B.GetError, sizeof("Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list."));
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list.");
         return NULL;
     }
 
     if (node == NULL)
     {
-        RICK45B_CopyString("Fatal error: Node cannot be NULL!", RICK45B.GetError, sizeof("Fatal error: Node cannot be NULL!"));
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Fatal error: Node cannot be NULL!");
         return NULL;
     }
 
     if (newkey == NULL)
     {
-        RICK45B_CopyString("Invalid Argument: new key cannot be NULL!", RICK45B.GetError, sizeof("Invalid Argument: new key cannot be NULL!"));
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: new key cannot be NULL!");
         return NULL;
     }
 
     if (linkedList->head == NULL)
     {
-        RICK45B_CopyString("Head of the list is NULL! Please consider adding some nodes first!", RICK45B.GetError, sizeof("Head of the list is NULL! Please consider adding some nodes first!"));
+        RICK45B_SetError(RICK45B_ERR_EMPTY, "Head of the list is NULL! Please consider adding some nodes first!");
         return NULL;
     }
 
@@ -463,7 +1061,9 @@ void *RICK45BLISTS_SetKeyByNode(list_t linkedList, void* newkey, listNode_t node
     }
 
     void *out = node->key;
+    RICK45BLISTS_HashIndexRemove(linkedList, temp);
     temp->key = newkey;
+    RICK45BLISTS_HashIndexInsert(linkedList, temp);
     return out;
 }
 
@@ -471,13 +1071,13 @@ int RICK45BLISTS_SetKeyByKey(list_t linkedList, void* newkey, void* oldkey)
 {
     if (linkedList == NULL)
     {
-        RICK45B_CopyString("Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list.", RICK45B.GetError, sizeof("Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list."));
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list.");
         return -1;
     }
 
     if (newkey == NULL || oldkey == NULL)
     {
-        RICK45B_CopyString("Fatal Error: keys cannot be NULL!", RICK45B.GetError, sizeof("Fatal Error: keys cannot be NULL!"));
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Fatal Error: keys cannot be NULL!");
         return -1;
     }
     int cnt = 0;
@@ -490,7 +1090,9 @@ int RICK45BLISTS_SetKeyByKey(list_t linkedList, void* newkey, void* oldkey)
     {
         if (linkedList->key_cmp(temp->key, oldkey)==0)
         {
+            RICK45BLISTS_HashIndexRemove(linkedList, temp);
             temp->key = newkey;
+            RICK45BLISTS_HashIndexInsert(linkedList, temp);
             cnt++;
         }
         temp = temp->next;
@@ -502,9 +1104,14 @@ int RICK45BLISTS_RemoveHead(list_t linkedList, int delete_bool){
 
     if (linkedList == NULL)
     {
-        RICK45B_CopyString("Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list.", RICK45B.GetError, sizeof("Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list."));
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list.");
         return -1;
     }
+    if (linkedList->index != NULL && linkedList->index->valid && linkedList->head != NULL)
+    {
+        RICK45BLISTS_SkipIndexRemove(linkedList, 0, delete_bool);
+        return 0;
+    }
 
     if (linkedList->head != NULL)
     {
@@ -515,21 +1122,25 @@ int RICK45BLISTS_RemoveHead(list_t linkedList, int delete_bool){
             if (linkedList->pointedNode == linkedList->head)
                 linkedList->pointedNode = NULL;
             linkedList->head = NULL;
+            linkedList->tail = NULL;
         }
         else
         {
+            if (linkedList->tailPrevious == linkedList->head)   /*only the tail will be left*/
+                linkedList->tailPrevious = NULL;
             /*updating the 'pointed node' field*/
             if (linkedList->pointedNode == linkedList->head)
                 linkedList->pointedNode = linkedList->head->next;
             linkedList->head = linkedList->head->next;
         }
 
+        RICK45BLISTS_HashIndexRemove(linkedList, temp);
         if (delete_bool==FALSE)
-            freeFun(temp);
+            RICK45B_Free(&linkedList->nodeAllocator, temp);
         else
         {
             freeFun(temp->key);
-            freeFun(temp);
+            RICK45B_Free(&linkedList->nodeAllocator, temp);
         }
         linkedList->size--;
     }
@@ -544,19 +1155,24 @@ int RICK45BLISTS_RemoveNode(list_t linkedList, size_t position, int delete_bool)
 {
     if (linkedList == NULL)
     {
-        RICK45B_CopyString("Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list.", RICK45B.GetError, sizeof("Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list."));
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list.");
         return -1;
     }
 
     if (linkedList->head != NULL)
     {
-        if (position > linkedList->size)    /*position is out of bound!!*/
+        if (position >= linkedList->size)    /*position is out of bound!!*/
         {
-            RICK45B_CopyString("Invalid Argument: Position value out of range for the given linkedList!", RICK45B.GetError, sizeof("Invalid Argument: Position value out of range for the given linkedList!"));
+            RICK45B_SetError(RICK45B_ERR_OUT_OF_RANGE, "Invalid Argument: Position value out of range for the given linkedList!");
             return -1;
         }
-
-        listNode_t temp = NULL;
+        if (linkedList->index != NULL)
+        {
+            if (!linkedList->index->valid)
+                RICK45BLISTS_SkipIndexRebuild(linkedList);
+            RICK45BLISTS_SkipIndexRemove(linkedList, position, delete_bool);
+            return 0;
+        }
 
         if (position == linkedList->size-1)   /*i want to delete the tail!*/
             RICK45BLISTS_RemoveTail(linkedList, delete_bool);
@@ -565,29 +1181,14 @@ int RICK45BLISTS_RemoveNode(list_t linkedList, size_t position, int delete_bool)
             if (position == 0)  /*i want to delete the head!*/
                 RICK45BLISTS_RemoveHead(linkedList, delete_bool);
             else
-            {
-                listNode_t tempPrev = NULL;
-                temp = RICK45BLISTS_GetNodeByPosition(linkedList, position);
-                tempPrev = RICK45BLISTS_GetNodeByPosition(linkedList, position-1);
-                if (temp == linkedList->pointedNode)
-                    linkedList->pointedNode = tempPrev;
-                tempPrev->next = temp->next;
-                if (delete_bool == FALSE)
-                    freeFun(temp);
-                else
-                {
-                    freeFun(temp->key);
-                    freeFun(temp);
-                }
-                linkedList->size--;
-            }
+                RICK45BLISTS_UnlinkAfter(linkedList, RICK45BLISTS_GetNodeByPosition(linkedList, position-1), delete_bool);
         }
 
         return 0;
     }
     else
     {
-        RICK45B_CopyString("Head of the list is NULL! Please consider adding some nodes first!", RICK45B.GetError, sizeof("Head of the list is NULL! Please consider adding some nodes first!"));
+        RICK45B_SetError(RICK45B_ERR_EMPTY, "Head of the list is NULL! Please consider adding some nodes first!");
         linkedList->tail = NULL;  /*if head is null, the tail must be as well.*/
         return -1;
     }
@@ -599,6 +1200,8 @@ void RICK45BLISTS_RemoveAllNodes(list_t linkedList, int delete_bool){
 
     if (linkedList->size != 0)
     {
+        if (linkedList->index != NULL)  /*the towers go first, so the nodes are removed without updating them*/
+            RICK45BLISTS_SkipIndexClear(linkedList);
         listNode_t head = linkedList->head;
         while (head!=NULL)
         {
@@ -606,7 +1209,10 @@ void RICK45BLISTS_RemoveAllNodes(list_t linkedList, int delete_bool){
             head = linkedList->head;
         }
         linkedList->tail = NULL;
+        linkedList->tailPrevious = NULL;
         linkedList->pointedNode = NULL;
+        if (linkedList->index != NULL)
+            linkedList->index->valid = TRUE;
     }
 }
 
@@ -614,30 +1220,45 @@ int RICK45BLISTS_RemoveTail(list_t linkedList, int delete_bool){
 
     if (linkedList == NULL)
     {
-        RICK45B_CopyString("Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list.", RICK45B.GetError, sizeof("Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list."));
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list.");
         return -1;
     }
 
     if (linkedList->tail != NULL)
     {
-        listNode_t temp = NULL;
-        temp = RICK45BLISTS_GetNodeByPosition(linkedList, RICK45BLISTS_GetListSize(linkedList)-2);
+        if (linkedList->head == linkedList->tail)
+            return RICK45BLISTS_RemoveHead(linkedList, delete_bool);
+        if (linkedList->index != NULL && linkedList->index->valid)
+        {
+            RICK45BLISTS_SkipIndexRemove(linkedList, linkedList->size-1, delete_bool);
+            return 0;
+        }
+
+        listNode_t temp = linkedList->tailPrevious;
+        if (temp == NULL)   /*not known: looking for it*/
+        {
+            temp = linkedList->head;
+            while (temp->next != linkedList->tail)
+                temp = temp->next;
+        }
         temp -> next = NULL;
         if (linkedList->pointedNode == linkedList->tail)
             linkedList->pointedNode = temp;
 
+        RICK45BLISTS_HashIndexRemove(linkedList, linkedList->tail);
         if (delete_bool == TRUE)
             freeFun(linkedList->tail->key);
-        freeFun(linkedList->tail);
+        RICK45B_Free(&linkedList->nodeAllocator, linkedList->tail);
 
         linkedList->tail = temp;
+        linkedList->tailPrevious = NULL;   /*a single link can't be followed backwards*/
         linkedList->size--;
 
         return 0;
     }
     else                        /*if tail is null, head must be as well.*/
     {
-        RICK45B_CopyString("Tail of the list is NULL! Please consider adding some nodes first!", RICK45B.GetError, sizeof("Tail of the list is NULL! Please consider adding some nodes first!"));
+        RICK45B_SetError(RICK45B_ERR_EMPTY, "Tail of the list is NULL! Please consider adding some nodes first!");
         linkedList->head = NULL;
         return -1;
     }
@@ -647,13 +1268,13 @@ int RICK45BLISTS_RemoveNodeByKey(list_t linkedList, void *key, int delete_bool)
 {
     if (linkedList == NULL)
     {
-        RICK45B_CopyString("Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list.", RICK45B.GetError, sizeof("Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list."));
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list.");
         return -1;
     }
 
     if (key == NULL)
     {
-        RICK45B_CopyString("Invalid Argument: key cannot be NULL!", RICK45B.GetError, sizeof("Invalid Argument: key cannot be NULL!"));
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: key cannot be NULL!");
         return -1;
     }
 
@@ -664,6 +1285,9 @@ int RICK45BLISTS_RemoveNodeByKey(list_t linkedList, void *key, int delete_bool)
     {
         return 0;
     }
+    if (RICK45BLISTS_HashIndexFind(linkedList, key, &old) == 0)    /*no node with given key: no need to scan*/
+        return 0;
+    old = linkedList->head;
 
     while (temp->next!=NULL && linkedList->key_cmp(temp->key, key))
     {
@@ -673,783 +1297,3960 @@ int RICK45BLISTS_RemoveNodeByKey(list_t linkedList, void *key, int delete_bool)
 
     if (linkedList->key_cmp(temp->key, key)==0)   /*node with given key was found.*/
     {
-        if (linkedList->head == temp)
-            RICK45BLISTS_RemoveHead(linkedList, delete_bool);
-        else
-        {
-            if (linkedList->tail == temp)
-                RICK45BLISTS_RemoveTail(linkedList, delete_bool);
-            else
-            {
-                if (linkedList->pointedNode == temp)
-                    linkedList->pointedNode = old;
-                old->next = temp->next;
-                if (delete_bool == TRUE)
-                    freeFun(temp->key);
-                freeFun(temp);
-                linkedList->size--;
-            }
-        }
+        RICK45BLISTS_UnlinkAfter(linkedList, temp!=linkedList->head ? old : NULL, delete_bool);
 
         return 1;
     }
     return 0;
 }
 
+/*argument of the predicate used to remove the nodes by key.*/
+struct keyMatch{
+    RICK45B_comparator_t key_cmp;
+    void *key;
+};
+
+static int RICK45BLISTS_KeyMatches(const void *key, void *opt)
+{
+    struct keyMatch *match = opt;
+    return match->key_cmp(key, match->key)==0;
+}
+
 int RICK45BLISTS_RemoveAllNodesByKey(list_t linkedList, void *key, int delete_bool)
 {
-    int cnt = 0;
-    if (RICK45BLISTS_RemoveNodeByKey(linkedList, key, delete_bool)==-1)
+    if (linkedList == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list.");
         return -1;
-    cnt++;
-    while (RICK45BLISTS_RemoveNodeByKey(linkedList, key, delete_bool)>0)
-        cnt++;
-    return cnt;
+    }
+    if (key == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: key cannot be NULL!");
+        return -1;
+    }
+    struct keyMatch match = {linkedList->key_cmp, key};
+    return RICK45BLISTS_RemoveIfImpl(linkedList, RICK45BLISTS_KeyMatches, &match, delete_bool);
 }
 
-doubleList_t RICK45BLISTS_DoubleListCreate(RICK45B_comparator_t key_cmp)
+int RICK45BLISTS_RemoveIf(list_t linkedList, RICK45B_predicate_t pred, void *opt, int delete_bool)
 {
-    if (key_cmp == NULL)
+    if (linkedList == NULL)
     {
-        RICK45B_CopyString("Invalid Argument: key_cmp function cannot be NULL!", RICK45B.GetError, sizeof("Invalid Argument: key_cmp function cannot be NULL!"));
-        return NULL;
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list.");
+        return -1;
     }
-
-    doubleList_t out = NULL;
-    out = mallocFun(sizeof(struct doubleList));
-    out->head = NULL;
-    out->tail = NULL;
-    out->pointedNode = NULL;
-
-    if (out == NULL)
+    if (pred == NULL)
     {
-        RICK45B_CopyString("Fatal Error: Cannot allocate memory for new doubleList_t type. Maybe the heap is full?", RICK45B.GetError, sizeof("Fatal Error: Cannot allocate memory for new doubleList_t type. Maybe the heap is full?"));
-        return NULL;
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: pred cannot be NULL!");
+        return -1;
     }
-    out -> key_cmp = key_cmp;
-    out -> size = 0;
-    return out;
+    return RICK45BLISTS_RemoveIfImpl(linkedList, pred, opt, delete_bool);
 }
 
-void RICK45BLISTS_DoubleListDestroy(doubleList_t *dlinkedList, int delete_bool){
+int RICK45BLISTS_RemoveIfImpl(list_t linkedList, RICK45B_predicate_t pred, void *opt, int delete_bool)
+{
+    int cnt = 0;
+    listNode_t prev = NULL;
+    listNode_t node = linkedList->head;
+    while (node != NULL)
+    {
+        listNode_t next = node->next;
+        if (pred(node->key, opt))
+        {
+            RICK45BLISTS_UnlinkAfter(linkedList, prev, delete_bool);
+            cnt++;
+        }
+        else
+            prev = node;
+        node = next;
+    }
+    return cnt;
+}
 
-    if (dlinkedList != NULL)
+int RICK45BLISTS_ListSort(list_t linkedList)
+{
+    if (linkedList == NULL)
     {
-        RICK45BLISTS_DoubleListRemoveAllNodes(*dlinkedList, delete_bool);
-        freeFun(*dlinkedList);
-        *dlinkedList = NULL;
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list.");
+        return -1;
     }
+    if (linkedList->size < 2)
+        return 0;
 
+    listNode_t tail;
+    linkedList->head = RICK45BLISTS_MergeSortNodes(linkedList->head, linkedList->size, linkedList->key_cmp, &tail);
+    linkedList->tail = tail;
+    linkedList->tailPrevious = NULL;
+    if (linkedList->index != NULL)
+        linkedList->index->valid = FALSE;
+    return 0;
 }
 
-doubleListNode_t RICK45BLISTS_DoubleListGetNextNode(doubleList_t dlinkedList){
-
-    if (dlinkedList == NULL)
+int RICK45BLISTS_InsertSorted(void *key, list_t linkedList)
+{
+    if (linkedList == NULL)
     {
-        RICK45B_CopyString("Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list.", RICK45B.GetError, sizeof("Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list."));
-        return NULL;
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list.");
+        return -1;
     }
-    if (RICK45BLISTS_GetDoubleListSize(dlinkedList)==0)
+    if (key == NULL)
     {
-        RICK45B_CopyString("double linkedList is empty!", RICK45B.GetError, sizeof("double linkedList is empty!"));
-        return NULL;
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: key cannot be NULL!");
+        return -1;
     }
-    if (dlinkedList->pointedNode->next!=NULL)
-        dlinkedList->pointedNode = dlinkedList->pointedNode->next;
-    return dlinkedList->pointedNode;
-}
-
-doubleListNode_t RICK45BLISTS_DoubleListGetPreviousNode(doubleList_t dlinkedList){
 
-    if (dlinkedList == NULL)
+    /*looking for the last node with a key lower than or equal to the new one*/
+    listNode_t prev = NULL;
+    size_t position = 0;
+    if (linkedList->tail != NULL && linkedList->key_cmp(linkedList->tail->key, key) <= 0)
     {
-        RICK45B_CopyString("Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list.", RICK45B.GetError, sizeof("Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list."));
-        return NULL;
+        prev = linkedList->tail;
+        position = linkedList->size;
     }
-    if (RICK45BLISTS_GetDoubleListSize(dlinkedList)==0)
+    else
     {
-        RICK45B_CopyString("double linkedList is empty!", RICK45B.GetError, sizeof("double linkedList is empty!"));
-        return NULL;
+        listNode_t node = linkedList->head;
+        while (node != NULL && linkedList->key_cmp(node->key, key) <= 0)
+        {
+            prev = node;
+            node = node->next;
+            position++;
+        }
     }
-    if (dlinkedList->pointedNode->previous!=NULL)
-        dlinkedList->pointedNode = dlinkedList->pointedNode->previous;
-    return dlinkedList->pointedNode;
+
+    if (linkedList->index != NULL)     /*keeps the index up to date*/
+        return RICK45BLISTS_AddListNode(key, linkedList, position);
+    listNode_t newNode = RICK45B_Alloc(&linkedList->nodeAllocator, sizeof(struct listNode));
+    if (newNode == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NO_MEMORY, "Fatal Error: Cannot allocate memory for new node. Maybe the heap is full?");
+        return -1;
+    }
+    newNode->key = key;
+    RICK45BLISTS_LinkAfter(linkedList, prev, newNode);
+    return 0;
 }
 
-int RICK45BLISTS_DoubleListHasPrevious(doubleList_t dlinkedList){
+/*makes a list take its nodes from (a share of) the given node pool, dropping the pool it was using, if any.*/
+static void RICK45BLISTS_JoinNodePool(struct allocator *nodeAllocator, nodePool_t *pool, nodePool_t shared)
+{
+    shared = RICK45B_NodePoolMerged(shared);
+    if (*pool == shared)
+        return;
+    shared->refs++;
+    RICK45B_NodePoolDestroy(*pool);
+    *pool = shared;
+    *nodeAllocator = RICK45B_NodePoolAllocator(shared);
+}
 
-    if (dlinkedList == NULL)
+/*
+ * returns TRUE if the nodes of one list could be released by the other one, without changing either of them:
+ * lists without pools must use the same allocator, two pools must have the same node size and allocator, and
+ * a list without a pool can only join the pool of the other list if it's empty.
+*/
+static int RICK45BLISTS_NodeAllocatorsMatch(const struct allocator *a, nodePool_t poolA, size_t sizeA, const struct allocator *b, nodePool_t poolB, size_t sizeB)
+{
+    if (poolA == NULL && poolB == NULL)
+        return a->alloc_funct == b->alloc_funct && a->free_funct == b->free_funct && a->ctx == b->ctx;
+    if (poolA == NULL || poolB == NULL)
+        return (poolA == NULL && sizeA == 0) || (poolB == NULL && sizeB == 0);
+    poolA = RICK45B_NodePoolMerged(poolA);
+    poolB = RICK45B_NodePoolMerged(poolB);
+    return poolA->nodeSize == poolB->nodeSize && RICK45BLISTS_NodeAllocatorsMatch(&poolA->allocator, NULL, 0, &poolB->allocator, NULL, 0);
+}
+
+/*
+ * returns TRUE if the nodes of one list can be released by the other one, making them share a node pool if needed:
+ * lists without pools must use the same allocator, two pools are merged into one, and an empty list without a pool
+ * joins the pool of the other list.
+*/
+static int RICK45BLISTS_ShareNodeAllocator(struct allocator *a, nodePool_t *poolA, size_t sizeA, struct allocator *b, nodePool_t *poolB, size_t sizeB)
+{
+    if (!RICK45BLISTS_NodeAllocatorsMatch(a, *poolA, sizeA, b, *poolB, sizeB))
+        return FALSE;
+    if (*poolA == NULL && *poolB == NULL)
+        return TRUE;
+    if (*poolA == NULL || *poolB == NULL)
+    {
+        if (*poolA == NULL)     RICK45BLISTS_JoinNodePool(a, poolA, *poolB);
+        else    RICK45BLISTS_JoinNodePool(b, poolB, *poolA);
+        return TRUE;
+    }
+    if (RICK45B_NodePoolMerge(*poolA, *poolB) == -1)
+        return FALSE;
+    RICK45BLISTS_JoinNodePool(a, poolA, *poolA);    /*both lists now use the merged pool directly*/
+    RICK45BLISTS_JoinNodePool(b, poolB, *poolA);
+    return TRUE;
+}
+
+int RICK45BLISTS_Concat(list_t dst, list_t src)
+{
+    if (dst == NULL || src == NULL)
     {
-        RICK45B_CopyString("Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list.", RICK45B.GetError, sizeof("Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list."));
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list.");
         return -1;
     }
-    if (RICK45BLISTS_GetDoubleListSize(dlinkedList)==0)
+    if (dst == src || !RICK45BLISTS_ShareNodeAllocator(&dst->nodeAllocator, &dst->pool, dst->size, &src->nodeAllocator, &src->pool, src->size))
     {
-        RICK45B_CopyString("double linkedList is empty!", RICK45B.GetError, sizeof("double linkedList is empty!"));
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: the lists must be different, and take their nodes from the same allocator or from compatible node pools!");
         return -1;
     }
-    return dlinkedList->pointedNode->previous!=NULL?1:0;
-}
+    if (src->size == 0)
+        return 0;
 
-int RICK45BLISTS_DoubleListHasNext(doubleList_t dlinkedList){
+    if (dst->head == NULL)
+    {
+        dst->head = src->head;
+        dst->tailPrevious = src->tailPrevious;
+    }
+    else
+    {
+        dst->tail->next = src->head;
+        dst->tailPrevious = src->size>1 ? src->tailPrevious : dst->tail;
+    }
+    dst->tail = src->tail;
+    dst->size += src->size;
+
+    src->head = NULL;
+    src->tail = NULL;
+    src->tailPrevious = NULL;
+    src->pointedNode = NULL;
+    src->size = 0;
+    if (dst->index != NULL)
+        dst->index->valid = FALSE;
+    if (src->index != NULL)
+        src->index->valid = FALSE;
+    RICK45BLISTS_HashIndexInvalidate(dst);
+    RICK45BLISTS_HashIndexInvalidate(src);
+    return 0;
+}
 
-    if (dlinkedList == NULL)
+int RICK45BLISTS_SpliceAfter(list_t dst, listNode_t node, list_t src, listNode_t beforeFirst, listNode_t last)
+{
+    if (dst == NULL || src == NULL)
     {
-        RICK45B_CopyString("Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list.", RICK45B.GetError, sizeof("Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list."));
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list.");
         return -1;
     }
-    if (RICK45BLISTS_GetDoubleListSize(dlinkedList)==0)
+    if (dst == src || !RICK45BLISTS_NodeAllocatorsMatch(&dst->nodeAllocator, dst->pool, dst->size, &src->nodeAllocator, src->pool, src->size))
     {
-        RICK45B_CopyString("double linkedList is empty!", RICK45B.GetError, sizeof("double linkedList is empty!"));
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: the lists must be different, and take their nodes from the same allocator or from compatible node pools!");
         return -1;
     }
-    return dlinkedList->pointedNode->next!=NULL?1:0;
-}
-
-doubleListNode_t RICK45BLISTS_DoubleListGetCurrentNode(doubleList_t dlinkedList){
-
-    if (dlinkedList == NULL)
+    listNode_t first = beforeFirst!=NULL ? beforeFirst->next : src->head;
+    if (first == NULL || last == NULL)
     {
-        RICK45B_CopyString("Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list.", RICK45B.GetError, sizeof("Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list."));
-        return NULL;
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: the range of nodes to move is empty!");
+        return -1;
     }
-    if (RICK45BLISTS_GetDoubleListSize(dlinkedList)==0)
+
+    /*counting the range, which also checks that 'last' follows 'first'*/
+    size_t cnt = 1;
+    int movesPointed = first == src->pointedNode;
+    listNode_t temp = first, beforeLast = beforeFirst;
+    while (temp != last)
     {
-        RICK45B_CopyString("double linkedList is empty!", RICK45B.GetError, sizeof("double linkedList is empty!"));
-        return NULL;
+        beforeLast = temp;
+        temp = temp->next;
+        if (temp == NULL)
+        {
+            RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: 'last' doesn't follow 'first' inside the source list!");
+            return -1;
+        }
+        if (temp == src->pointedNode)
+            movesPointed = TRUE;
+        cnt++;
     }
 
-    return dlinkedList->pointedNode;
-}
-
-int RICK45BLISTS_RewindDoubleList(doubleList_t dlinkedList){
+    RICK45BLISTS_ShareNodeAllocator(&dst->nodeAllocator, &dst->pool, dst->size, &src->nodeAllocator, &src->pool, src->size);  /*the arguments are valid: pools can be shared now*/
 
-    if (dlinkedList == NULL)
+    /*unlinking the range from the source*/
+    if (beforeFirst == NULL)    src->head = last->next;
+    else    beforeFirst->next = last->next;
+    if (last == src->tail)
     {
-        RICK45B_CopyString("Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list.", RICK45B.GetError, sizeof("Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list."));
-        return -1;
+        src->tail = beforeFirst;
+        src->tailPrevious = NULL;   /*a single link can't be followed backwards*/
     }
-    if (RICK45BLISTS_GetDoubleListSize(dlinkedList)==0 || dlinkedList->head == NULL)
+    else if (last->next == src->tail)
+        src->tailPrevious = beforeFirst;
+    if (movesPointed)
+        src->pointedNode = beforeFirst!=NULL ? beforeFirst : last->next;
+    src->size -= cnt;
+
+    /*linking it into the destination*/
+    listNode_t next = node!=NULL ? node->next : dst->head;
+    last->next = next;
+    if (node == NULL)   dst->head = first;
+    else    node->next = first;
+    if (next == NULL)   /*new tail*/
     {
-        RICK45B_CopyString("double linkedList is empty!", RICK45B.GetError, sizeof("double linkedList is empty!"));
-        return -1;
+        dst->tailPrevious = cnt>1 ? beforeLast : node;
+        dst->tail = last;
     }
+    else if (next == dst->tail)
+        dst->tailPrevious = last;
+    dst->size += cnt;
 
-    dlinkedList->pointedNode = dlinkedList->head;
-    dlinkedList->pointedNode->previous = NULL;
+    if (dst->index != NULL)
+        dst->index->valid = FALSE;
+    if (src->index != NULL)
+        src->index->valid = FALSE;
+    RICK45BLISTS_HashIndexInvalidate(dst);
+    RICK45BLISTS_HashIndexInvalidate(src);
     return 0;
 }
 
-void RICK45BLISTS_DoubleListRemoveAllNodes(doubleList_t dlinkedList, int delete_bool){
-
-    doubleListNode_t head = dlinkedList->head;
-    while (head!=NULL)
+list_t RICK45BLISTS_SplitAfter(list_t linkedList, listNode_t node)
+{
+    if (linkedList == NULL)
     {
-        RICK45BLISTS_DoubleListRemoveHead(dlinkedList, delete_bool);
-        head = dlinkedList->head;
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list.");
+        return NULL;
     }
-    dlinkedList->tail = NULL;
-    dlinkedList->pointedNode = NULL;
-}
-
-int RICK45BLISTS_DoubleListRemoveHead(doubleList_t dlinkedList, int delete_bool){
+    list_t out = linkedList->index!=NULL ? RICK45BLISTS_IndexedListCreateWithAllocator(linkedList->key_cmp, &linkedList->allocator)
+                                         : RICK45BLISTS_ListCreateWithAllocator(linkedList->key_cmp, &linkedList->allocator);
+    if (out == NULL)
+        return NULL;
+    RICK45BLISTS_ShareNodeAllocator(&out->nodeAllocator, &out->pool, 0, &linkedList->nodeAllocator, &linkedList->pool, linkedList->size);
+    listNode_t first = node!=NULL ? node->next : linkedList->head;
+    if (first == NULL)
+        return out;
+
+    /*counting the moved nodes*/
+    size_t cnt = 0;
+    int movesPointed = FALSE;
+    listNode_t temp;
+    for (temp = first; temp != NULL; temp = temp->next)
+    {
+        if (temp == linkedList->pointedNode)
+            movesPointed = TRUE;
+        cnt++;
+    }
+    out->head = first;
+    out->tail = linkedList->tail;
+    out->tailPrevious = cnt>1 ? linkedList->tailPrevious : NULL;
+    out->size = cnt;
 
-    if (dlinkedList == NULL)
+    if (node == NULL)   linkedList->head = NULL;
+    else    node->next = NULL;
+    linkedList->tail = node;
+    linkedList->tailPrevious = NULL;
+    if (movesPointed)
+        linkedList->pointedNode = node;
+    linkedList->size -= cnt;
+    if (linkedList->index != NULL)
     {
-        RICK45B_CopyString("Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list.", RICK45B.GetError, sizeof("Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list."));
-        return -1;
+        linkedList->index->valid = FALSE;
+        out->index->valid = FALSE;
     }
+    RICK45BLISTS_HashIndexInvalidate(linkedList);
+    return out;
+}
 
-    if (dlinkedList->head != NULL)
-    {
-        doubleListNode_t temp = dlinkedList->head;
-        if (dlinkedList->head->next == NULL)
+/*
+ * merges the sorted 'src' into the sorted 'dst' by moving its nodes, leaving 'src' empty. On equal keys the node of
+ * 'dst' comes first, or the node of 'src' is released if dropEqual is TRUE.
+*/
+static void RICK45BLISTS_MergeSortedInto(list_t dst, list_t src, RICK45B_comparator_t key_cmp, int dropEqual, int delete_bool)
+{
+    listNode_t prev = NULL, d = dst->head;
+    size_t left = src->size;
+    RICK45BLISTS_HashIndexInvalidate(dst);     /*rebuilt once, at the next lookup*/
+    RICK45BLISTS_HashIndexInvalidate(src);
+    while (src->head != NULL)
+    {
+        listNode_t s = src->head;
+        if (d == NULL)  /*what's left of 'src' goes after the tail, in one step*/
         {
-            /*updating the 'pointed node' field*/
-            if (dlinkedList->pointedNode == dlinkedList->head)
-                dlinkedList->pointedNode = NULL;
-            dlinkedList->head = NULL;
+            if (prev == NULL)   dst->head = s;
+            else    prev->next = s;
+            dst->tailPrevious = left>1 ? src->tailPrevious : prev;
+            dst->tail = src->tail;
+            dst->size += left;
+            break;
         }
-        else
+        int c = key_cmp(d->key, s->key);
+        if (c < 0 || (c == 0 && !dropEqual))
         {
-            /*updating the 'pointed node' field*/
-            if (dlinkedList->pointedNode == dlinkedList->head)
-                dlinkedList->pointedNode = dlinkedList->head->next;
-            dlinkedList->head = dlinkedList->head->next;
+            prev = d;
+            d = d->next;
         }
-
-        if (delete_bool==FALSE)
-            freeFun(temp);
         else
         {
-            freeFun(temp->key);
-            freeFun(temp);
+            src->head = s->next;
+            left--;
+            if (c == 0)
+            {
+                if (delete_bool)
+                    freeFun(s->key);
+                RICK45B_Free(&src->nodeAllocator, s);
+            }
+            else
+            {
+                RICK45BLISTS_LinkAfter(dst, prev, s);
+                prev = s;
+            }
         }
-        dlinkedList->size--;
     }
-    else
-        dlinkedList->tail = NULL;  /*if head is null, the tail must be as well.*/
 
-    return 0;
+    src->head = NULL;
+    src->tail = NULL;
+    src->tailPrevious = NULL;
+    src->pointedNode = NULL;
+    src->size = 0;
+    if (dst->index != NULL)
+        dst->index->valid = FALSE;
+    if (src->index != NULL)
+        src->index->valid = FALSE;
+}
 
+/*removes from the sorted 'dst' the keys that are (keepCommon FALSE) or aren't (keepCommon TRUE) in the sorted 'src'.*/
+static int RICK45BLISTS_FilterSorted(list_t dst, list_t src, int keepCommon, int delete_bool)
+{
+    int cnt = 0;
+    listNode_t prev = NULL, d = dst->head, s = src->head;
+    while (d != NULL)
+    {
+        listNode_t next = d->next;
+        int c = s!=NULL ? dst->key_cmp(s->key, d->key) : 1;
+        while (c < 0)
+        {
+            s = s->next;
+            c = s!=NULL ? dst->key_cmp(s->key, d->key) : 1;
+        }
+        if ((c == 0) == (keepCommon != 0))
+            prev = d;
+        else
+        {
+            RICK45BLISTS_UnlinkAfter(dst, prev, delete_bool);
+            cnt++;
+        }
+        d = next;
+    }
+    return cnt;
 }
 
-int RICK45BLISTS_HeadAddDoubleListNode(void *key, doubleList_t dlinkedList)
+int RICK45BLISTS_SortedUnion(list_t dst, list_t src, int delete_bool)
 {
-    if (dlinkedList == NULL)
+    if (dst == NULL || src == NULL)
     {
-        RICK45B_CopyString("Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list.", RICK45B.GetError, sizeof("Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list."));
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list.");
         return -1;
     }
-    if (key == NULL)
+    if (dst == src || !RICK45BLISTS_ShareNodeAllocator(&dst->nodeAllocator, &dst->pool, dst->size, &src->nodeAllocator, &src->pool, src->size))
     {
-        RICK45B_CopyString("Invalid Argument: key cannot be NULL!", RICK45B.GetError, sizeof("Invalid Argument: key cannot be NULL!"));
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: the lists must be different, and take their nodes from the same allocator or from compatible node pools!");
         return -1;
     }
+    RICK45BLISTS_MergeSortedInto(dst, src, dst->key_cmp, TRUE, delete_bool);
+    return 0;
+}
 
-    doubleListNode_t node = NULL;
-    node = mallocFun(sizeof(struct doubleListNode));
-
-    if (node == NULL)
+int RICK45BLISTS_SortedIntersection(list_t dst, list_t src, int delete_bool)
+{
+    if (dst == NULL || src == NULL)
     {
-        RICK45B_CopyString("Fatal Error: Cannot allocate memory for new node. Maybe the heap is full?", RICK45B.GetError, sizeof("Fatal Error: Cannot allocate memory for new node. Maybe the heap is full?"));
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list.");
         return -1;
     }
+    if (dst == src)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: the lists must be different!");
+        return -1;
+    }
+    return RICK45BLISTS_FilterSorted(dst, src, TRUE, delete_bool);
+}
 
-    node->key = key;
-    node->next = dlinkedList->head;
-    node->previous = NULL;
-
-    if (dlinkedList->head == NULL)
+int RICK45BLISTS_SortedDifference(list_t dst, list_t src, int delete_bool)
+{
+    if (dst == NULL || src == NULL)
     {
-        dlinkedList->head = node;
-        dlinkedList->tail = node;
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list.");
+        return -1;
     }
-    else
+    if (dst == src)
     {
-        dlinkedList->head->previous = node;
-        dlinkedList->head = node;
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: the lists must be different!");
+        return -1;
     }
-
-    dlinkedList->size++;
-    return 0;
+    return RICK45BLISTS_FilterSorted(dst, src, FALSE, delete_bool);
 }
 
-size_t RICK45BLISTS_GetDoubleListSize(doubleList_t dlinkedList){
-    if (dlinkedList == NULL)
+int RICK45BLISTS_SortedDedup(list_t linkedList, int delete_bool)
+{
+    if (linkedList == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list.");
+        return -1;
+    }
+    if (linkedList->head == NULL)
         return 0;
-    return dlinkedList->size;
+
+    int cnt = 0;
+    listNode_t prev = linkedList->head, node = prev->next;
+    while (node != NULL)
+    {
+        listNode_t next = node->next;
+        if (linkedList->key_cmp(prev->key, node->key) == 0)
+        {
+            RICK45BLISTS_UnlinkAfter(linkedList, prev, delete_bool);
+            cnt++;
+        }
+        else
+            prev = node;
+        node = next;
+    }
+    return cnt;
 }
 
-int RICK45BLISTS_TailAddDoubleListNode(void *key, doubleList_t dlinkedList)
+int RICK45BLISTS_SortedMerge(list_t dst, list_t *srcs, size_t k)
 {
-    if (dlinkedList == NULL)
+    if (dst == NULL)
     {
-        RICK45B_CopyString("Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list.", RICK45B.GetError, sizeof("Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list."));
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list.");
         return -1;
     }
-    if (key == NULL)
+    if (srcs == NULL && k != 0)
     {
-        RICK45B_CopyString("Invalid Argument: key cannot be NULL!", RICK45B.GetError, sizeof("Invalid Argument: key cannot be NULL!"));
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: srcs cannot be NULL!");
         return -1;
     }
-    doubleListNode_t node = mallocFun(sizeof(struct doubleListNode));
-    if (node == NULL)
+    size_t i, j, step;
+    list_t ref = dst;   /*the first list with a pool, if any: every other list must be able to share it*/
+    for (i = 0; i<k; i++)
     {
-        RICK45B_CopyString("Fatal Error: Cannot allocate memory for new node. Maybe the heap is full?", RICK45B.GetError, sizeof("Fatal Error: Cannot allocate memory for new node. Maybe the heap is full?"));
-        return -1;
+        if (srcs[i] == NULL)
+        {
+            RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list.");
+            return -1;
+        }
+        if (ref->pool == NULL && srcs[i]->pool != NULL)
+            ref = srcs[i];
+    }
+    for (i = 0; i<k; i++)       /*nothing is changed until all the lists have been checked*/
+    {
+        if (srcs[i] == dst || !RICK45BLISTS_NodeAllocatorsMatch(&ref->nodeAllocator, ref->pool, ref->size, &srcs[i]->nodeAllocator, srcs[i]->pool, srcs[i]->size)
+            || !RICK45BLISTS_NodeAllocatorsMatch(&ref->nodeAllocator, ref->pool, ref->size, &dst->nodeAllocator, dst->pool, dst->size))
+        {
+            RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: the lists must be different, and take their nodes from the same allocator or from compatible node pools!");
+            return -1;
+        }
+        for (j = 0; j<i; j++)
+            if (srcs[j] == srcs[i])     /*merging a list into itself would empty it*/
+            {
+                RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: the same list appears more than once in srcs!");
+                return -1;
+            }
     }
+    for (i = 0; i<k; i++)
+        RICK45BLISTS_ShareNodeAllocator(&dst->nodeAllocator, &dst->pool, dst->size, &srcs[i]->nodeAllocator, &srcs[i]->pool, srcs[i]->size);
 
-    node->next = NULL;
-    node->previous = dlinkedList->tail;
-    node->key = key;
+    /*merging in pairs: srcs[i] takes srcs[i+step], so that equal keys keep the order of their lists*/
+    for (step = 1; step<k; step *= 2)
+        for (i = 0; i+step<k; i += 2*step)
+            RICK45BLISTS_MergeSortedInto(srcs[i], srcs[i+step], dst->key_cmp, FALSE, FALSE);
+    if (k > 0)
+        RICK45BLISTS_MergeSortedInto(dst, srcs[0], dst->key_cmp, FALSE, FALSE);
+    return 0;
+}
 
-    if (dlinkedList->tail == NULL || dlinkedList->head == NULL)  /*there's no Tail*/
+int RICK45BLISTS_AddListNodeAfter(void *key, list_t linkedList, listNode_t node)
+{
+    if (linkedList == NULL)
     {
-        dlinkedList->tail = node;
-        dlinkedList->head = node;
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list.");
+        return -1;
     }
-    else
+    if (key == NULL || node == NULL)
     {
-        dlinkedList->tail->next = node;
-        dlinkedList->tail = node;
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: key and node cannot be NULL!");
+        return -1;
     }
-
-    dlinkedList->size++;
+    listNode_t newNode = RICK45B_Alloc(&linkedList->nodeAllocator, sizeof(struct listNode));
+    if (newNode == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NO_MEMORY, "Fatal Error: Cannot allocate memory for new node. Maybe the heap is full?");
+        return -1;
+    }
+    newNode->key = key;
+    RICK45BLISTS_LinkAfter(linkedList, node, newNode);
     return 0;
 }
 
-int RICK45BLISTS_AddDoubleListNode(void *key, doubleList_t dlinkedList, size_t position)
+int RICK45BLISTS_RemoveNodeAfter(list_t linkedList, listNode_t node, int delete_bool)
 {
-    if (dlinkedList == NULL)
+    if (linkedList == NULL)
     {
-        RICK45B_CopyString("Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list.", RICK45B.GetError, sizeof("Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list."));
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list.");
         return -1;
     }
-    if (key == NULL)
+    if (node == NULL)
     {
-        RICK45B_CopyString("Invalid Argument: key cannot be NULL!", RICK45B.GetError, sizeof("Invalid Argument: key cannot be NULL!"));
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: node cannot be NULL!");
         return -1;
     }
-
-    if (position > dlinkedList->size)
+    if (node->next == NULL)
     {
-        RICK45B_CopyString("Invalid Argument: Position value out of range for the given double linkedList!", RICK45B.GetError, sizeof("Invalid Argument: Position value out of range for the given double linkedList!"));
+        RICK45B_SetError(RICK45B_ERR_OUT_OF_RANGE, "Invalid Argument: the given node is the tail, no node follows it!");
         return -1;
     }
+    RICK45BLISTS_UnlinkAfter(linkedList, node, delete_bool);
+    return 0;
+}
 
-    if (position == dlinkedList->size)
-        RICK45BLISTS_TailAddDoubleListNode(key, dlinkedList);
-    else
-    {
-        if (position == 0)
-            RICK45BLISTS_HeadAddDoubleListNode(key, dlinkedList);
-        else
+listNode_t RICK45BLISTS_MergeSortNodes(listNode_t head, size_t size, RICK45B_comparator_t key_cmp, listNode_t *tail)
+{
+    struct listNode sorted;     /*placeholder before the first node*/
+    size_t width;
+    sorted.next = head;
+    *tail = NULL;
+    for (width = 1; width<size; width *= 2)     /*merging pairs of sorted runs of 'width' nodes*/
+    {
+        listNode_t last = &sorted;
+        listNode_t rest = sorted.next;
+        while (rest != NULL)
         {
-            doubleListNode_t node = NULL;
-            node = mallocFun(sizeof(struct doubleListNode));
-            if (node==NULL)
+            listNode_t left = rest, right, node;
+            size_t leftSize, rightSize = 0;
+            for (leftSize = 1, node = left; leftSize<width && node->next != NULL; leftSize++)
+                node = node->next;
+            right = node->next;
+            node->next = NULL;
+            if (right != NULL)
             {
-                RICK45B_CopyString("Fatal Error: Cannot allocate memory for new node. Maybe the heap is full?", RICK45B.GetError, sizeof("Fatal Error: Cannot allocate memory for new node. Maybe the heap is full?"));
-                return -1;
+                for (rightSize = 1, node = right; rightSize<width && node->next != NULL; rightSize++)
+                    node = node->next;
+                rest = node->next;
+                node->next = NULL;
             }
+            else
+                rest = NULL;
 
-            node->key = key;
-            node->next = RICK45BLISTS_GetNodeByPositionDouble(dlinkedList, position);
-            node->previous = node->next->previous;
-            node->previous->next = node;
-            node->next->previous = node;
-            dlinkedList->size++;
+            while (left != NULL && right != NULL)   /*on equal keys the left run goes first: the sort is stable*/
+            {
+                if (key_cmp(left->key, right->key) <= 0)
+                {
+                    last->next = left;
+                    left = left->next;
+                }
+                else
+                {
+                    last->next = right;
+                    right = right->next;
+                }
+                last = last->next;
+            }
+            last->next = left!=NULL ? left : right;
+            while (last->next != NULL)
+                last = last->next;
         }
+        *tail = last;
     }
-    return 0;
+    if (*tail == NULL)  /*a single node*/
+        *tail = head;
+    return sorted.next;
 }
 
-doubleListNode_t RICK45BLISTS_GetNodeByPositionDouble(doubleList_t dlinkedList, size_t position)
+void RICK45BLISTS_LinkAfter(list_t linkedList, listNode_t prev, listNode_t node)
 {
-    if (dlinkedList == NULL)
+    if (prev == NULL)   /*new head*/
     {
-        RICK45B_CopyString("Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list.", RICK45B.GetError, sizeof("Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list."));
-        return NULL;
+        node->next = linkedList->head;
+        linkedList->head = node;
+        if (linkedList->tail == NULL)
+            linkedList->tail = node;
+        else if (node->next == linkedList->tail)
+            linkedList->tailPrevious = node;
+    }
+    else
+    {
+        node->next = prev->next;
+        prev->next = node;
+        if (prev == linkedList->tail)   /*new tail*/
+        {
+            linkedList->tailPrevious = prev;
+            linkedList->tail = node;
+        }
+        else if (node->next == linkedList->tail)
+            linkedList->tailPrevious = node;
     }
+    linkedList->size++;
+    if (linkedList->index != NULL)
+        linkedList->index->valid = FALSE;
+    RICK45BLISTS_HashIndexInsert(linkedList, node);
+}
 
-    if (position > dlinkedList->size)
+void RICK45BLISTS_UnlinkAfter(list_t linkedList, listNode_t prev, int delete_bool)
+{
+    listNode_t node = prev!=NULL ? prev->next : linkedList->head;
+    if (prev == NULL)
+        linkedList->head = node->next;
+    else
+        prev->next = node->next;
+
+    if (node == linkedList->tail)
     {
-        RICK45B_CopyString("Invalid Argument: Position value out of range for the given double linkedList!", RICK45B.GetError, sizeof("Invalid Argument: Position value out of range for the given double linkedList!"));
-        return NULL;
+        linkedList->tail = prev;
+        linkedList->tailPrevious = NULL;   /*a single link can't be followed backwards*/
     }
+    else if (node == linkedList->tailPrevious)
+        linkedList->tailPrevious = prev;
+    if (node == linkedList->pointedNode)
+        linkedList->pointedNode = prev!=NULL ? prev : node->next;
 
-    if (position==0)
-        return dlinkedList->head;
-    if (position == dlinkedList->size-1)
-        return dlinkedList->tail;
+    RICK45BLISTS_HashIndexRemove(linkedList, node);
+    if (delete_bool)
+        freeFun(node->key);
+    RICK45B_Free(&linkedList->nodeAllocator, node);
+    linkedList->size--;
+    if (linkedList->index != NULL)
+        linkedList->index->valid = FALSE;
+}
 
-    doubleListNode_t temp = NULL;
-    int i = 0;
+/*returns the height of a new tower: every level is reached with probability 1/4.*/
+static size_t RICK45BLISTS_SkipIndexHeight(struct skipIndex *index)
+{
+    unsigned long long x = index->seed;     /*xorshift64*/
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    index->seed = x;
 
-    if (position>dlinkedList->size/2)   /*start from tail*/
+    size_t height = 0;
+    while (height<RICK45BLISTS_SKIP_MAX_LEVEL && (x & 3) == 0)
     {
-        temp = dlinkedList->tail;
-        i = (int)dlinkedList->size-1;
-        if (temp == NULL)
-            return NULL;     /*no keys can be found*/
+        height++;
+        x >>= 2;
+    }
+    return height;
+}
 
-        while (temp->previous!=NULL && i>(int)position)
+void RICK45BLISTS_SkipIndexClear(list_t linkedList)
+{
+    struct skipIndex *index = linkedList->index;
+    struct skipTower *tower = index->levels>0 ? index->head->links[0].next : NULL;
+    while (tower != NULL)
+    {
+        struct skipTower *next = tower->links[0].next;
+        RICK45B_Free(&linkedList->allocator, tower);
+        tower = next;
+    }
+    size_t l;
+    for (l = 0; l<index->levels; l++)
+        index->head->links[l].next = NULL;
+    index->levels = 0;
+    index->valid = FALSE;
+}
+
+void RICK45BLISTS_SkipIndexRebuild(list_t linkedList)
+{
+    struct skipIndex *index = linkedList->index;
+    struct skipTower *last[RICK45BLISTS_SKIP_MAX_LEVEL];
+    size_t lastRank[RICK45BLISTS_SKIP_MAX_LEVEL];
+    size_t l, rank = 0;
+    listNode_t node;
+
+    RICK45BLISTS_SkipIndexClear(linkedList);
+    for (l = 0; l<RICK45BLISTS_SKIP_MAX_LEVEL; l++)
+    {
+        last[l] = index->head;
+        lastRank[l] = 0;
+    }
+    for (node = linkedList->head; node != NULL; node = node->next)
+    {
+        rank++;
+        size_t height = RICK45BLISTS_SkipIndexHeight(index);
+        if (height == 0)
+            continue;
+        struct skipTower *tower = RICK45B_Alloc(&linkedList->allocator, sizeof(struct skipTower)+height*sizeof(struct skipLink));
+        if (tower == NULL)  /*the node just stays out of the index*/
+            continue;
+        tower->node = node;
+        tower->height = height;
+        for (l = 0; l<height; l++)
         {
-            temp = temp->previous;
-            i--;
+            last[l]->links[l].next = tower;
+            last[l]->links[l].span = rank-lastRank[l];
+            last[l] = tower;
+            lastRank[l] = rank;
         }
+        if (height>index->levels)
+            index->levels = height;
     }
-    else    /*start from head*/
-    {
-        temp = dlinkedList->head;
-        if (temp == NULL)
-            return NULL;     /*no keys can be found*/
+    for (l = 0; l<index->levels; l++)
+        last[l]->links[l].next = NULL;
+    index->valid = TRUE;
+}
 
-        while (temp->next!=NULL && i<(int)position)
+listNode_t RICK45BLISTS_SkipIndexSeek(list_t linkedList, size_t rank, struct skipTower **update, size_t *ranks)
+{
+    struct skipIndex *index = linkedList->index;
+    struct skipTower *tower = index->head;
+    size_t l = index->levels, current = 0;
+    while (l-- > 0)
+    {
+        while (tower->links[l].next != NULL && current+tower->links[l].span <= rank)
         {
-            temp = temp->next;
-            i++;
+            current += tower->links[l].span;
+            tower = tower->links[l].next;
         }
+        update[l] = tower;
+        ranks[l] = current;
     }
 
-    if (i==(int)position)
-        return temp;
-
-    return NULL;
+    /*the last steps are taken on the list itself*/
+    listNode_t node = tower->node;
+    while (current<rank)
+    {
+        node = node!=NULL ? node->next : linkedList->head;
+        current++;
+    }
+    return node;
 }
 
-doubleListNode_t RICK45BLISTS_GetNodeByKeyDouble(doubleList_t dlinkedList, void* key){
+int RICK45BLISTS_SkipIndexInsert(list_t linkedList, void *key, size_t position)
+{
+    struct skipIndex *index = linkedList->index;
+    struct skipTower *update[RICK45BLISTS_SKIP_MAX_LEVEL];
+    size_t ranks[RICK45BLISTS_SKIP_MAX_LEVEL];
+    size_t l, rank = position+1;
 
-    if (dlinkedList == NULL)
-    {
-        RICK45B_CopyString("Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list.", RICK45B.GetError, sizeof("Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list."));
-        return NULL;
-    }
-    if (key == NULL)
+    listNode_t node = RICK45B_Alloc(&linkedList->nodeAllocator, sizeof(struct listNode));
+    if (node == NULL)
     {
-        RICK45B_CopyString("Invalid Argument: key cannot be NULL!", RICK45B.GetError, sizeof("Invalid Argument: key cannot be NULL!"));
-        return NULL;
+        RICK45B_SetError(RICK45B_ERR_NO_MEMORY, "Fatal Error: Cannot allocate memory for new node. Maybe the heap is full?");
+        return -1;
     }
-    if (dlinkedList->head == NULL && dlinkedList->tail == NULL)
+    node->key = key;
+    listNode_t prev = RICK45BLISTS_SkipIndexSeek(linkedList, position, update, ranks);
+    RICK45BLISTS_LinkAfter(linkedList, prev, node);     /*the index is valid again once the towers are updated*/
+
+    size_t height = RICK45BLISTS_SkipIndexHeight(index);
+    struct skipTower *tower = NULL;
+    if (height>0)
+        tower = RICK45B_Alloc(&linkedList->allocator, sizeof(struct skipTower)+height*sizeof(struct skipLink));
+    if (tower == NULL)  /*the node just stays out of the index*/
+        height = 0;
+    for (l = index->levels; l<height; l++)
     {
-        RICK45B_CopyString("RICK45BLISTS_GetNodeByKeyDouble error: no key can be found!", RICK45B.GetError, sizeof("RICK45BLISTS_GetNodeByKeyDouble error: no key can be found!"));
-        return NULL;     /*no keys can be found*/
+        index->head->links[l].next = NULL;
+        update[l] = index->head;
+        ranks[l] = 0;
     }
+    if (height>index->levels)
+        index->levels = height;
 
-    doubleListNode_t temp = NULL;
-
-    if (dlinkedList->key_cmp(dlinkedList->head->key, key)==0)
-        temp = dlinkedList->head;
-    else
+    for (l = 0; l<index->levels; l++)
     {
-        if (dlinkedList->key_cmp(dlinkedList->tail->key, key)==0)
-            temp = dlinkedList->tail;
-        else
+        struct skipLink *link = &update[l]->links[l];
+        if (l<height)
         {
-            temp = dlinkedList->head;
-            while (temp->next!=NULL && dlinkedList->key_cmp(temp->key, key))
-                temp = temp->next;
+            tower->links[l].next = link->next;
+            tower->links[l].span = ranks[l]+link->span+1-rank;
+            link->next = tower;
+            link->span = rank-ranks[l];
         }
+        else
+            link->span++;
     }
-
-    if (temp == NULL)
+    if (tower != NULL)
     {
-        RICK45B_CopyString("RICK45BLISTS_GetNodeByKeyDouble error: no key can be found!", RICK45B.GetError, sizeof("RICK45BLISTS_GetNodeByKeyDouble error: no key can be found!"));
-        return NULL;     /*no keys can be found*/
+        tower->node = node;
+        tower->height = height;
     }
+    index->valid = TRUE;
+    return 0;
+}
 
-    if (dlinkedList->key_cmp(temp->key, key)==0)
-        return temp;
+void RICK45BLISTS_SkipIndexRemove(list_t linkedList, size_t position, int delete_bool)
+{
+    struct skipIndex *index = linkedList->index;
+    struct skipTower *update[RICK45BLISTS_SKIP_MAX_LEVEL];
+    size_t ranks[RICK45BLISTS_SKIP_MAX_LEVEL];
+    struct skipTower *tower = NULL;
+    size_t l;
+
+    listNode_t prev = RICK45BLISTS_SkipIndexSeek(linkedList, position, update, ranks);
+    listNode_t node = prev!=NULL ? prev->next : linkedList->head;
+    for (l = 0; l<index->levels; l++)
+    {
+        struct skipLink *link = &update[l]->links[l];
+        if (link->next != NULL && link->next->node == node)
+        {
+            tower = link->next;
+            link->span += tower->links[l].span-1;
+            link->next = tower->links[l].next;
+        }
+        else
+            link->span--;
+    }
+    if (tower != NULL)
+        RICK45B_Free(&linkedList->allocator, tower);
+    while (index->levels>0 && index->head->links[index->levels-1].next == NULL)
+        index->levels--;
 
-    RICK45B_CopyString("RICK45BLISTS_GetNodeByKeyDouble error: no key can be found!", RICK45B.GetError, sizeof("RICK45BLISTS_GetNodeByKeyDouble error: no key can be found!"));
-    return NULL;
+    RICK45BLISTS_UnlinkAfter(linkedList, prev, delete_bool);
+    index->valid = TRUE;
 }
 
-void *RICK45BLISTS_GetKeyByNodeDouble(doubleListNode_t node)
+/*number of slots of a table holding 'count' nodes at most a quarter full, at least 16.*/
+static size_t RICK45BLISTS_HashIndexCapacity(size_t count)
 {
-    return RICK45BLISTS_GetKeyByNode((listNode_t)node);
+    size_t capacity = 16;
+    while (capacity/4 < count)
+        capacity *= 2;
+    return capacity;
 }
 
-void *RICK45BLISTS_GetKeyByPositionDouble(doubleList_t dlinkedList, size_t position)
+/*stores the node in the first free slot of its cluster: the table must have a free slot.*/
+static void RICK45BLISTS_HashIndexPut(struct hashIndex *hashIndex, listNode_t node, size_t hash)
 {
-    if (dlinkedList == NULL)
+    size_t mask = hashIndex->capacity-1;
+    size_t i = hash & mask;
+    while (hashIndex->slots[i].node != NULL)
+        i = (i+1) & mask;
+    hashIndex->slots[i].node = node;
+    hashIndex->slots[i].hash = hash;
+    hashIndex->count++;
+}
+
+int RICK45BLISTS_HashIndexRebuild(list_t linkedList)
+{
+    struct hashIndex *hashIndex = linkedList->hashIndex;
+    size_t capacity = RICK45BLISTS_HashIndexCapacity(linkedList->size);
+    size_t i;
+    listNode_t node;
+
+    hashIndex->valid = FALSE;
+    if (capacity != hashIndex->capacity)
     {
-        RICK45B_CopyString("Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list.", RICK45B.GetError, sizeof("Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list."));
-        return NULL;
-    }
+        struct hashSlot *slots = RICK45B_Alloc(&linkedList->allocator, capacity*sizeof(struct hashSlot));
+        if (slots == NULL)
+            return -1;
+        if (hashIndex->slots != NULL)
+            RICK45B_Free(&linkedList->allocator, hashIndex->slots);
+        hashIndex->slots = slots;
+        hashIndex->capacity = capacity;
+    }
+    for (i = 0; i<capacity; i++)
+        hashIndex->slots[i].node = NULL;
+    hashIndex->count = 0;
+    for (node = linkedList->head; node != NULL; node = node->next)
+        RICK45BLISTS_HashIndexPut(hashIndex, node, hashIndex->hash(node->key));
+    hashIndex->valid = TRUE;
+    return 0;
+}
 
-    if (position > dlinkedList->size)
+void RICK45BLISTS_HashIndexInsert(list_t linkedList, listNode_t node)
+{
+    struct hashIndex *hashIndex = linkedList->hashIndex;
+    if (hashIndex == NULL || !hashIndex->valid)
+        return;
+    if ((hashIndex->count+1)*2 > hashIndex->capacity)  /*growing the table: the new node is already in the list*/
     {
-        RICK45B_CopyString("Invalid Argument: Position value out of range for the given double linkedList!", RICK45B.GetError, sizeof("Invalid Argument: Position value out of range for the given double linkedList!"));
-        return NULL;
+        RICK45BLISTS_HashIndexRebuild(linkedList);
+        return;
     }
+    RICK45BLISTS_HashIndexPut(hashIndex, node, hashIndex->hash(node->key));
+}
 
-    if (position==0)
-        return dlinkedList->head->key;
-    if (position == dlinkedList->size)
-        return dlinkedList->tail->key;
-
-    int i = 0;
-    doubleListNode_t temp = NULL;
-
-    if (position>dlinkedList->size/2)   /*start from tail*/
+void RICK45BLISTS_HashIndexRemove(list_t linkedList, listNode_t node)
+{
+    struct hashIndex *hashIndex = linkedList->hashIndex;
+    if (hashIndex == NULL || !hashIndex->valid)
+        return;
+    size_t mask = hashIndex->capacity-1;
+    size_t i = hashIndex->hash(node->key) & mask;
+    size_t j;
+    while (hashIndex->slots[i].node != node)
     {
-        temp = dlinkedList->tail;
-        i = (int)dlinkedList->size-1;
-        if (temp == NULL)
-        {
-            RICK45B_CopyString("RICK45BLISTS_GetNodeByKeyDouble error: no key can be found!", RICK45B.GetError, sizeof("RICK45BLISTS_GetNodeByKeyDouble error: no key can be found!"));
-            return NULL;     /*no keys can be found*/
-        }
-
-        while (temp->previous!=NULL && i>(int)position)
-        {
-            temp = temp->previous;
-            i--;
-        }
+        if (hashIndex->slots[i].node == NULL)   /*not indexed*/
+            return;
+        i = (i+1) & mask;
     }
-    else    /*start from head*/
+
+    /*the following nodes of the cluster that would no longer be reachable are shifted back into the hole*/
+    for (j = (i+1) & mask; hashIndex->slots[j].node != NULL; j = (j+1) & mask)
     {
-        temp = dlinkedList->head;
-        if (temp == NULL)
+        size_t home = hashIndex->slots[j].hash & mask;
+        if (((j-home) & mask) >= ((j-i) & mask))
         {
-            RICK45B_CopyString("RICK45BLISTS_GetNodeByKeyDouble error: no key can be found!", RICK45B.GetError, sizeof("RICK45BLISTS_GetNodeByKeyDouble error: no key can be found!"));
-            return NULL;     /*no keys can be found*/
+            hashIndex->slots[i] = hashIndex->slots[j];
+            i = j;
         }
+    }
+    hashIndex->slots[i].node = NULL;
+    hashIndex->count--;
+}
 
-        while (temp->next!=NULL && i<(int)position)
+int RICK45BLISTS_HashIndexFind(list_t linkedList, void *key, listNode_t *node)
+{
+    struct hashIndex *hashIndex = linkedList->hashIndex;
+    if (hashIndex == NULL || (!hashIndex->valid && RICK45BLISTS_HashIndexRebuild(linkedList) == -1))
+        return -1;
+    size_t mask = hashIndex->capacity-1;
+    size_t hash = hashIndex->hash(key);
+    size_t i;
+    int matches = 0;
+    for (i = hash & mask; hashIndex->slots[i].node != NULL && matches<2; i = (i+1) & mask)
+        if (hashIndex->slots[i].hash == hash && linkedList->key_cmp(hashIndex->slots[i].node->key, key) == 0)
         {
-            temp = temp->next;
-            i++;
+            *node = hashIndex->slots[i].node;
+            matches++;
         }
-    }
-
-    if (i==(int)position)
-        return temp->key;
-
-    RICK45B_CopyString("RICK45BLISTS_GetNodeByKeyDouble error: no key can be found!", RICK45B.GetError, sizeof("RICK45BLISTS_GetNodeByKeyDouble error: no key can be found!"));
-    return NULL;
+    return matches;
 }
 
-void *RICK45BLISTS_SetKeyByPositionDouble(doubleList_t dlinkedList, void* newkey, size_t position)
+void RICK45BLISTS_HashIndexInvalidate(list_t linkedList)
 {
-    if (dlinkedList == NULL)
+    if (linkedList->hashIndex != NULL)
+        linkedList->hashIndex->valid = FALSE;
+}
+
+doubleList_t RICK45BLISTS_DoubleListCreate(RICK45B_comparator_t key_cmp)
+{
+    return RICK45BLISTS_DoubleListCreateWithAllocator(key_cmp, NULL);
+}
+
+doubleList_t RICK45BLISTS_DoubleListCreateWithAllocator(RICK45B_comparator_t key_cmp, allocator_t allocator)
+{
+    if (key_cmp == NULL)
     {
-        RICK45B_CopyString("Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list.", RICK45B.GetError, sizeof("Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list."));
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: key_cmp function cannot be NULL!");
         return NULL;
     }
-
-    if (position > dlinkedList->size)
+    if (allocator != NULL && (allocator->alloc_funct == NULL || allocator->free_funct == NULL))
     {
-        RICK45B_CopyString("Invalid Argument: Position value out of range for the given double linkedList!", RICK45B.GetError, sizeof("Invalid Argument: Position value out of range for the given double linkedList!"));
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: the allocator's functions cannot be NULL!");
         return NULL;
     }
 
-    if (newkey == NULL)
+    struct allocator alloc = RICK45B_PickAllocator(allocator);
+    doubleList_t out = NULL;
+    out = RICK45B_Alloc(&alloc, sizeof(struct doubleList));
+
+    if (out == NULL)
     {
-        RICK45B_CopyString("Invalid Argument: new key cannot be NULL!", RICK45B.GetError, sizeof("Invalid Argument: new key cannot be NULL!"));
+        RICK45B_SetError(RICK45B_ERR_NO_MEMORY, "Fatal Error: Cannot allocate memory for new doubleList_t type. Maybe the heap is full?");
         return NULL;
     }
+    out->head = NULL;
+    out->tail = NULL;
+    out->pointedNode = NULL;
+    out->cachedNode = NULL;
+    out->cachedPosition = 0;
+    out -> key_cmp = key_cmp;
+    out -> size = 0;
+    out -> allocator = alloc;
+    out -> nodeAllocator = alloc;
+    out -> pool = NULL;
+    out -> searchMode = RICK45BLISTS_SEARCH_PLAIN;
+    return out;
+}
 
-    doubleListNode_t temp = NULL;
-    temp = RICK45BLISTS_GetNodeByPositionDouble(dlinkedList, position);
-    if (temp == NULL)
+void RICK45BLISTS_DoubleListDestroy(doubleList_t *dlinkedList, int delete_bool){
+
+    if (dlinkedList != NULL && *dlinkedList != NULL)
     {
-        RICK45B_CopyString("Fatal error: couldn't fetch node at that position!", RICK45B.GetError, sizeof("Fatal error: couldn't fetch node at that position!"));
-        return NULL;
+        struct allocator alloc = (*dlinkedList)->allocator;
+        if ((*dlinkedList)->pool != NULL && (*dlinkedList)->pool->refs == 1 && (*dlinkedList)->pool->forward == NULL)    /*the nodes are released all at once, together with their pool*/
+        {
+            doubleListNode_t node;
+            if (delete_bool)
+                for (node = (*dlinkedList)->head; node != NULL; node = node->next)
+                    freeFun(node->key);
+            RICK45B_NodePoolDestroy((*dlinkedList)->pool);
+        }
+        else
+        {
+            RICK45BLISTS_DoubleListRemoveAllNodes(*dlinkedList, delete_bool);   /*a shared pool keeps the nodes for its other owners*/
+            RICK45B_NodePoolDestroy((*dlinkedList)->pool);
+        }
+        RICK45B_Free(&alloc, *dlinkedList);
+        *dlinkedList = NULL;
     }
 
-    void *out = temp->key;
-    temp->key = newkey;
-    return out;
 }
 
-void *RICK45BLISTS_SetKeyByNodeDouble(doubleList_t dlinkedList, void* newkey, doubleListNode_t node)
+int RICK45BLISTS_DoubleListUseNodePool(doubleList_t dlinkedList, size_t nodesPerChunk)
 {
     if (dlinkedList == NULL)
     {
-        RICK45B_CopyString("Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list.", RICK45B.GetError, sizeof("Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list."));
-        return NULL;
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list.");
+        return -1;
+    }
+    if (dlinkedList->size != 0)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: a node pool can only be attached to an empty double linkedList!");
+        return -1;
+    }
+    if (dlinkedList->pool != NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: the double linkedList already uses a node pool!");
+        return -1;
     }
+    nodePool_t pool = RICK45B_NodePoolCreate(sizeof(struct doubleListNode), nodesPerChunk, &dlinkedList->allocator);
+    if (pool == NULL)   return -1;
+    dlinkedList->pool = pool;
+    dlinkedList->nodeAllocator = RICK45B_NodePoolAllocator(pool);
+    return 0;
+}
 
-    if (node == NULL)
+int RICK45BLISTS_DoubleListSetSearchMode(doubleList_t dlinkedList, int mode)
+{
+    if (dlinkedList == NULL)
     {
-        RICK45B_CopyString("Fatal error: Node cannot be NULL!", RICK45B.GetError, sizeof("Fatal error: Node cannot be NULL!"));
-        return NULL;
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list.");
+        return -1;
     }
+    if (mode != RICK45BLISTS_SEARCH_PLAIN && mode != RICK45BLISTS_SEARCH_MOVE_TO_FRONT && mode != RICK45BLISTS_SEARCH_TRANSPOSE)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: unknown search mode!");
+        return -1;
+    }
+    dlinkedList->searchMode = mode;
+    return 0;
+}
 
-    if (newkey == NULL)
+doubleList_t RICK45BLISTS_DoubleListFromArray(void **keys, size_t n, RICK45B_comparator_t key_cmp, allocator_t allocator)
+{
+    size_t cnt;
+    if (keys == NULL && n != 0)
     {
-        RICK45B_CopyString("Invalid Argument: new key cannot be NULL!", RICK45B.GetError, sizeof("Invalid Argument: new key cannot be NULL!"));
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: keys cannot be NULL!");
         return NULL;
     }
-
-    if (dlinkedList->head == NULL)
+    for (cnt = 0; cnt<n; cnt++)
+        if (keys[cnt] == NULL)
+        {
+            RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: key cannot be NULL!");
+            return NULL;
+        }
+    doubleList_t out = RICK45BLISTS_DoubleListCreateWithAllocator(key_cmp, allocator);
+    if (out == NULL || n == 0)
+        return out;
+    if (RICK45BLISTS_DoubleListUseNodePool(out, n) == -1)
     {
-        RICK45B_CopyString("Head of the double linkedList is NULL! Please consider adding some nodes first!", RICK45B.GetError, sizeof("Head of the double linkedList is NULL! Please consider adding some nodes first!"));
+        RICK45BLISTS_DoubleListDestroy(&out, 0);
         return NULL;
     }
 
-    doubleListNode_t temp = NULL;
-    if (node == dlinkedList->head)
-        temp = dlinkedList->head;
-    else
+    /*the first node allocates the whole block, the others are carved out of it in order*/
+    doubleListNode_t prev = NULL;
+    for (cnt = 0; cnt<n; cnt++)
     {
-        if (node == dlinkedList->tail)
-            temp = dlinkedList->tail;
-        else
+        doubleListNode_t node = RICK45B_NodePoolAlloc(out->pool);
+        if (node == NULL)
         {
-            temp = dlinkedList->head;
-            while (temp->next!=NULL && temp!=node)
-                temp = temp->next;
+            RICK45BLISTS_DoubleListDestroy(&out, 0);
+            return NULL;
         }
-    }
-    void *out = node->key;
-    temp->key = newkey;
+        node->key = keys[cnt];
+        node->previous = prev;
+        if (prev == NULL)   out->head = node;
+        else    prev->next = node;
+        prev = node;
+    }
+    prev->next = NULL;
+    out->tail = prev;
+    out->size = n;
+    out->pool->nodesPerChunk = RICK45B_POOL_DEFAULT_CHUNK;  /*nodes added later don't need another block that big*/
     return out;
 }
 
-int RICK45BLISTS_SetKeyByKeyDouble(doubleList_t dlinkedList, void* newkey, void* oldkey)
+void **RICK45BLISTS_DoubleListToArray(doubleList_t dlinkedList, void **array, int reverse)
 {
     if (dlinkedList == NULL)
     {
-        RICK45B_CopyString("Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list.", RICK45B.GetError, sizeof("Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list."));
-        return -1;
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list.");
+        return NULL;
+    }
+    if (array == NULL)
+    {
+        array = RICK45B_Alloc(&RICK45B_DefaultAllocator, sizeof(void *)*(dlinkedList->size!=0 ? dlinkedList->size : 1));
+        if (array == NULL)
+        {
+            RICK45B_SetError(RICK45B_ERR_NO_MEMORY, "Fatal Error: Cannot allocate memory for the array of keys. Maybe the heap is full?");
+            return NULL;
+        }
     }
 
-    if (newkey == NULL || oldkey == NULL)
+    /*walking in the requested direction, so that the array is always written front to back*/
+    void **slot = array;
+    doubleListNode_t node;
+    if (reverse)
+        for (node = dlinkedList->tail; node != NULL; node = node->previous)
+        {
+            if (node->previous != NULL)
+                RICK45B_PREFETCH(node->previous->previous);
+            *slot++ = node->key;
+        }
+    else
+        for (node = dlinkedList->head; node != NULL; node = node->next)
+        {
+            if (node->next != NULL)
+                RICK45B_PREFETCH(node->next->next);
+            *slot++ = node->key;
+        }
+    return array;
+}
+
+int RICK45BLISTS_DoubleListforEach(doubleList_t dlinkedList, RICK45B_forEach_t funct, void *opt)
+{
+    if (dlinkedList == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list.");
+        return -1;
+    }
+    if (funct == NULL)
     {
-        RICK45B_CopyString("Fatal Error: keys cannot be NULL!", RICK45B.GetError, sizeof("Fatal Error: keys cannot be NULL!"));
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: funct cannot be NULL!");
         return -1;
     }
 
-    int cnt = 0;
-    if (dlinkedList->head == NULL && dlinkedList->tail == NULL)
-        return cnt;
+    doubleListNode_t node;
+    for (node = dlinkedList->head; node != NULL; node = node->next)
+        if (funct(node, opt) == -1)
+        {
+            RICK45B_SetError(RICK45B_ERR_CALLBACK, "Provided function error!");
+            return -1;
+        }
+    return 0;
+}
 
-    doubleListNode_t temp = dlinkedList->head;
+int RICK45BLISTS_DoubleListParallelforEach(doubleList_t dlinkedList, RICK45B_forEach_t funct, void *opt, size_t threads)
+{
+    if (dlinkedList == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list.");
+        return -1;
+    }
+    threads = RICK45BLISTS_ParallelThreads(funct == NULL, threads);
+    if (threads == 0)
+        return -1;
+    struct parallelChunk job = {NULL, 0, 0, TRUE, NULL, NULL, NULL, NULL, NULL, 0, NULL, 0};
+    job.funct = funct;
+    job.opt = opt;
+    return RICK45BLISTS_RunParallel(dlinkedList->head, dlinkedList->size, &job, threads);
+}
 
-    while (temp!=NULL)
+doubleList_t RICK45BLISTS_DoubleListParallelMap(doubleList_t dlinkedList, RICK45B_map_t funct, void *opt, size_t threads)
+{
+    if (dlinkedList == NULL)
     {
-        if (dlinkedList->key_cmp(temp->key, oldkey)==0)
-        {
-            temp->key = newkey;
-            cnt++;
-        }
-        temp = temp->next;
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list.");
+        return NULL;
     }
-    return cnt;
+    threads = RICK45BLISTS_ParallelThreads(funct == NULL, threads);
+    if (threads == 0)
+        return NULL;
+    if (dlinkedList->size == 0)
+        return RICK45BLISTS_DoubleListFromArray(NULL, 0, dlinkedList->key_cmp, &dlinkedList->allocator);
+
+    void **results = RICK45B_Alloc(&dlinkedList->allocator, sizeof(void *)*dlinkedList->size);
+    if (results == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NO_MEMORY, "Fatal Error: Cannot allocate memory for the array of keys. Maybe the heap is full?");
+        return NULL;
+    }
+    struct parallelChunk job = {NULL, 0, 0, TRUE, NULL, NULL, NULL, NULL, NULL, 0, NULL, 0};
+    job.map = funct;
+    job.results = results;
+    job.opt = opt;
+    doubleList_t out = NULL;
+    if (RICK45BLISTS_RunParallel(dlinkedList->head, dlinkedList->size, &job, threads) == 0)
+        out = RICK45BLISTS_DoubleListFromArray(results, dlinkedList->size, dlinkedList->key_cmp, &dlinkedList->allocator);
+    RICK45B_Free(&dlinkedList->allocator, results);
+    return out;
 }
 
-int RICK45BLISTS_RemoveNodeDouble(doubleList_t dlinkedList, size_t position, int delete_bool)
+int RICK45BLISTS_DoubleListParallelReduce(doubleList_t dlinkedList, RICK45B_combine_t fold, RICK45B_combine_t combine, void *accumulators, size_t accSize, void *opt, size_t threads)
 {
     if (dlinkedList == NULL)
     {
-        RICK45B_CopyString("Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list.", RICK45B.GetError, sizeof("Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list."));
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list.");
         return -1;
     }
+    threads = RICK45BLISTS_ParallelThreads(fold == NULL, threads);
+    if (threads == 0)
+        return -1;
+    return RICK45BLISTS_ParallelReduce(dlinkedList->head, dlinkedList->size, TRUE, fold, combine, accumulators, accSize, opt, threads);
+}
 
-    if (dlinkedList->head != NULL)
-    {
-        if (position > dlinkedList->size)    /*position is out of bound!!*/
-        {
-            RICK45B_CopyString("Invalid Argument: Position value out of range for the given double linkedList!", RICK45B.GetError, sizeof("Invalid Argument: Position value out of range for the given double linkedList!"));
-            return -1;
-        }
+doubleListNode_t RICK45BLISTS_DoubleListGetNextNode(doubleList_t dlinkedList){
 
-        doubleListNode_t temp = NULL;
-        temp = RICK45BLISTS_GetNodeByPositionDouble(dlinkedList, position);
+    if (dlinkedList == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list.");
+        return NULL;
+    }
+    if (RICK45BLISTS_GetDoubleListSize(dlinkedList)==0)
+    {
+        RICK45B_SetError(RICK45B_ERR_EMPTY, "double linkedList is empty!");
+        return NULL;
+    }
+    if (dlinkedList->pointedNode->next!=NULL)
+        dlinkedList->pointedNode = dlinkedList->pointedNode->next;
+    return dlinkedList->pointedNode;
+}
 
-        if (position == dlinkedList->size-1)   /*i want to delete the tail!*/
-            RICK45BLISTS_RemoveTailDouble(dlinkedList, delete_bool);
-        else
-        {
-            if (position == 0)  /*i want to delete the head!*/
-                RICK45BLISTS_DoubleListRemoveHead(dlinkedList, delete_bool);
-            else    /*i want to delete something else*/
-            {
+doubleListNode_t RICK45BLISTS_DoubleListGetPreviousNode(doubleList_t dlinkedList){
 
-                if (temp==dlinkedList->pointedNode)
-                    dlinkedList->pointedNode = dlinkedList->pointedNode->previous;
-                temp->previous->next = temp->next;
-                temp->next->previous = temp->previous;
+    if (dlinkedList == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list.");
+        return NULL;
+    }
+    if (RICK45BLISTS_GetDoubleListSize(dlinkedList)==0)
+    {
+        RICK45B_SetError(RICK45B_ERR_EMPTY, "double linkedList is empty!");
+        return NULL;
+    }
+    if (dlinkedList->pointedNode->previous!=NULL)
+        dlinkedList->pointedNode = dlinkedList->pointedNode->previous;
+    return dlinkedList->pointedNode;
+}
 
+int RICK45BLISTS_DoubleListHasPrevious(doubleList_t dlinkedList){
 
-                if (delete_bool == FALSE)
-                    freeFun(temp);
-                else
-                {
-                    freeFun(temp->key);
-                    freeFun(temp);
-                }
-                dlinkedList->size--;
-            }
-        }
-        return 0;
+    if (dlinkedList == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list.");
+        return -1;
     }
-    else
+    if (RICK45BLISTS_GetDoubleListSize(dlinkedList)==0)
     {
-        RICK45B_CopyString("Head of the double linkedList is NULL! Please consider adding some nodes first!", RICK45B.GetError, sizeof("Head of the double linkedList is NULL! Please consider adding some nodes first!"));
-        dlinkedList->tail = NULL;  /*if head is null, the tail must be as well.*/
+        RICK45B_SetError(RICK45B_ERR_EMPTY, "double linkedList is empty!");
         return -1;
     }
+    return dlinkedList->pointedNode->previous!=NULL?1:0;
 }
 
-int RICK45BLISTS_RemoveTailDouble(doubleList_t dlinkedList, int delete_bool)
-{
+int RICK45BLISTS_DoubleListHasNext(doubleList_t dlinkedList){
+
     if (dlinkedList == NULL)
     {
-        RICK45B_CopyString("Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list.", RICK45B.GetError, sizeof("Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list."));
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list.");
+        return -1;
+    }
+    if (RICK45BLISTS_GetDoubleListSize(dlinkedList)==0)
+    {
+        RICK45B_SetError(RICK45B_ERR_EMPTY, "double linkedList is empty!");
         return -1;
     }
+    return dlinkedList->pointedNode->next!=NULL?1:0;
+}
 
-    if (dlinkedList->tail != NULL)
+doubleListNode_t RICK45BLISTS_DoubleListGetCurrentNode(doubleList_t dlinkedList){
+
+    if (dlinkedList == NULL)
     {
-        doubleListNode_t temp = NULL;
-        temp = RICK45BLISTS_GetNodeByPositionDouble(dlinkedList, RICK45BLISTS_GetDoubleListSize(dlinkedList)-2);
-        temp -> next = NULL;
-        if (dlinkedList->tail == dlinkedList->pointedNode)
-            dlinkedList->pointedNode = temp;
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list.");
+        return NULL;
+    }
+    if (RICK45BLISTS_GetDoubleListSize(dlinkedList)==0)
+    {
+        RICK45B_SetError(RICK45B_ERR_EMPTY, "double linkedList is empty!");
+        return NULL;
+    }
 
-        if (delete_bool == TRUE)
-            freeFun(dlinkedList->tail->key);
-        freeFun(dlinkedList->tail);
+    return dlinkedList->pointedNode;
+}
 
-        dlinkedList->tail = temp;
-        dlinkedList->size--;
+int RICK45BLISTS_RewindDoubleList(doubleList_t dlinkedList){
 
-        return 0;
+    if (dlinkedList == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list.");
+        return -1;
     }
-    else                        /*if tail is null, head must be as well.*/
+    if (RICK45BLISTS_GetDoubleListSize(dlinkedList)==0 || dlinkedList->head == NULL)
     {
-        RICK45B_CopyString("Tail of the double linkedList is NULL! Please consider adding some nodes first!", RICK45B.GetError, sizeof("Tail of the double linkedList is NULL! Please consider adding some nodes first!"));
-        dlinkedList->head = NULL;
+        RICK45B_SetError(RICK45B_ERR_EMPTY, "double linkedList is empty!");
         return -1;
     }
+
+    dlinkedList->pointedNode = dlinkedList->head;
+    dlinkedList->pointedNode->previous = NULL;
+    return 0;
 }
 
-int RICK45BLISTS_RemoveNodeByKeyDouble(doubleList_t dlinkedList, void *key, int delete_bool)
+int RICK45BLISTS_DoubleIteratorInit(doubleListIterator_t iterator, doubleList_t dlinkedList)
 {
+    if (iterator == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: iterator cannot be NULL!");
+        return -1;
+    }
     if (dlinkedList == NULL)
     {
-        RICK45B_CopyString("Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list.", RICK45B.GetError, sizeof("Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list."));
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list.");
         return -1;
     }
+    iterator->dlinkedList = dlinkedList;
+    iterator->next = dlinkedList->head;
+    iterator->previous = NULL;
+    iterator->last = NULL;
+    return 0;
+}
 
-    if (key == NULL)
+int RICK45BLISTS_DoubleIteratorInitTail(doubleListIterator_t iterator, doubleList_t dlinkedList)
+{
+    if (iterator == NULL)
     {
-        RICK45B_CopyString("Invalid Argument: key cannot be NULL!", RICK45B.GetError, sizeof("Invalid Argument: key cannot be NULL!"));
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: iterator cannot be NULL!");
         return -1;
     }
-
-    doubleListNode_t temp = dlinkedList->head;
-    doubleListNode_t old = dlinkedList->head;
-
-    if (temp == NULL)
+    if (dlinkedList == NULL)
     {
-        return 0;
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list.");
+        return -1;
     }
+    iterator->dlinkedList = dlinkedList;
+    iterator->next = NULL;
+    iterator->previous = dlinkedList->tail;
+    iterator->last = NULL;
+    return 0;
+}
 
-    while (temp->next!=NULL && dlinkedList->key_cmp(temp->key, key))
+int RICK45BLISTS_DoubleIteratorHasNext(doubleListIterator_t iterator)
+{
+    if (iterator == NULL)
     {
-        old = temp;
-        temp = temp->next;
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: iterator cannot be NULL!");
+        return -1;
     }
+    return iterator->next!=NULL?1:0;
+}
 
-    if (dlinkedList->key_cmp(temp->key, key)==0)   /*node with given key was found.*/
+int RICK45BLISTS_DoubleIteratorHasPrevious(doubleListIterator_t iterator)
+{
+    if (iterator == NULL)
     {
-        if (dlinkedList->head == temp)
-            RICK45BLISTS_DoubleListRemoveHead(dlinkedList, delete_bool);
-        else
-        {
-            if (dlinkedList->tail == temp)
-                RICK45BLISTS_RemoveTailDouble(dlinkedList, delete_bool);
-            else
-            {
-                if (dlinkedList->pointedNode == temp)
-                    dlinkedList->pointedNode = dlinkedList->pointedNode->previous;
-                old->next = temp->next;
-                temp->next->previous = old;
-
-                if (delete_bool == TRUE)
-                    freeFun(temp->key);
-                freeFun(temp);
-                dlinkedList->size--;
-            }
-        }
-        return 1;
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: iterator cannot be NULL!");
+        return -1;
     }
-    return 0;
+    return iterator->previous!=NULL?1:0;
 }
 
-int RICK45BLISTS_RemoveAllNodesByKeyDouble(doubleList_t dlinkedList, void *key, int delete_bool)
+doubleListNode_t RICK45BLISTS_DoubleIteratorNext(doubleListIterator_t iterator)
 {
-    int cnt = 0;
-    if (RICK45BLISTS_RemoveNodeByKeyDouble(dlinkedList, key, delete_bool)==-1)
-        return -1;
-    cnt++;
-    while (RICK45BLISTS_RemoveNodeByKeyDouble(dlinkedList, key, delete_bool)>0)
-        cnt++;
+    if (iterator == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: iterator cannot be NULL!");
+        return NULL;
+    }
+    doubleListNode_t out = iterator->next;
+    if (out != NULL)
+    {
+        iterator->previous = out;
+        iterator->next = out->next;
+    }
+    iterator->last = out;
+    return out;
+}
+
+doubleListNode_t RICK45BLISTS_DoubleIteratorPrevious(doubleListIterator_t iterator)
+{
+    if (iterator == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: iterator cannot be NULL!");
+        return NULL;
+    }
+    doubleListNode_t out = iterator->previous;
+    if (out != NULL)
+    {
+        iterator->next = out;
+        iterator->previous = out->previous;
+    }
+    iterator->last = out;
+    return out;
+}
+
+int RICK45BLISTS_DoubleIteratorAdd(doubleListIterator_t iterator, void *key)
+{
+    if (iterator == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: iterator cannot be NULL!");
+        return -1;
+    }
+    if (key == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: key cannot be NULL!");
+        return -1;
+    }
+    doubleListNode_t node = RICK45B_Alloc(&iterator->dlinkedList->nodeAllocator, sizeof(struct doubleListNode));
+    if (node == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NO_MEMORY, "Fatal Error: Cannot allocate memory for new node. Maybe the heap is full?");
+        return -1;
+    }
+    node->key = key;
+    RICK45BLISTS_LinkBetweenDouble(iterator->dlinkedList, iterator->previous, node, iterator->next);
+    iterator->previous = node;
+    iterator->last = NULL;
+    return 0;
+}
+
+int RICK45BLISTS_DoubleIteratorRemove(doubleListIterator_t iterator, int delete_bool)
+{
+    if (iterator == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: iterator cannot be NULL!");
+        return -1;
+    }
+    doubleListNode_t node = iterator->last;
+    if (node == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: the iterator has no node to remove! Please consider calling RICK45BLISTS_DoubleIteratorNext first.");
+        return -1;
+    }
+    if (node == iterator->next)     /*it was returned by a backward step*/
+        iterator->next = node->next;
+    else
+        iterator->previous = node->previous;
+    RICK45BLISTS_UnlinkNodeDouble(iterator->dlinkedList, node, delete_bool);
+    iterator->last = NULL;
+    return 0;
+}
+
+void RICK45BLISTS_DoubleListRemoveAllNodes(doubleList_t dlinkedList, int delete_bool){
+
+    doubleListNode_t head = dlinkedList->head;
+    while (head!=NULL)
+    {
+        RICK45BLISTS_DoubleListRemoveHead(dlinkedList, delete_bool);
+        head = dlinkedList->head;
+    }
+    dlinkedList->tail = NULL;
+    dlinkedList->pointedNode = NULL;
+    dlinkedList->cachedNode = NULL;
+}
+
+int RICK45BLISTS_DoubleListRemoveHead(doubleList_t dlinkedList, int delete_bool){
+
+    if (dlinkedList == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list.");
+        return -1;
+    }
+
+    if (dlinkedList->head != NULL)
+    {
+        RICK45BLISTS_UnlinkNodeDouble(dlinkedList, dlinkedList->head, delete_bool);
+    }
+    else
+        dlinkedList->tail = NULL;  /*if head is null, the tail must be as well.*/
+
+    return 0;
+
+}
+
+int RICK45BLISTS_HeadAddDoubleListNode(void *key, doubleList_t dlinkedList)
+{
+    if (dlinkedList == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list.");
+        return -1;
+    }
+    if (key == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: key cannot be NULL!");
+        return -1;
+    }
+
+    doubleListNode_t node = NULL;
+    node = RICK45B_Alloc(&dlinkedList->nodeAllocator, sizeof(struct doubleListNode));
+
+    if (node == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NO_MEMORY, "Fatal Error: Cannot allocate memory for new node. Maybe the heap is full?");
+        return -1;
+    }
+
+    node->key = key;
+    node->next = dlinkedList->head;
+    node->previous = NULL;
+
+    if (dlinkedList->head == NULL)
+    {
+        dlinkedList->head = node;
+        dlinkedList->tail = node;
+    }
+    else
+    {
+        dlinkedList->head->previous = node;
+        dlinkedList->head = node;
+    }
+
+    dlinkedList->cachedPosition++;  /*the cached node, if any, moved one step forward*/
+    dlinkedList->size++;
+    return 0;
+}
+
+size_t RICK45BLISTS_GetDoubleListSize(doubleList_t dlinkedList){
+    if (dlinkedList == NULL)
+        return 0;
+    return dlinkedList->size;
+}
+
+int RICK45BLISTS_TailAddDoubleListNode(void *key, doubleList_t dlinkedList)
+{
+    if (dlinkedList == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list.");
+        return -1;
+    }
+    if (key == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: key cannot be NULL!");
+        return -1;
+    }
+    doubleListNode_t node = RICK45B_Alloc(&dlinkedList->nodeAllocator, sizeof(struct doubleListNode));
+    if (node == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NO_MEMORY, "Fatal Error: Cannot allocate memory for new node. Maybe the heap is full?");
+        return -1;
+    }
+
+    node->next = NULL;
+    node->previous = dlinkedList->tail;
+    node->key = key;
+
+    if (dlinkedList->tail == NULL || dlinkedList->head == NULL)  /*there's no Tail*/
+    {
+        dlinkedList->tail = node;
+        dlinkedList->head = node;
+    }
+    else
+    {
+        dlinkedList->tail->next = node;
+        dlinkedList->tail = node;
+    }
+
+    dlinkedList->size++;
+    return 0;
+}
+
+int RICK45BLISTS_AddDoubleListNode(void *key, doubleList_t dlinkedList, size_t position)
+{
+    if (dlinkedList == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list.");
+        return -1;
+    }
+    if (key == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: key cannot be NULL!");
+        return -1;
+    }
+
+    if (position > dlinkedList->size)
+    {
+        RICK45B_SetError(RICK45B_ERR_OUT_OF_RANGE, "Invalid Argument: Position value out of range for the given double linkedList!");
+        return -1;
+    }
+
+    if (position == dlinkedList->size)
+        RICK45BLISTS_TailAddDoubleListNode(key, dlinkedList);
+    else
+    {
+        if (position == 0)
+            RICK45BLISTS_HeadAddDoubleListNode(key, dlinkedList);
+        else
+            return RICK45BLISTS_AddDoubleListNodeBefore(key, dlinkedList, RICK45BLISTS_GetNodeByPositionDouble(dlinkedList, position));
+    }
+    return 0;
+}
+
+doubleListNode_t RICK45BLISTS_GetNodeByPositionDouble(doubleList_t dlinkedList, size_t position)
+{
+    if (dlinkedList == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list.");
+        return NULL;
+    }
+
+    if (position >= dlinkedList->size)
+    {
+        RICK45B_SetError(RICK45B_ERR_OUT_OF_RANGE, "Invalid Argument: Position value out of range for the given double linkedList!");
+        return NULL;
+    }
+
+    /*starting from the closest of head, tail and last accessed node*/
+    doubleListNode_t temp = dlinkedList->head;
+    size_t i = 0;
+    size_t distance = position;
+    if (dlinkedList->size-1-position < distance)
+    {
+        temp = dlinkedList->tail;
+        i = dlinkedList->size-1;
+        distance = i-position;
+    }
+    if (dlinkedList->cachedNode != NULL)
+    {
+        size_t cachedDistance = position>dlinkedList->cachedPosition ? position-dlinkedList->cachedPosition : dlinkedList->cachedPosition-position;
+        if (cachedDistance < distance)
+        {
+            temp = dlinkedList->cachedNode;
+            i = dlinkedList->cachedPosition;
+        }
+    }
+
+    while (i<position)
+    {
+        temp = temp->next;
+        i++;
+    }
+    while (i>position)
+    {
+        temp = temp->previous;
+        i--;
+    }
+
+    dlinkedList->cachedNode = temp;
+    dlinkedList->cachedPosition = position;
+    return temp;
+}
+
+/*scans the double linked list for the first node with the given key, and moves it as the list's search mode says.*/
+static doubleListNode_t RICK45BLISTS_SelfOrganizingFindDouble(doubleList_t dlinkedList, void *key)
+{
+    doubleListNode_t node = dlinkedList->head;
+    while (node != NULL && dlinkedList->key_cmp(node->key, key))
+        node = node->next;
+    if (node == NULL || node->previous == NULL)    /*not found, or already the head*/
+        return node;
+
+    doubleListNode_t prev = node->previous;
+    doubleListNode_t next = dlinkedList->searchMode == RICK45BLISTS_SEARCH_TRANSPOSE ? prev : dlinkedList->head;
+    prev->next = node->next;
+    if (node->next != NULL) node->next->previous = prev;
+    else    dlinkedList->tail = prev;
+
+    node->previous = next->previous;
+    node->next = next;
+    if (next->previous != NULL) next->previous->next = node;
+    else    dlinkedList->head = node;
+    next->previous = node;
+    dlinkedList->cachedNode = NULL;     /*the positions have changed*/
+    return node;
+}
+
+doubleListNode_t RICK45BLISTS_GetNodeByKeyDouble(doubleList_t dlinkedList, void* key){
+
+    if (dlinkedList == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list.");
+        return NULL;
+    }
+    if (key == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: key cannot be NULL!");
+        return NULL;
+    }
+    if (dlinkedList->head == NULL && dlinkedList->tail == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NOT_FOUND, "RICK45BLISTS_GetNodeByKeyDouble error: no key can be found!");
+        return NULL;     /*no keys can be found*/
+    }
+
+    doubleListNode_t temp = NULL;
+    if (dlinkedList->searchMode != RICK45BLISTS_SEARCH_PLAIN)
+    {
+        temp = RICK45BLISTS_SelfOrganizingFindDouble(dlinkedList, key);
+        if (temp == NULL)
+            RICK45B_SetError(RICK45B_ERR_NOT_FOUND, "RICK45BLISTS_GetNodeByKeyDouble error: no key can be found!");
+        return temp;
+    }
+
+    if (dlinkedList->key_cmp(dlinkedList->head->key, key)==0)
+        temp = dlinkedList->head;
+    else
+    {
+        if (dlinkedList->key_cmp(dlinkedList->tail->key, key)==0)
+            temp = dlinkedList->tail;
+        else
+        {
+            temp = dlinkedList->head;
+            while (temp->next!=NULL && dlinkedList->key_cmp(temp->key, key))
+                temp = temp->next;
+        }
+    }
+
+    if (temp == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NOT_FOUND, "RICK45BLISTS_GetNodeByKeyDouble error: no key can be found!");
+        return NULL;     /*no keys can be found*/
+    }
+
+    if (dlinkedList->key_cmp(temp->key, key)==0)
+        return temp;
+
+    RICK45B_SetError(RICK45B_ERR_NOT_FOUND, "RICK45BLISTS_GetNodeByKeyDouble error: no key can be found!");
+    return NULL;
+}
+
+void *RICK45BLISTS_GetKeyByNodeDouble(doubleListNode_t node)
+{
+    return RICK45BLISTS_GetKeyByNode((listNode_t)node);
+}
+
+void *RICK45BLISTS_GetKeyByPositionDouble(doubleList_t dlinkedList, size_t position)
+{
+    doubleListNode_t node = RICK45BLISTS_GetNodeByPositionDouble(dlinkedList, position);
+    if (node == NULL)
+        return NULL;
+    return node->key;
+}
+
+void *RICK45BLISTS_SetKeyByPositionDouble(doubleList_t dlinkedList, void* newkey, size_t position)
+{
+    if (dlinkedList == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list.");
+        return NULL;
+    }
+
+    if (position > dlinkedList->size)
+    {
+        RICK45B_SetError(RICK45B_ERR_OUT_OF_RANGE, "Invalid Argument: Position value out of range for the given double linkedList!");
+        return NULL;
+    }
+
+    if (newkey == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: new key cannot be NULL!");
+        return NULL;
+    }
+
+    doubleListNode_t temp = NULL;
+    temp = RICK45BLISTS_GetNodeByPositionDouble(dlinkedList, position);
+    if (temp == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_INTERNAL, "Fatal error: couldn't fetch node at that position!");
+        return NULL;
+    }
+
+    void *out = temp->key;
+    temp->key = newkey;
+    return out;
+}
+
+void *RICK45BLISTS_SetKeyByNodeDouble(doubleList_t dlinkedList, void* newkey, doubleListNode_t node)
+{
+    if (dlinkedList == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list.");
+        return NULL;
+    }
+
+    if (node == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Fatal error: Node cannot be NULL!");
+        return NULL;
+    }
+
+    if (newkey == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: new key cannot be NULL!");
+        return NULL;
+    }
+
+    if (dlinkedList->head == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_EMPTY, "Head of the double linkedList is NULL! Please consider adding some nodes first!");
+        return NULL;
+    }
+
+    doubleListNode_t temp = NULL;
+    if (node == dlinkedList->head)
+        temp = dlinkedList->head;
+    else
+    {
+        if (node == dlinkedList->tail)
+            temp = dlinkedList->tail;
+        else
+        {
+            temp = dlinkedList->head;
+            while (temp->next!=NULL && temp!=node)
+                temp = temp->next;
+        }
+    }
+    void *out = node->key;
+    temp->key = newkey;
+    return out;
+}
+
+int RICK45BLISTS_SetKeyByKeyDouble(doubleList_t dlinkedList, void* newkey, void* oldkey)
+{
+    if (dlinkedList == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list.");
+        return -1;
+    }
+
+    if (newkey == NULL || oldkey == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Fatal Error: keys cannot be NULL!");
+        return -1;
+    }
+
+    int cnt = 0;
+    if (dlinkedList->head == NULL && dlinkedList->tail == NULL)
+        return cnt;
+
+    doubleListNode_t temp = dlinkedList->head;
+
+    while (temp!=NULL)
+    {
+        if (dlinkedList->key_cmp(temp->key, oldkey)==0)
+        {
+            temp->key = newkey;
+            cnt++;
+        }
+        temp = temp->next;
+    }
+    return cnt;
+}
+
+int RICK45BLISTS_RemoveNodeDouble(doubleList_t dlinkedList, size_t position, int delete_bool)
+{
+    if (dlinkedList == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list.");
+        return -1;
+    }
+
+    if (dlinkedList->head != NULL)
+    {
+        if (position >= dlinkedList->size)    /*position is out of bound!!*/
+        {
+            RICK45B_SetError(RICK45B_ERR_OUT_OF_RANGE, "Invalid Argument: Position value out of range for the given double linkedList!");
+            return -1;
+        }
+
+        RICK45BLISTS_UnlinkNodeDouble(dlinkedList, RICK45BLISTS_GetNodeByPositionDouble(dlinkedList, position), delete_bool);
+        return 0;
+    }
+    else
+    {
+        RICK45B_SetError(RICK45B_ERR_EMPTY, "Head of the double linkedList is NULL! Please consider adding some nodes first!");
+        dlinkedList->tail = NULL;  /*if head is null, the tail must be as well.*/
+        return -1;
+    }
+}
+
+int RICK45BLISTS_RemoveTailDouble(doubleList_t dlinkedList, int delete_bool)
+{
+    if (dlinkedList == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list.");
+        return -1;
+    }
+
+    if (dlinkedList->tail != NULL)
+    {
+        RICK45BLISTS_UnlinkNodeDouble(dlinkedList, dlinkedList->tail, delete_bool);
+        return 0;
+    }
+    else                        /*if tail is null, head must be as well.*/
+    {
+        RICK45B_SetError(RICK45B_ERR_EMPTY, "Tail of the double linkedList is NULL! Please consider adding some nodes first!");
+        dlinkedList->head = NULL;
+        return -1;
+    }
+}
+
+int RICK45BLISTS_RemoveNodeByKeyDouble(doubleList_t dlinkedList, void *key, int delete_bool)
+{
+    if (dlinkedList == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list.");
+        return -1;
+    }
+
+    if (key == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: key cannot be NULL!");
+        return -1;
+    }
+
+    doubleListNode_t temp = dlinkedList->head;
+
+    if (temp == NULL)
+    {
+        return 0;
+    }
+
+    while (temp->next!=NULL && dlinkedList->key_cmp(temp->key, key))
+        temp = temp->next;
+
+    if (dlinkedList->key_cmp(temp->key, key)==0)   /*node with given key was found.*/
+    {
+        RICK45BLISTS_UnlinkNodeDouble(dlinkedList, temp, delete_bool);
+        return 1;
+    }
+    return 0;
+}
+
+int RICK45BLISTS_RemoveAllNodesByKeyDouble(doubleList_t dlinkedList, void *key, int delete_bool)
+{
+    if (dlinkedList == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list.");
+        return -1;
+    }
+    if (key == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: key cannot be NULL!");
+        return -1;
+    }
+    struct keyMatch match = {dlinkedList->key_cmp, key};
+    return RICK45BLISTS_RemoveIfDoubleImpl(dlinkedList, RICK45BLISTS_KeyMatches, &match, delete_bool);
+}
+
+int RICK45BLISTS_RemoveIfDouble(doubleList_t dlinkedList, RICK45B_predicate_t pred, void *opt, int delete_bool)
+{
+    if (dlinkedList == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list.");
+        return -1;
+    }
+    if (pred == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: pred cannot be NULL!");
+        return -1;
+    }
+    return RICK45BLISTS_RemoveIfDoubleImpl(dlinkedList, pred, opt, delete_bool);
+}
+
+int RICK45BLISTS_RemoveIfDoubleImpl(doubleList_t dlinkedList, RICK45B_predicate_t pred, void *opt, int delete_bool)
+{
+    int cnt = 0;
+    doubleListNode_t node = dlinkedList->head;
+    while (node != NULL)
+    {
+        doubleListNode_t next = node->next;
+        if (pred(node->key, opt))
+        {
+            RICK45BLISTS_UnlinkNodeDouble(dlinkedList, node, delete_bool);
+            cnt++;
+        }
+        node = next;
+    }
+    return cnt;
+}
+
+int RICK45BLISTS_DoubleListSort(doubleList_t dlinkedList)
+{
+    if (dlinkedList == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list.");
+        return -1;
+    }
+    if (dlinkedList->size < 2)
+        return 0;
+
+    doubleListNode_t tail;
+    dlinkedList->head = RICK45BLISTS_MergeSortNodesDouble(dlinkedList->head, dlinkedList->size, dlinkedList->key_cmp, &tail);
+    dlinkedList->tail = tail;
+    dlinkedList->cachedNode = NULL;
+    return 0;
+}
+
+int RICK45BLISTS_InsertSortedDouble(void *key, doubleList_t dlinkedList)
+{
+    if (dlinkedList == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list.");
+        return -1;
+    }
+    if (key == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: key cannot be NULL!");
+        return -1;
+    }
+    doubleListNode_t newNode = RICK45B_Alloc(&dlinkedList->nodeAllocator, sizeof(struct doubleListNode));
+    if (newNode == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NO_MEMORY, "Fatal Error: Cannot allocate memory for new node. Maybe the heap is full?");
+        return -1;
+    }
+    newNode->key = key;
+
+    /*walking back from the tail, up to the last node with a key lower than or equal to the new one*/
+    doubleListNode_t prev = dlinkedList->tail;
+    while (prev != NULL && dlinkedList->key_cmp(prev->key, key) > 0)
+        prev = prev->previous;
+    RICK45BLISTS_LinkBetweenDouble(dlinkedList, prev, newNode, prev!=NULL ? prev->next : dlinkedList->head);
+    return 0;
+}
+
+int RICK45BLISTS_ConcatDouble(doubleList_t dst, doubleList_t src)
+{
+    if (dst == NULL || src == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list.");
+        return -1;
+    }
+    if (dst == src || !RICK45BLISTS_ShareNodeAllocator(&dst->nodeAllocator, &dst->pool, dst->size, &src->nodeAllocator, &src->pool, src->size))
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: the double linkedLists must be different, and take their nodes from the same allocator or from compatible node pools!");
+        return -1;
+    }
+    if (src->size == 0)
+        return 0;
+
+    if (dst->head == NULL)
+        dst->head = src->head;
+    else
+    {
+        dst->tail->next = src->head;
+        src->head->previous = dst->tail;
+    }
+    dst->tail = src->tail;
+    dst->size += src->size;
+
+    src->head = NULL;
+    src->tail = NULL;
+    src->pointedNode = NULL;
+    src->cachedNode = NULL;
+    src->size = 0;
+    return 0;
+}
+
+int RICK45BLISTS_SpliceAfterDouble(doubleList_t dst, doubleListNode_t node, doubleList_t src, doubleListNode_t first, doubleListNode_t last)
+{
+    if (dst == NULL || src == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list.");
+        return -1;
+    }
+    if (dst == src || !RICK45BLISTS_NodeAllocatorsMatch(&dst->nodeAllocator, dst->pool, dst->size, &src->nodeAllocator, src->pool, src->size))
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: the double linkedLists must be different, and take their nodes from the same allocator or from compatible node pools!");
+        return -1;
+    }
+    if (first == NULL || last == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: the range of nodes to move is empty!");
+        return -1;
+    }
+
+    /*counting the range, which also checks that 'last' follows 'first'*/
+    size_t cnt = 1;
+    int movesPointed = first == src->pointedNode;
+    doubleListNode_t temp = first;
+    while (temp != last)
+    {
+        temp = temp->next;
+        if (temp == NULL)
+        {
+            RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: 'last' doesn't follow 'first' inside the source double linkedList!");
+            return -1;
+        }
+        if (temp == src->pointedNode)
+            movesPointed = TRUE;
+        cnt++;
+    }
+
+    RICK45BLISTS_ShareNodeAllocator(&dst->nodeAllocator, &dst->pool, dst->size, &src->nodeAllocator, &src->pool, src->size);  /*the arguments are valid: pools can be shared now*/
+
+    /*unlinking the range from the source*/
+    doubleListNode_t before = first->previous, after = last->next;
+    if (before != NULL) before->next = after;
+    else    src->head = after;
+    if (after != NULL)  after->previous = before;
+    else    src->tail = before;
+    if (movesPointed)
+        src->pointedNode = before!=NULL ? before : after;
+    src->cachedNode = NULL;
+    src->size -= cnt;
+
+    /*linking it into the destination*/
+    doubleListNode_t next = node!=NULL ? node->next : dst->head;
+    first->previous = node;
+    last->next = next;
+    if (node != NULL)   node->next = first;
+    else    dst->head = first;
+    if (next != NULL)   next->previous = last;
+    else    dst->tail = last;
+    dst->cachedNode = NULL;
+    dst->size += cnt;
+    return 0;
+}
+
+doubleList_t RICK45BLISTS_SplitAfterDouble(doubleList_t dlinkedList, doubleListNode_t node)
+{
+    if (dlinkedList == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list.");
+        return NULL;
+    }
+    doubleList_t out = RICK45BLISTS_DoubleListCreateWithAllocator(dlinkedList->key_cmp, &dlinkedList->allocator);
+    if (out == NULL)
+        return NULL;
+    RICK45BLISTS_ShareNodeAllocator(&out->nodeAllocator, &out->pool, 0, &dlinkedList->nodeAllocator, &dlinkedList->pool, dlinkedList->size);
+    doubleListNode_t first = node!=NULL ? node->next : dlinkedList->head;
+    if (first == NULL)
+        return out;
+
+    /*walking both parts at once: the shorter one gives the sizes, and tells in which one the pointed node is*/
+    doubleListNode_t forward = first, backward = node;
+    size_t steps = 0;
+    int pointedMet = FALSE, pointedMoves = FALSE;
+    while (forward != NULL && backward != NULL)
+    {
+        if (forward == dlinkedList->pointedNode)
+            pointedMet = pointedMoves = TRUE;
+        else if (backward == dlinkedList->pointedNode)
+            pointedMet = TRUE;
+        forward = forward->next;
+        backward = backward->previous;
+        steps++;
+    }
+    size_t moved = forward==NULL ? steps : dlinkedList->size-steps;
+    if (!pointedMet)    /*then it is in the part that wasn't walked entirely*/
+        pointedMoves = forward != NULL;
+
+    out->head = first;
+    out->tail = dlinkedList->tail;
+    out->size = moved;
+    first->previous = NULL;
+
+    if (node == NULL)   dlinkedList->head = NULL;
+    else    node->next = NULL;
+    dlinkedList->tail = node;
+    if (pointedMoves && dlinkedList->pointedNode != NULL)
+        dlinkedList->pointedNode = node;
+    dlinkedList->cachedNode = NULL;
+    dlinkedList->size -= moved;
+    return out;
+}
+
+/*works like RICK45BLISTS_MergeSortedInto, on double linked lists.*/
+static void RICK45BLISTS_MergeSortedIntoDouble(doubleList_t dst, doubleList_t src, RICK45B_comparator_t key_cmp, int dropEqual, int delete_bool)
+{
+    doubleListNode_t prev = NULL, d = dst->head;
+    size_t left = src->size;
+    while (src->head != NULL)
+    {
+        doubleListNode_t s = src->head;
+        if (d == NULL)  /*what's left of 'src' goes after the tail, in one step*/
+        {
+            s->previous = prev;
+            if (prev == NULL)   dst->head = s;
+            else    prev->next = s;
+            dst->tail = src->tail;
+            dst->size += left;
+            break;
+        }
+        int c = key_cmp(d->key, s->key);
+        if (c < 0 || (c == 0 && !dropEqual))
+        {
+            prev = d;
+            d = d->next;
+        }
+        else
+        {
+            src->head = s->next;
+            left--;
+            if (c == 0)
+            {
+                if (delete_bool)
+                    freeFun(s->key);
+                RICK45B_Free(&src->nodeAllocator, s);
+            }
+            else
+            {
+                RICK45BLISTS_LinkBetweenDouble(dst, prev, s, d);
+                prev = s;
+            }
+        }
+    }
+
+    src->head = NULL;
+    src->tail = NULL;
+    src->pointedNode = NULL;
+    src->cachedNode = NULL;
+    src->size = 0;
+}
+
+/*works like RICK45BLISTS_FilterSorted, on double linked lists.*/
+static int RICK45BLISTS_FilterSortedDouble(doubleList_t dst, doubleList_t src, int keepCommon, int delete_bool)
+{
+    int cnt = 0;
+    doubleListNode_t d = dst->head, s = src->head;
+    while (d != NULL)
+    {
+        doubleListNode_t next = d->next;
+        int c = s!=NULL ? dst->key_cmp(s->key, d->key) : 1;
+        while (c < 0)
+        {
+            s = s->next;
+            c = s!=NULL ? dst->key_cmp(s->key, d->key) : 1;
+        }
+        if ((c == 0) != (keepCommon != 0))
+        {
+            RICK45BLISTS_UnlinkNodeDouble(dst, d, delete_bool);
+            cnt++;
+        }
+        d = next;
+    }
+    return cnt;
+}
+
+int RICK45BLISTS_SortedUnionDouble(doubleList_t dst, doubleList_t src, int delete_bool)
+{
+    if (dst == NULL || src == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list.");
+        return -1;
+    }
+    if (dst == src || !RICK45BLISTS_ShareNodeAllocator(&dst->nodeAllocator, &dst->pool, dst->size, &src->nodeAllocator, &src->pool, src->size))
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: the double linkedLists must be different, and take their nodes from the same allocator or from compatible node pools!");
+        return -1;
+    }
+    RICK45BLISTS_MergeSortedIntoDouble(dst, src, dst->key_cmp, TRUE, delete_bool);
+    return 0;
+}
+
+int RICK45BLISTS_SortedIntersectionDouble(doubleList_t dst, doubleList_t src, int delete_bool)
+{
+    if (dst == NULL || src == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list.");
+        return -1;
+    }
+    if (dst == src)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: the double linkedLists must be different!");
+        return -1;
+    }
+    return RICK45BLISTS_FilterSortedDouble(dst, src, TRUE, delete_bool);
+}
+
+int RICK45BLISTS_SortedDifferenceDouble(doubleList_t dst, doubleList_t src, int delete_bool)
+{
+    if (dst == NULL || src == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list.");
+        return -1;
+    }
+    if (dst == src)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: the double linkedLists must be different!");
+        return -1;
+    }
+    return RICK45BLISTS_FilterSortedDouble(dst, src, FALSE, delete_bool);
+}
+
+int RICK45BLISTS_SortedDedupDouble(doubleList_t dlinkedList, int delete_bool)
+{
+    if (dlinkedList == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list.");
+        return -1;
+    }
+    if (dlinkedList->head == NULL)
+        return 0;
+
+    int cnt = 0;
+    doubleListNode_t node = dlinkedList->head->next;
+    while (node != NULL)
+    {
+        doubleListNode_t next = node->next;
+        if (dlinkedList->key_cmp(node->previous->key, node->key) == 0)
+        {
+            RICK45BLISTS_UnlinkNodeDouble(dlinkedList, node, delete_bool);
+            cnt++;
+        }
+        node = next;
+    }
     return cnt;
 }
+
+int RICK45BLISTS_SortedMergeDouble(doubleList_t dst, doubleList_t *srcs, size_t k)
+{
+    if (dst == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list.");
+        return -1;
+    }
+    if (srcs == NULL && k != 0)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: srcs cannot be NULL!");
+        return -1;
+    }
+    size_t i, j, step;
+    doubleList_t ref = dst;     /*the first list with a pool, if any: every other list must be able to share it*/
+    for (i = 0; i<k; i++)
+    {
+        if (srcs[i] == NULL)
+        {
+            RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list.");
+            return -1;
+        }
+        if (ref->pool == NULL && srcs[i]->pool != NULL)
+            ref = srcs[i];
+    }
+    for (i = 0; i<k; i++)       /*nothing is changed until all the lists have been checked*/
+    {
+        if (srcs[i] == dst || !RICK45BLISTS_NodeAllocatorsMatch(&ref->nodeAllocator, ref->pool, ref->size, &srcs[i]->nodeAllocator, srcs[i]->pool, srcs[i]->size)
+            || !RICK45BLISTS_NodeAllocatorsMatch(&ref->nodeAllocator, ref->pool, ref->size, &dst->nodeAllocator, dst->pool, dst->size))
+        {
+            RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: the double linkedLists must be different, and take their nodes from the same allocator or from compatible node pools!");
+            return -1;
+        }
+        for (j = 0; j<i; j++)
+            if (srcs[j] == srcs[i])     /*merging a list into itself would empty it*/
+            {
+                RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: the same double linkedList appears more than once in srcs!");
+                return -1;
+            }
+    }
+    for (i = 0; i<k; i++)
+        RICK45BLISTS_ShareNodeAllocator(&dst->nodeAllocator, &dst->pool, dst->size, &srcs[i]->nodeAllocator, &srcs[i]->pool, srcs[i]->size);
+
+    /*merging in pairs: srcs[i] takes srcs[i+step], so that equal keys keep the order of their lists*/
+    for (step = 1; step<k; step *= 2)
+        for (i = 0; i+step<k; i += 2*step)
+            RICK45BLISTS_MergeSortedIntoDouble(srcs[i], srcs[i+step], dst->key_cmp, FALSE, FALSE);
+    if (k > 0)
+        RICK45BLISTS_MergeSortedIntoDouble(dst, srcs[0], dst->key_cmp, FALSE, FALSE);
+    return 0;
+}
+
+int RICK45BLISTS_AddDoubleListNodeAfter(void *key, doubleList_t dlinkedList, doubleListNode_t node)
+{
+    if (dlinkedList == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list.");
+        return -1;
+    }
+    if (key == NULL || node == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: key and node cannot be NULL!");
+        return -1;
+    }
+    doubleListNode_t newNode = RICK45B_Alloc(&dlinkedList->nodeAllocator, sizeof(struct doubleListNode));
+    if (newNode == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NO_MEMORY, "Fatal Error: Cannot allocate memory for new node. Maybe the heap is full?");
+        return -1;
+    }
+    newNode->key = key;
+    RICK45BLISTS_LinkBetweenDouble(dlinkedList, node, newNode, node->next);
+    return 0;
+}
+
+int RICK45BLISTS_AddDoubleListNodeBefore(void *key, doubleList_t dlinkedList, doubleListNode_t node)
+{
+    if (dlinkedList == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list.");
+        return -1;
+    }
+    if (key == NULL || node == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: key and node cannot be NULL!");
+        return -1;
+    }
+    doubleListNode_t newNode = RICK45B_Alloc(&dlinkedList->nodeAllocator, sizeof(struct doubleListNode));
+    if (newNode == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NO_MEMORY, "Fatal Error: Cannot allocate memory for new node. Maybe the heap is full?");
+        return -1;
+    }
+    newNode->key = key;
+    RICK45BLISTS_LinkBetweenDouble(dlinkedList, node->previous, newNode, node);
+    return 0;
+}
+
+int RICK45BLISTS_RemoveByNodeDouble(doubleList_t dlinkedList, doubleListNode_t node, int delete_bool)
+{
+    if (dlinkedList == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list.");
+        return -1;
+    }
+    if (node == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: node cannot be NULL!");
+        return -1;
+    }
+    RICK45BLISTS_UnlinkNodeDouble(dlinkedList, node, delete_bool);
+    return 0;
+}
+
+doubleListNode_t RICK45BLISTS_MergeSortNodesDouble(doubleListNode_t head, size_t size, RICK45B_comparator_t key_cmp, doubleListNode_t *tail)
+{
+    struct doubleListNode sorted;   /*placeholder before the first node*/
+    size_t width;
+    sorted.next = head;
+    for (width = 1; width<size; width *= 2)     /*merging pairs of sorted runs of 'width' nodes*/
+    {
+        doubleListNode_t last = &sorted;
+        doubleListNode_t rest = sorted.next;
+        while (rest != NULL)
+        {
+            doubleListNode_t left = rest, right, node;
+            size_t leftSize, rightSize = 0;
+            for (leftSize = 1, node = left; leftSize<width && node->next != NULL; leftSize++)
+                node = node->next;
+            right = node->next;
+            node->next = NULL;
+            if (right != NULL)
+            {
+                for (rightSize = 1, node = right; rightSize<width && node->next != NULL; rightSize++)
+                    node = node->next;
+                rest = node->next;
+                node->next = NULL;
+            }
+            else
+                rest = NULL;
+
+            while (left != NULL && right != NULL)   /*on equal keys the left run goes first: the sort is stable*/
+            {
+                if (key_cmp(left->key, right->key) <= 0)
+                {
+                    last->next = left;
+                    left = left->next;
+                }
+                else
+                {
+                    last->next = right;
+                    right = right->next;
+                }
+                last = last->next;
+            }
+            last->next = left!=NULL ? left : right;
+            while (last->next != NULL)
+                last = last->next;
+        }
+    }
+
+    /*rebuilding the backward links*/
+    doubleListNode_t node, prev = NULL;
+    for (node = sorted.next; node != NULL; node = node->next)
+    {
+        node->previous = prev;
+        prev = node;
+    }
+    *tail = prev;
+    return sorted.next;
+}
+
+void RICK45BLISTS_LinkBetweenDouble(doubleList_t dlinkedList, doubleListNode_t prev, doubleListNode_t node, doubleListNode_t next)
+{
+    node->previous = prev;
+    node->next = next;
+    if (prev == NULL)   /*every position moves one step forward*/
+        dlinkedList->cachedPosition++;
+    else if (next != NULL)  /*the positions after the new node are shifted: the cache can't be trusted anymore*/
+        dlinkedList->cachedNode = NULL;
+    if (prev != NULL)   prev->next = node;
+    else    dlinkedList->head = node;
+    if (next != NULL)   next->previous = node;
+    else    dlinkedList->tail = node;
+    dlinkedList->size++;
+}
+
+void RICK45BLISTS_UnlinkNodeDouble(doubleList_t dlinkedList, doubleListNode_t node, int delete_bool)
+{
+    if (node->previous != NULL) node->previous->next = node->next;
+    else    dlinkedList->head = node->next;
+    if (node->next != NULL) node->next->previous = node->previous;
+    else    dlinkedList->tail = node->previous;
+    if (node == dlinkedList->pointedNode)
+        dlinkedList->pointedNode = node->previous!=NULL ? node->previous : node->next;
+    if (node == dlinkedList->cachedNode || (node->previous != NULL && node->next != NULL))
+        dlinkedList->cachedNode = NULL;
+    else if (node->previous == NULL)    /*removing the head: every position moves one step back*/
+        dlinkedList->cachedPosition--;
+
+    if (delete_bool)
+        freeFun(node->key);
+    RICK45B_Free(&dlinkedList->nodeAllocator, node);
+    dlinkedList->size--;
+}
+
+unrolledList_t RICK45BLISTS_UnrolledListCreate(RICK45B_comparator_t key_cmp)
+{
+    return RICK45BLISTS_UnrolledListCreateWithAllocator(key_cmp, NULL);
+}
+
+unrolledList_t RICK45BLISTS_UnrolledListCreateWithAllocator(RICK45B_comparator_t key_cmp, allocator_t allocator)
+{
+    if (key_cmp == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: key_cmp function cannot be NULL!");
+        return NULL;
+    }
+    if (allocator != NULL && (allocator->alloc_funct == NULL || allocator->free_funct == NULL))
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: the allocator's functions cannot be NULL!");
+        return NULL;
+    }
+
+    struct allocator alloc = RICK45B_PickAllocator(allocator);
+    unrolledList_t out = RICK45B_Alloc(&alloc, sizeof(struct unrolledList));
+    if (out == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NO_MEMORY, "Fatal Error: Cannot allocate memory for new unrolledList_t type. Perhaps the heap is full?");
+        return NULL;
+    }
+    out->head = NULL;
+    out->tail = NULL;
+    out->key_cmp = key_cmp;
+    out->size = 0;
+    out->allocator = alloc;
+    return out;
+}
+
+void RICK45BLISTS_UnrolledListDestroy(unrolledList_t *ulist, int delete_bool)
+{
+    if (ulist != NULL && *ulist != NULL)
+    {
+        struct allocator alloc = (*ulist)->allocator;
+        RICK45BLISTS_RemoveAllKeysUnrolled(*ulist, delete_bool);
+        RICK45B_Free(&alloc, *ulist);
+        *ulist = NULL;
+    }
+}
+
+/*returns a new empty node, linked right after 'prev' (at the head if 'prev' is NULL), or NULL if it can't be allocated.*/
+static unrolledListNode_t RICK45BLISTS_UnrolledNodeCreate(unrolledList_t ulist, unrolledListNode_t prev)
+{
+    unrolledListNode_t node = RICK45B_Alloc(&ulist->allocator, sizeof(struct unrolledListNode));
+    if (node == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NO_MEMORY, "Fatal Error: Cannot allocate memory for new node. Maybe the heap is full?");
+        return NULL;
+    }
+    node->count = 0;
+    if (prev == NULL)
+    {
+        node->next = ulist->head;
+        ulist->head = node;
+    }
+    else
+    {
+        node->next = prev->next;
+        prev->next = node;
+    }
+    if (node->next == NULL)
+        ulist->tail = node;
+    return node;
+}
+
+int RICK45BLISTS_HeadAddUnrolledListKey(void *key, unrolledList_t ulist)
+{
+    return RICK45BLISTS_AddUnrolledListKey(key, ulist, 0);
+}
+
+int RICK45BLISTS_TailAddUnrolledListKey(void *key, unrolledList_t ulist)
+{
+    if (ulist == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: unrolled list is NULL! Before using it, please consider using RICK45BLISTS_UnrolledListCreate to initialize the unrolled list.");
+        return -1;
+    }
+    return RICK45BLISTS_AddUnrolledListKey(key, ulist, ulist->size);
+}
+
+int RICK45BLISTS_AddUnrolledListKey(void *key, unrolledList_t ulist, size_t position)
+{
+    if (ulist == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: unrolled list is NULL! Before using it, please consider using RICK45BLISTS_UnrolledListCreate to initialize the unrolled list.");
+        return -1;
+    }
+    if (key == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: key cannot be NULL!");
+        return -1;
+    }
+    if (position > ulist->size)
+    {
+        RICK45B_SetError(RICK45B_ERR_OUT_OF_RANGE, "Invalid Argument: Position value out of range for the given unrolled list!");
+        return -1;
+    }
+
+    unrolledListNode_t prev, node;
+    size_t index = position, i;
+    if (ulist->head == NULL)
+    {
+        node = RICK45BLISTS_UnrolledNodeCreate(ulist, NULL);
+        if (node == NULL)   return -1;
+    }
+    else if (position == ulist->size)   /*appending: no need to walk*/
+    {
+        node = ulist->tail;
+        index = node->count;
+    }
+    else
+        node = RICK45BLISTS_UnrolledSeek(ulist, &index, &prev);
+
+    if (node->count == RICK45BLISTS_UNROLLED_CAPACITY)
+    {
+        unrolledListNode_t newNode = RICK45BLISTS_UnrolledNodeCreate(ulist, node);
+        if (newNode == NULL)    return -1;
+        if (index == RICK45BLISTS_UNROLLED_CAPACITY)    /*appending to a full node: the new one stays empty, so sequential appends fill every node*/
+        {
+            node = newNode;
+            index = 0;
+        }
+        else    /*splitting the node in two halves*/
+        {
+            for (i = RICK45BLISTS_UNROLLED_CAPACITY/2; i<RICK45BLISTS_UNROLLED_CAPACITY; i++)
+                newNode->keys[i-RICK45BLISTS_UNROLLED_CAPACITY/2] = node->keys[i];
+            newNode->count = RICK45BLISTS_UNROLLED_CAPACITY-RICK45BLISTS_UNROLLED_CAPACITY/2;
+            node->count = RICK45BLISTS_UNROLLED_CAPACITY/2;
+            if (index > node->count)
+            {
+                index -= node->count;
+                node = newNode;
+            }
+        }
+    }
+
+    for (i = node->count; i>index; i--)
+        node->keys[i] = node->keys[i-1];
+    node->keys[index] = key;
+    node->count++;
+    ulist->size++;
+    return 0;
+}
+
+size_t RICK45BLISTS_GetUnrolledListSize(unrolledList_t ulist)
+{
+    if (ulist == NULL)
+        return 0;
+    return ulist->size;
+}
+
+void *RICK45BLISTS_GetKeyByPositionUnrolled(unrolledList_t ulist, size_t position)
+{
+    if (ulist == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: unrolled list is NULL! Before using it, please consider using RICK45BLISTS_UnrolledListCreate to initialize the unrolled list.");
+        return NULL;
+    }
+    if (position >= ulist->size)
+    {
+        RICK45B_SetError(RICK45B_ERR_OUT_OF_RANGE, "Invalid Argument: Position value out of range for the given unrolled list!");
+        return NULL;
+    }
+    unrolledListNode_t prev;
+    unrolledListNode_t node = RICK45BLISTS_UnrolledSeek(ulist, &position, &prev);
+    return node->keys[position];
+}
+
+void *RICK45BLISTS_SetKeyByPositionUnrolled(unrolledList_t ulist, void *newkey, size_t position)
+{
+    if (ulist == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: unrolled list is NULL! Before using it, please consider using RICK45BLISTS_UnrolledListCreate to initialize the unrolled list.");
+        return NULL;
+    }
+    if (newkey == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: new key cannot be NULL!");
+        return NULL;
+    }
+    if (position >= ulist->size)
+    {
+        RICK45B_SetError(RICK45B_ERR_OUT_OF_RANGE, "Invalid Argument: Position value out of range for the given unrolled list!");
+        return NULL;
+    }
+    unrolledListNode_t prev;
+    unrolledListNode_t node = RICK45BLISTS_UnrolledSeek(ulist, &position, &prev);
+    void *out = node->keys[position];
+    node->keys[position] = newkey;
+    return out;
+}
+
+void *RICK45BLISTS_GetKeyByKeyUnrolled(unrolledList_t ulist, void *key)
+{
+    if (ulist == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: unrolled list is NULL! Before using it, please consider using RICK45BLISTS_UnrolledListCreate to initialize the unrolled list.");
+        return NULL;
+    }
+    if (key == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: key cannot be NULL!");
+        return NULL;
+    }
+
+    unrolledListNode_t node;
+    size_t i;
+    for (node = ulist->head; node != NULL; node = node->next)
+        for (i = 0; i<node->count; i++)
+            if (ulist->key_cmp(node->keys[i], key)==0)
+                return node->keys[i];
+
+    RICK45B_SetError(RICK45B_ERR_NOT_FOUND, "RICK45BLISTS_GetKeyByKeyUnrolled error: no key can be found!");
+    return NULL;
+}
+
+int RICK45BLISTS_RemoveKeyUnrolled(unrolledList_t ulist, size_t position, int delete_bool)
+{
+    if (ulist == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: unrolled list is NULL! Before using it, please consider using RICK45BLISTS_UnrolledListCreate to initialize the unrolled list.");
+        return -1;
+    }
+    if (position >= ulist->size)
+    {
+        RICK45B_SetError(RICK45B_ERR_OUT_OF_RANGE, "Invalid Argument: Position value out of range for the given unrolled list!");
+        return -1;
+    }
+    unrolledListNode_t prev;
+    unrolledListNode_t node = RICK45BLISTS_UnrolledSeek(ulist, &position, &prev);
+    RICK45BLISTS_UnrolledRemoveAt(ulist, node, prev, position, delete_bool);
+    return 0;
+}
+
+int RICK45BLISTS_RemoveKeyByKeyUnrolled(unrolledList_t ulist, void *key, int delete_bool)
+{
+    if (ulist == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: unrolled list is NULL! Before using it, please consider using RICK45BLISTS_UnrolledListCreate to initialize the unrolled list.");
+        return -1;
+    }
+    if (key == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: key cannot be NULL!");
+        return -1;
+    }
+
+    unrolledListNode_t node, prev = NULL;
+    size_t i;
+    for (node = ulist->head; node != NULL; prev = node, node = node->next)
+        for (i = 0; i<node->count; i++)
+            if (ulist->key_cmp(node->keys[i], key)==0)
+            {
+                RICK45BLISTS_UnrolledRemoveAt(ulist, node, prev, i, delete_bool);
+                return 1;
+            }
+    return 0;
+}
+
+void RICK45BLISTS_RemoveAllKeysUnrolled(unrolledList_t ulist, int delete_bool)
+{
+    if (ulist == NULL)
+        return;
+    unrolledListNode_t node = ulist->head;
+    while (node != NULL)
+    {
+        unrolledListNode_t next = node->next;
+        size_t i;
+        if (delete_bool)
+            for (i = 0; i<node->count; i++)
+                freeFun(node->keys[i]);
+        RICK45B_Free(&ulist->allocator, node);
+        node = next;
+    }
+    ulist->head = NULL;
+    ulist->tail = NULL;
+    ulist->size = 0;
+}
+
+int RICK45BLISTS_UnrolledListforEach(unrolledList_t ulist, RICK45B_forEach_t funct, void *opt)
+{
+    if (ulist == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: unrolled list is NULL! Before using it, please consider using RICK45BLISTS_UnrolledListCreate to initialize the unrolled list.");
+        return -1;
+    }
+    if (funct == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: funct cannot be NULL!");
+        return -1;
+    }
+
+    unrolledListNode_t node;
+    size_t i;
+    for (node = ulist->head; node != NULL; node = node->next)
+        for (i = 0; i<node->count; i++)
+            if (funct(node->keys[i], opt) == -1)
+            {
+                RICK45B_SetError(RICK45B_ERR_CALLBACK, "Provided function error!");
+                return -1;
+            }
+    return 0;
+}
+
+int RICK45BLISTS_UnrolledIteratorInit(unrolledListIterator_t iterator, unrolledList_t ulist)
+{
+    if (iterator == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: iterator cannot be NULL!");
+        return -1;
+    }
+    if (ulist == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: unrolled list is NULL! Before using it, please consider using RICK45BLISTS_UnrolledListCreate to initialize the unrolled list.");
+        return -1;
+    }
+    iterator->ulist = ulist;
+    iterator->node = ulist->head;
+    iterator->index = 0;
+    return 0;
+}
+
+int RICK45BLISTS_UnrolledIteratorHasNext(unrolledListIterator_t iterator)
+{
+    if (iterator == NULL)
+        return 0;
+    return iterator->node != NULL;
+}
+
+void *RICK45BLISTS_UnrolledIteratorNext(unrolledListIterator_t iterator)
+{
+    if (iterator == NULL || iterator->node == NULL)
+        return NULL;
+    void *out = iterator->node->keys[iterator->index];
+    if (++iterator->index == iterator->node->count)
+    {
+        iterator->node = iterator->node->next;
+        iterator->index = 0;
+    }
+    return out;
+}
+
+unrolledListNode_t RICK45BLISTS_UnrolledSeek(unrolledList_t ulist, size_t *position, unrolledListNode_t *prev)
+{
+    unrolledListNode_t node = ulist->head;
+    *prev = NULL;
+    while (node->next != NULL && *position >= node->count)
+    {
+        *position -= node->count;
+        *prev = node;
+        node = node->next;
+    }
+    return node;
+}
+
+void RICK45BLISTS_UnrolledRemoveAt(unrolledList_t ulist, unrolledListNode_t node, unrolledListNode_t prev, size_t index, int delete_bool)
+{
+    size_t i;
+    if (delete_bool)
+        freeFun(node->keys[index]);
+    for (i = index+1; i<node->count; i++)
+        node->keys[i-1] = node->keys[i];
+    node->count--;
+    ulist->size--;
+
+    unrolledListNode_t next = node->next;
+    if (node->count == 0)   /*releasing the empty node*/
+    {
+        if (prev == NULL)   ulist->head = next;
+        else    prev->next = next;
+        if (next == NULL)   ulist->tail = prev;
+        RICK45B_Free(&ulist->allocator, node);
+    }
+    else if (node->count < RICK45BLISTS_UNROLLED_CAPACITY/2 && next != NULL)
+    {
+        if (node->count+next->count <= RICK45BLISTS_UNROLLED_CAPACITY)  /*merging the next node into this one*/
+        {
+            for (i = 0; i<next->count; i++)
+                node->keys[node->count+i] = next->keys[i];
+            node->count += next->count;
+            node->next = next->next;
+            if (next == ulist->tail)
+                ulist->tail = node;
+            RICK45B_Free(&ulist->allocator, next);
+        }
+        else    /*borrowing keys from the next node, so that both end up at least half full*/
+        {
+            size_t moved = (next->count-node->count)/2;
+            for (i = 0; i<moved; i++)
+                node->keys[node->count+i] = next->keys[i];
+            for (i = moved; i<next->count; i++)
+                next->keys[i-moved] = next->keys[i];
+            node->count += moved;
+            next->count -= moved;
+        }
+    }
+}
+
+/*low bits of the 'next' field of a concurrent list node: nodes are aligned to at least 4 bytes.*/
+#define RICK45BLISTS_DELETED_BIT ((size_t)1)     /*the node is logically deleted.*/
+#define RICK45BLISTS_FREE_KEY_BIT ((size_t)2)    /*the key is freed together with the node.*/
+#define RICK45BLISTS_UNMARKED(node) ((concurrentListNode_t)((size_t)(node) & ~(RICK45BLISTS_DELETED_BIT|RICK45BLISTS_FREE_KEY_BIT)))
+
+/*where the lookup of a key has stopped: 'cur' is the first node with a key not lower than it (or NULL).*/
+struct concurrentPosition{
+    concurrentListNode_t *prev;     /*link pointing to 'cur'.*/
+    concurrentListNode_t cur;
+    concurrentListNode_t next;      /*successor of 'cur', unmarked.*/
+};
+
+concurrentList_t RICK45BLISTS_ConcurrentListCreate(RICK45B_comparator_t key_cmp)
+{
+    return RICK45BLISTS_ConcurrentListCreateWithAllocator(key_cmp, NULL);
+}
+
+concurrentList_t RICK45BLISTS_ConcurrentListCreateWithAllocator(RICK45B_comparator_t key_cmp, allocator_t allocator)
+{
+    if (key_cmp == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: key_cmp function cannot be NULL!");
+        return NULL;
+    }
+    if (allocator != NULL && (allocator->alloc_funct == NULL || allocator->free_funct == NULL))
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: the allocator's functions cannot be NULL!");
+        return NULL;
+    }
+
+    struct allocator alloc = RICK45B_PickAllocator(allocator);
+    concurrentList_t out = RICK45B_Alloc(&alloc, sizeof(struct concurrentList));
+    if (out == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NO_MEMORY, "Fatal Error: Cannot allocate memory for new concurrentList_t type. Perhaps the heap is full?");
+        return NULL;
+    }
+    out->head = NULL;
+    out->key_cmp = key_cmp;
+    out->size = 0;
+    out->records = NULL;
+    out->recordCount = 0;
+    out->allocator = alloc;
+    return out;
+}
+
+/*releases a node that is no longer reachable, with its key if its removal asked for it.*/
+static void RICK45BLISTS_ConcurrentNodeFree(concurrentList_t clist, concurrentListNode_t node)
+{
+    if ((size_t)node->next & RICK45BLISTS_FREE_KEY_BIT)
+        freeFun(node->key);
+    RICK45B_Free(&clist->allocator, node);
+}
+
+void RICK45BLISTS_ConcurrentListDestroy(concurrentList_t *clist, int delete_bool)
+{
+    if (clist != NULL && *clist != NULL)
+    {
+        struct allocator alloc = (*clist)->allocator;
+        concurrentListNode_t node = (*clist)->head;
+        struct hazardRecord *record = (*clist)->records;
+        while (node != NULL)
+        {
+            concurrentListNode_t next = RICK45BLISTS_UNMARKED(node->next);
+            if ((size_t)node->next & RICK45BLISTS_DELETED_BIT)  /*removed, but not unlinked yet*/
+                RICK45BLISTS_ConcurrentNodeFree(*clist, node);
+            else
+            {
+                if (delete_bool)
+                    freeFun(node->key);
+                RICK45B_Free(&alloc, node);
+            }
+            node = next;
+        }
+        while (record != NULL)
+        {
+            struct hazardRecord *next = record->next;
+            while (record->retired != NULL)
+            {
+                node = record->retired;
+                record->retired = node->retired;
+                RICK45BLISTS_ConcurrentNodeFree(*clist, node);
+            }
+            RICK45B_Free(&alloc, record);
+            record = next;
+        }
+        RICK45B_Free(&alloc, *clist);
+        *clist = NULL;
+    }
+}
+
+/*returns a hazard record for the calling operation: an idle one, or a new one.*/
+static struct hazardRecord *RICK45BLISTS_HazardAcquire(concurrentList_t clist)
+{
+    struct hazardRecord *record;
+    for (record = __atomic_load_n(&clist->records, __ATOMIC_ACQUIRE); record != NULL; record = record->next)
+    {
+        int idle = FALSE;
+        if (!__atomic_load_n(&record->active, __ATOMIC_RELAXED) && __atomic_compare_exchange_n(&record->active, &idle, TRUE, 0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+            return record;
+    }
+
+    record = RICK45B_Alloc(&clist->allocator, sizeof(struct hazardRecord));
+    if (record == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NO_MEMORY, "Fatal Error: Cannot allocate memory for a new hazard record. Perhaps the heap is full?");
+        return NULL;
+    }
+    size_t i;
+    for (i = 0; i<RICK45BLISTS_HAZARDS; i++)
+        record->hazards[i] = NULL;
+    record->active = TRUE;
+    record->retired = NULL;
+    record->retiredCount = 0;
+    record->next = __atomic_load_n(&clist->records, __ATOMIC_RELAXED);
+    while (!__atomic_compare_exchange_n(&clist->records, &record->next, record, 1, __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+    __atomic_fetch_add(&clist->recordCount, 1, __ATOMIC_RELAXED);
+    return record;
+}
+
+static void RICK45BLISTS_HazardRelease(struct hazardRecord *record)
+{
+    size_t i;
+    for (i = 0; i<RICK45BLISTS_HAZARDS; i++)
+        __atomic_store_n(&record->hazards[i], NULL, __ATOMIC_RELEASE);
+    __atomic_store_n(&record->active, FALSE, __ATOMIC_RELEASE);
+}
+
+/*returns TRUE if a running operation holds a hazard pointer to the node. Sequentially consistent, like the unlinks.*/
+static int RICK45BLISTS_HazardProtected(concurrentList_t clist, concurrentListNode_t node)
+{
+    struct hazardRecord *record;
+    size_t i;
+    for (record = __atomic_load_n(&clist->records, __ATOMIC_ACQUIRE); record != NULL; record = record->next)
+        for (i = 0; i<RICK45BLISTS_HAZARDS; i++)
+            if (__atomic_load_n(&record->hazards[i], __ATOMIC_SEQ_CST) == node)
+                return TRUE;
+    return FALSE;
+}
+
+/*
+ * hands an unlinked node over to the record, and releases the record's nodes no longer protected once they are
+ * twice the hazard pointers in use, so that every scan releases at least half of them.
+*/
+static void RICK45BLISTS_Retire(concurrentList_t clist, struct hazardRecord *record, concurrentListNode_t node)
+{
+    node->retired = record->retired;
+    record->retired = node;
+    record->retiredCount++;
+    if (record->retiredCount < 2*RICK45BLISTS_HAZARDS*__atomic_load_n(&clist->recordCount, __ATOMIC_RELAXED))
+        return;
+
+    concurrentListNode_t kept = NULL;
+    record->retiredCount = 0;
+    while (record->retired != NULL)
+    {
+        node = record->retired;
+        record->retired = node->retired;
+        if (RICK45BLISTS_HazardProtected(clist, node))
+        {
+            node->retired = kept;
+            kept = node;
+            record->retiredCount++;
+        }
+        else
+            RICK45BLISTS_ConcurrentNodeFree(clist, node);
+    }
+    record->retired = kept;
+}
+
+/*
+ * one walk of RICK45BLISTS_ConcurrentFind. Returns -1 if the walk has to start again from the head (a link it relies
+ * on has changed), otherwise TRUE if 'position->cur' holds the key.
+*/
+static int RICK45BLISTS_ConcurrentWalk(concurrentList_t clist, struct hazardRecord *record, void *key, struct concurrentPosition *position)
+{
+    /*
+     * slots of the hazard pointers to the node before the current one, the current one and the one after it: they
+     * rotate as the walk moves on, so that every step publishes a single hazard pointer.
+    */
+    size_t hazardPrev = 0, hazardCur = 1, hazardNext = 2, hazardFree;
+    concurrentListNode_t *prev = &clist->head;
+    concurrentListNode_t cur = __atomic_load_n(prev, __ATOMIC_SEQ_CST);
+    concurrentListNode_t next;
+    __atomic_store_n(&record->hazards[hazardCur], cur, __ATOMIC_SEQ_CST);
+    if (__atomic_load_n(prev, __ATOMIC_SEQ_CST) != cur)
+        return -1;
+
+    for (;;)
+    {
+        if (cur == NULL)
+        {
+            position->prev = prev;
+            position->cur = NULL;
+            position->next = NULL;
+            return FALSE;
+        }
+        next = __atomic_load_n(&cur->next, __ATOMIC_SEQ_CST);
+        __atomic_store_n(&record->hazards[hazardNext], RICK45BLISTS_UNMARKED(next), __ATOMIC_SEQ_CST);
+        if (__atomic_load_n(&cur->next, __ATOMIC_SEQ_CST) != next)
+            return -1;
+        void *curKey = cur->key;
+        if (__atomic_load_n(prev, __ATOMIC_SEQ_CST) != cur)   /*'cur' is still linked: its key was valid*/
+            return -1;
+
+        if (!((size_t)next & RICK45BLISTS_DELETED_BIT))
+        {
+            int cmp = clist->key_cmp(curKey, key);
+            if (cmp >= 0)
+            {
+                position->prev = prev;
+                position->cur = cur;
+                position->next = next;
+                return cmp == 0;
+            }
+            prev = &cur->next;
+            hazardFree = hazardPrev;    /*'cur' becomes the node before the current one*/
+            hazardPrev = hazardCur;
+        }
+        else    /*helping the removal of 'cur'*/
+        {
+            concurrentListNode_t expected = cur;
+            if (!__atomic_compare_exchange_n(prev, &expected, RICK45BLISTS_UNMARKED(next), 0, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST))
+                return -1;
+            RICK45BLISTS_Retire(clist, record, cur);
+            hazardFree = hazardCur;
+        }
+        cur = RICK45BLISTS_UNMARKED(next);
+        hazardCur = hazardNext;
+        hazardNext = hazardFree;
+    }
+}
+
+/*looks the key up, unlinking the deleted nodes met along the way. Returns TRUE if 'position->cur' holds the key.*/
+static int RICK45BLISTS_ConcurrentFind(concurrentList_t clist, struct hazardRecord *record, void *key, struct concurrentPosition *position)
+{
+    int found;
+    do
+        found = RICK45BLISTS_ConcurrentWalk(clist, record, key, position);
+    while (found == -1);
+    return found;
+}
+
+int RICK45BLISTS_ConcurrentListInsert(void *key, concurrentList_t clist)
+{
+    if (clist == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: concurrent list is NULL! Before using it, please consider using RICK45BLISTS_ConcurrentListCreate to initialize the concurrent list.");
+        return -1;
+    }
+    if (key == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: key cannot be NULL!");
+        return -1;
+    }
+    struct hazardRecord *record = RICK45BLISTS_HazardAcquire(clist);
+    if (record == NULL)
+        return -1;
+
+    struct concurrentPosition position;
+    concurrentListNode_t node = NULL;
+    int out;
+    for (;;)
+    {
+        if (RICK45BLISTS_ConcurrentFind(clist, record, key, &position))
+        {
+            out = 0;
+            break;
+        }
+        if (node == NULL)   /*allocated only once the key is known to be missing*/
+        {
+            node = RICK45B_Alloc(&clist->allocator, sizeof(struct concurrentListNode));
+            if (node == NULL)
+            {
+                RICK45B_SetError(RICK45B_ERR_NO_MEMORY, "Fatal Error: Cannot allocate memory for new node. Maybe the heap is full?");
+                out = -1;
+                break;
+            }
+            node->key = key;
+            node->retired = NULL;
+        }
+        node->next = position.cur;
+        concurrentListNode_t expected = position.cur;
+        if (__atomic_compare_exchange_n(position.prev, &expected, node, 0, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST))
+        {
+            __atomic_fetch_add(&clist->size, 1, __ATOMIC_RELAXED);
+            node = NULL;
+            out = 1;
+            break;
+        }
+    }
+    if (node != NULL)   /*never published*/
+        RICK45B_Free(&clist->allocator, node);
+    RICK45BLISTS_HazardRelease(record);
+    return out;
+}
+
+int RICK45BLISTS_ConcurrentListRemove(concurrentList_t clist, void *key, int delete_bool)
+{
+    if (clist == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: concurrent list is NULL! Before using it, please consider using RICK45BLISTS_ConcurrentListCreate to initialize the concurrent list.");
+        return -1;
+    }
+    if (key == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: key cannot be NULL!");
+        return -1;
+    }
+    struct hazardRecord *record = RICK45BLISTS_HazardAcquire(clist);
+    if (record == NULL)
+        return -1;
+
+    struct concurrentPosition position;
+    size_t marks = RICK45BLISTS_DELETED_BIT | (delete_bool ? RICK45BLISTS_FREE_KEY_BIT : 0);
+    int out = 0;
+    while (RICK45BLISTS_ConcurrentFind(clist, record, key, &position))
+    {
+        /*logical deletion first: from now on, nothing can be linked after the node*/
+        concurrentListNode_t expected = position.next;
+        if (!__atomic_compare_exchange_n(&position.cur->next, &expected, (concurrentListNode_t)((size_t)position.next | marks), 0, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST))
+            continue;
+        __atomic_fetch_sub(&clist->size, 1, __ATOMIC_RELAXED);
+        expected = position.cur;
+        if (__atomic_compare_exchange_n(position.prev, &expected, position.next, 0, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST))
+            RICK45BLISTS_Retire(clist, record, position.cur);
+        else    /*unlinked by the next lookup passing by*/
+            RICK45BLISTS_ConcurrentFind(clist, record, key, &position);
+        out = 1;
+        break;
+    }
+    RICK45BLISTS_HazardRelease(record);
+    return out;
+}
+
+int RICK45BLISTS_ConcurrentListContains(concurrentList_t clist, void *key)
+{
+    if (clist == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: concurrent list is NULL! Before using it, please consider using RICK45BLISTS_ConcurrentListCreate to initialize the concurrent list.");
+        return -1;
+    }
+    if (key == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: key cannot be NULL!");
+        return -1;
+    }
+    struct hazardRecord *record = RICK45BLISTS_HazardAcquire(clist);
+    if (record == NULL)
+        return -1;
+    struct concurrentPosition position;
+    int out = RICK45BLISTS_ConcurrentFind(clist, record, key, &position);
+    RICK45BLISTS_HazardRelease(record);
+    return out;
+}
+
+size_t RICK45BLISTS_GetConcurrentListSize(concurrentList_t clist)
+{
+    if (clist == NULL)
+        return 0;
+    return __atomic_load_n(&clist->size, __ATOMIC_RELAXED);
+}
+
+intrusiveList_t RICK45BLISTS_IntrusiveListCreate(RICK45B_comparator_t key_cmp, size_t offset)
+{
+    return RICK45BLISTS_IntrusiveListCreateWithAllocator(key_cmp, offset, NULL);
+}
+
+intrusiveList_t RICK45BLISTS_IntrusiveListCreateWithAllocator(RICK45B_comparator_t key_cmp, size_t offset, allocator_t allocator)
+{
+    if (key_cmp == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: key_cmp function cannot be NULL!");
+        return NULL;
+    }
+    if (allocator != NULL && (allocator->alloc_funct == NULL || allocator->free_funct == NULL))
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: the allocator's functions cannot be NULL!");
+        return NULL;
+    }
+
+    struct allocator alloc = RICK45B_PickAllocator(allocator);
+    intrusiveList_t out = RICK45B_Alloc(&alloc, sizeof(struct intrusiveList));
+    if (out == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NO_MEMORY, "Fatal Error: Cannot allocate memory for new intrusiveList_t type. Perhaps the heap is full?");
+        return NULL;
+    }
+    out->head = NULL;
+    out->tail = NULL;
+    out->offset = offset;
+    out->key_cmp = key_cmp;
+    out->size = 0;
+    out->allocator = alloc;
+    return out;
+}
+
+/*link of the given object used by the intrusive list.*/
+static intrusiveLink_t RICK45BLISTS_IntrusiveLinkOf(intrusiveList_t ilist, void *object)
+{
+    return (intrusiveLink_t)(void *)((char *)object+ilist->offset);
+}
+
+/*object embedding the given link, or NULL if the link is NULL.*/
+static void *RICK45BLISTS_IntrusiveObjectOf(intrusiveList_t ilist, intrusiveLink_t link)
+{
+    if (link == NULL)
+        return NULL;
+    return (char *)link-ilist->offset;
+}
+
+void RICK45BLISTS_IntrusiveListDestroy(intrusiveList_t *ilist, int delete_bool)
+{
+    if (ilist != NULL && *ilist != NULL)
+    {
+        intrusiveLink_t link = (*ilist)->head;
+        while (link != NULL)
+        {
+            intrusiveLink_t next = link->next;
+            link->next = NULL;
+            link->previous = NULL;
+            if (delete_bool)
+                freeFun(RICK45BLISTS_IntrusiveObjectOf(*ilist, link));
+            link = next;
+        }
+        RICK45B_Free(&(*ilist)->allocator, *ilist);
+        *ilist = NULL;
+    }
+}
+
+/*links the given link between 'previous' and 'next' (NULL for the ends of the list).*/
+static void RICK45BLISTS_IntrusiveLinkBetween(intrusiveList_t ilist, intrusiveLink_t previous, intrusiveLink_t link, intrusiveLink_t next)
+{
+    link->previous = previous;
+    link->next = next;
+    if (previous != NULL)   previous->next = link;
+    else    ilist->head = link;
+    if (next != NULL)   next->previous = link;
+    else    ilist->tail = link;
+    ilist->size++;
+}
+
+static void RICK45BLISTS_IntrusiveUnlink(intrusiveList_t ilist, intrusiveLink_t link)
+{
+    if (link->previous != NULL) link->previous->next = link->next;
+    else    ilist->head = link->next;
+    if (link->next != NULL) link->next->previous = link->previous;
+    else    ilist->tail = link->previous;
+    link->next = NULL;
+    link->previous = NULL;
+    ilist->size--;
+}
+
+int RICK45BLISTS_IntrusiveHeadAdd(void *object, intrusiveList_t ilist)
+{
+    return RICK45BLISTS_IntrusiveAddAfter(object, ilist, NULL);
+}
+
+int RICK45BLISTS_IntrusiveTailAdd(void *object, intrusiveList_t ilist)
+{
+    if (ilist == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: intrusive list is NULL! Before using it, please consider using RICK45BLISTS_IntrusiveListCreate to initialize the intrusive list.");
+        return -1;
+    }
+    if (object == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: object cannot be NULL!");
+        return -1;
+    }
+    RICK45BLISTS_IntrusiveLinkBetween(ilist, ilist->tail, RICK45BLISTS_IntrusiveLinkOf(ilist, object), NULL);
+    return 0;
+}
+
+int RICK45BLISTS_IntrusiveAddAfter(void *object, intrusiveList_t ilist, void *previous)
+{
+    if (ilist == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: intrusive list is NULL! Before using it, please consider using RICK45BLISTS_IntrusiveListCreate to initialize the intrusive list.");
+        return -1;
+    }
+    if (object == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: object cannot be NULL!");
+        return -1;
+    }
+    if (previous == NULL)
+        RICK45BLISTS_IntrusiveLinkBetween(ilist, NULL, RICK45BLISTS_IntrusiveLinkOf(ilist, object), ilist->head);
+    else
+    {
+        intrusiveLink_t link = RICK45BLISTS_IntrusiveLinkOf(ilist, previous);
+        RICK45BLISTS_IntrusiveLinkBetween(ilist, link, RICK45BLISTS_IntrusiveLinkOf(ilist, object), link->next);
+    }
+    return 0;
+}
+
+int RICK45BLISTS_IntrusiveRemove(intrusiveList_t ilist, void *object, int delete_bool)
+{
+    if (ilist == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: intrusive list is NULL! Before using it, please consider using RICK45BLISTS_IntrusiveListCreate to initialize the intrusive list.");
+        return -1;
+    }
+    if (object == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: object cannot be NULL!");
+        return -1;
+    }
+    if (ilist->size == 0)
+    {
+        RICK45B_SetError(RICK45B_ERR_EMPTY, "Head of the intrusive list is NULL! Please consider adding some objects first!");
+        return -1;
+    }
+    RICK45BLISTS_IntrusiveUnlink(ilist, RICK45BLISTS_IntrusiveLinkOf(ilist, object));
+    if (delete_bool)
+        freeFun(object);
+    return 0;
+}
+
+void *RICK45BLISTS_IntrusiveRemoveHead(intrusiveList_t ilist)
+{
+    if (ilist == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: intrusive list is NULL! Before using it, please consider using RICK45BLISTS_IntrusiveListCreate to initialize the intrusive list.");
+        return NULL;
+    }
+    intrusiveLink_t link = ilist->head;
+    if (link == NULL)
+        return NULL;
+    RICK45BLISTS_IntrusiveUnlink(ilist, link);
+    return RICK45BLISTS_IntrusiveObjectOf(ilist, link);
+}
+
+void *RICK45BLISTS_IntrusiveRemoveTail(intrusiveList_t ilist)
+{
+    if (ilist == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: intrusive list is NULL! Before using it, please consider using RICK45BLISTS_IntrusiveListCreate to initialize the intrusive list.");
+        return NULL;
+    }
+    intrusiveLink_t link = ilist->tail;
+    if (link == NULL)
+        return NULL;
+    RICK45BLISTS_IntrusiveUnlink(ilist, link);
+    return RICK45BLISTS_IntrusiveObjectOf(ilist, link);
+}
+
+void *RICK45BLISTS_IntrusiveGetHead(intrusiveList_t ilist)
+{
+    if (ilist == NULL)
+        return NULL;
+    return RICK45BLISTS_IntrusiveObjectOf(ilist, ilist->head);
+}
+
+void *RICK45BLISTS_IntrusiveGetTail(intrusiveList_t ilist)
+{
+    if (ilist == NULL)
+        return NULL;
+    return RICK45BLISTS_IntrusiveObjectOf(ilist, ilist->tail);
+}
+
+void *RICK45BLISTS_IntrusiveGetNext(intrusiveList_t ilist, void *object)
+{
+    if (ilist == NULL || object == NULL)
+        return NULL;
+    return RICK45BLISTS_IntrusiveObjectOf(ilist, RICK45BLISTS_IntrusiveLinkOf(ilist, object)->next);
+}
+
+void *RICK45BLISTS_IntrusiveGetPrevious(intrusiveList_t ilist, void *object)
+{
+    if (ilist == NULL || object == NULL)
+        return NULL;
+    return RICK45BLISTS_IntrusiveObjectOf(ilist, RICK45BLISTS_IntrusiveLinkOf(ilist, object)->previous);
+}
+
+void *RICK45BLISTS_IntrusiveGetObjectByKey(intrusiveList_t ilist, void *key)
+{
+    if (ilist == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: intrusive list is NULL! Before using it, please consider using RICK45BLISTS_IntrusiveListCreate to initialize the intrusive list.");
+        return NULL;
+    }
+    if (key == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: key cannot be NULL!");
+        return NULL;
+    }
+    intrusiveLink_t link;
+    for (link = ilist->head; link != NULL; link = link->next)
+    {
+        void *object = RICK45BLISTS_IntrusiveObjectOf(ilist, link);
+        if (ilist->key_cmp(object, key) == 0)
+            return object;
+    }
+    RICK45B_SetError(RICK45B_ERR_NOT_FOUND, "RICK45BLISTS_IntrusiveGetObjectByKey error: no key can be found!");
+    return NULL;
+}
+
+int RICK45BLISTS_IntrusiveListforEach(intrusiveList_t ilist, RICK45B_forEach_t funct, void *opt)
+{
+    if (ilist == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: intrusive list is NULL! Before using it, please consider using RICK45BLISTS_IntrusiveListCreate to initialize the intrusive list.");
+        return -1;
+    }
+    if (funct == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: funct cannot be NULL!");
+        return -1;
+    }
+    intrusiveLink_t link;
+    for (link = ilist->head; link != NULL; link = link->next)
+        if (funct(RICK45BLISTS_IntrusiveObjectOf(ilist, link), opt) == -1)
+        {
+            RICK45B_SetError(RICK45B_ERR_CALLBACK, "Provided function error!");
+            return -1;
+        }
+    return 0;
+}
+
+size_t RICK45BLISTS_GetIntrusiveListSize(intrusiveList_t ilist)
+{
+    if (ilist == NULL)
+        return 0;
+    return ilist->size;
+}
+
+xorList_t RICK45BLISTS_XorListCreate(RICK45B_comparator_t key_cmp)
+{
+    return RICK45BLISTS_XorListCreateWithAllocator(key_cmp, NULL);
+}
+
+xorList_t RICK45BLISTS_XorListCreateWithAllocator(RICK45B_comparator_t key_cmp, allocator_t allocator)
+{
+    if (key_cmp == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: key_cmp function cannot be NULL!");
+        return NULL;
+    }
+    if (allocator != NULL && (allocator->alloc_funct == NULL || allocator->free_funct == NULL))
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: the allocator's functions cannot be NULL!");
+        return NULL;
+    }
+
+    struct allocator alloc = RICK45B_PickAllocator(allocator);
+    xorList_t out = RICK45B_Alloc(&alloc, sizeof(struct xorList));
+    if (out == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NO_MEMORY, "Fatal Error: Cannot allocate memory for new xorList_t type. Perhaps the heap is full?");
+        return NULL;
+    }
+    out->head = NULL;
+    out->tail = NULL;
+    out->key_cmp = key_cmp;
+    out->size = 0;
+    out->allocator = alloc;
+    out->nodeAllocator = alloc;
+    out->pool = NULL;
+    return out;
+}
+
+/*neighbour of 'node' on the other side from 'from' (NULL for the end of the list).*/
+static xorListNode_t RICK45BLISTS_XorStep(xorListNode_t node, xorListNode_t from)
+{
+    return (xorListNode_t)(void *)(node->link ^ (size_t)from);
+}
+
+void RICK45BLISTS_XorListDestroy(xorList_t *xlist, int delete_bool)
+{
+    if (xlist != NULL && *xlist != NULL)
+    {
+        struct allocator alloc = (*xlist)->allocator;
+        xorListNode_t previous = NULL;
+        xorListNode_t node = (*xlist)->head;
+        while (node != NULL)
+        {
+            xorListNode_t next = RICK45BLISTS_XorStep(node, previous);
+            if (delete_bool)
+                freeFun(node->key);
+            if ((*xlist)->pool == NULL)
+                RICK45B_Free(&(*xlist)->nodeAllocator, node);
+            previous = node;
+            node = next;
+        }
+        if ((*xlist)->pool != NULL)  /*the nodes are released all at once, together with their pool*/
+            RICK45B_NodePoolDestroy((*xlist)->pool);
+        RICK45B_Free(&alloc, *xlist);
+        *xlist = NULL;
+    }
+}
+
+int RICK45BLISTS_XorListUseNodePool(xorList_t xlist, size_t nodesPerChunk)
+{
+    if (xlist == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: xor list is NULL! Before using it, please consider using RICK45BLISTS_XorListCreate to initialize the xor list.");
+        return -1;
+    }
+    if (xlist->size != 0)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: a node pool can only be attached to an empty xor list!");
+        return -1;
+    }
+    if (xlist->pool != NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: the xor list already uses a node pool!");
+        return -1;
+    }
+    nodePool_t pool = RICK45B_NodePoolCreate(sizeof(struct xorListNode), nodesPerChunk, &xlist->allocator);
+    if (pool == NULL)   return -1;
+    xlist->pool = pool;
+    xlist->nodeAllocator = RICK45B_NodePoolAllocator(pool);
+    return 0;
+}
+
+/*adds a node at the end 'end' of the list, 'otherEnd' being the opposite one: head and tail are symmetric.*/
+static int RICK45BLISTS_XorAdd(void *key, xorList_t xlist, xorListNode_t *end, xorListNode_t *otherEnd)
+{
+    if (key == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: key cannot be NULL!");
+        return -1;
+    }
+    xorListNode_t node = RICK45B_Alloc(&xlist->nodeAllocator, sizeof(struct xorListNode));
+    if (node == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NO_MEMORY, "Fatal Error: Cannot allocate memory for new xorListNode_t type. Perhaps the heap is full?");
+        return -1;
+    }
+    node->key = key;
+    node->link = (size_t)*end;
+    if (*end != NULL)
+        (*end)->link ^= (size_t)node;
+    else
+        *otherEnd = node;
+    *end = node;
+    xlist->size++;
+    return 0;
+}
+
+/*removes the node at the end 'end' of the list, 'otherEnd' being the opposite one.*/
+static int RICK45BLISTS_XorRemoveEnd(xorList_t xlist, int delete_bool, xorListNode_t *end, xorListNode_t *otherEnd)
+{
+    xorListNode_t node = *end;
+    if (node == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_EMPTY, "The xor list is empty! Please consider adding some nodes first!");
+        return -1;
+    }
+    xorListNode_t neighbour = RICK45BLISTS_XorStep(node, NULL);
+    if (neighbour != NULL)
+        neighbour->link ^= (size_t)node;
+    else
+        *otherEnd = NULL;
+    *end = neighbour;
+    if (delete_bool)
+        freeFun(node->key);
+    RICK45B_Free(&xlist->nodeAllocator, node);
+    xlist->size--;
+    return 0;
+}
+
+int RICK45BLISTS_XorHeadAdd(void *key, xorList_t xlist)
+{
+    if (xlist == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: xor list is NULL! Before using it, please consider using RICK45BLISTS_XorListCreate to initialize the xor list.");
+        return -1;
+    }
+    return RICK45BLISTS_XorAdd(key, xlist, &xlist->head, &xlist->tail);
+}
+
+int RICK45BLISTS_XorTailAdd(void *key, xorList_t xlist)
+{
+    if (xlist == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: xor list is NULL! Before using it, please consider using RICK45BLISTS_XorListCreate to initialize the xor list.");
+        return -1;
+    }
+    return RICK45BLISTS_XorAdd(key, xlist, &xlist->tail, &xlist->head);
+}
+
+int RICK45BLISTS_XorRemoveHead(xorList_t xlist, int delete_bool)
+{
+    if (xlist == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: xor list is NULL! Before using it, please consider using RICK45BLISTS_XorListCreate to initialize the xor list.");
+        return -1;
+    }
+    return RICK45BLISTS_XorRemoveEnd(xlist, delete_bool, &xlist->head, &xlist->tail);
+}
+
+int RICK45BLISTS_XorRemoveTail(xorList_t xlist, int delete_bool)
+{
+    if (xlist == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: xor list is NULL! Before using it, please consider using RICK45BLISTS_XorListCreate to initialize the xor list.");
+        return -1;
+    }
+    return RICK45BLISTS_XorRemoveEnd(xlist, delete_bool, &xlist->tail, &xlist->head);
+}
+
+int RICK45BLISTS_XorRemoveByKey(xorList_t xlist, void *key, int delete_bool)
+{
+    if (xlist == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: xor list is NULL! Before using it, please consider using RICK45BLISTS_XorListCreate to initialize the xor list.");
+        return -1;
+    }
+    if (key == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: key cannot be NULL!");
+        return -1;
+    }
+    xorListNode_t previous = NULL;
+    xorListNode_t node = xlist->head;
+    while (node != NULL)
+    {
+        xorListNode_t next = RICK45BLISTS_XorStep(node, previous);
+        if (xlist->key_cmp(node->key, key) == 0)
+        {
+            if (previous != NULL)   previous->link ^= (size_t)node ^ (size_t)next;
+            else    xlist->head = next;
+            if (next != NULL)   next->link ^= (size_t)node ^ (size_t)previous;
+            else    xlist->tail = previous;
+            if (delete_bool)
+                freeFun(node->key);
+            RICK45B_Free(&xlist->nodeAllocator, node);
+            xlist->size--;
+            return 1;
+        }
+        previous = node;
+        node = next;
+    }
+    return 0;
+}
+
+void *RICK45BLISTS_XorGetHeadKey(xorList_t xlist)
+{
+    if (xlist == NULL || xlist->head == NULL)
+        return NULL;
+    return xlist->head->key;
+}
+
+void *RICK45BLISTS_XorGetTailKey(xorList_t xlist)
+{
+    if (xlist == NULL || xlist->tail == NULL)
+        return NULL;
+    return xlist->tail->key;
+}
+
+void *RICK45BLISTS_XorGetKeyByKey(xorList_t xlist, void *key)
+{
+    if (xlist == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: xor list is NULL! Before using it, please consider using RICK45BLISTS_XorListCreate to initialize the xor list.");
+        return NULL;
+    }
+    if (key == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: key cannot be NULL!");
+        return NULL;
+    }
+    xorListNode_t previous = NULL;
+    xorListNode_t node = xlist->head;
+    while (node != NULL)
+    {
+        if (xlist->key_cmp(node->key, key) == 0)
+            return node->key;
+        xorListNode_t next = RICK45BLISTS_XorStep(node, previous);
+        previous = node;
+        node = next;
+    }
+    RICK45B_SetError(RICK45B_ERR_NOT_FOUND, "RICK45BLISTS_XorGetKeyByKey error: no key can be found!");
+    return NULL;
+}
+
+int RICK45BLISTS_XorListReverse(xorList_t xlist)
+{
+    if (xlist == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: xor list is NULL! Before using it, please consider using RICK45BLISTS_XorListCreate to initialize the xor list.");
+        return -1;
+    }
+    xorListNode_t head = xlist->head;
+    xlist->head = xlist->tail;
+    xlist->tail = head;
+    return 0;
+}
+
+int RICK45BLISTS_XorListforEach(xorList_t xlist, RICK45B_forEach_t funct, void *opt)
+{
+    if (xlist == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: xor list is NULL! Before using it, please consider using RICK45BLISTS_XorListCreate to initialize the xor list.");
+        return -1;
+    }
+    if (funct == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: funct cannot be NULL!");
+        return -1;
+    }
+    xorListNode_t previous = NULL;
+    xorListNode_t node = xlist->head;
+    while (node != NULL)
+    {
+        if (funct(node->key, opt) == -1)
+        {
+            RICK45B_SetError(RICK45B_ERR_CALLBACK, "Provided function error!");
+            return -1;
+        }
+        xorListNode_t next = RICK45BLISTS_XorStep(node, previous);
+        previous = node;
+        node = next;
+    }
+    return 0;
+}
+
+int RICK45BLISTS_XorIteratorInit(xorListIterator_t iterator, xorList_t xlist)
+{
+    if (iterator == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: iterator cannot be NULL!");
+        return -1;
+    }
+    if (xlist == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: xor list is NULL! Before using it, please consider using RICK45BLISTS_XorListCreate to initialize the xor list.");
+        return -1;
+    }
+    iterator->xlist = xlist;
+    iterator->next = xlist->head;
+    iterator->previous = NULL;
+    return 0;
+}
+
+int RICK45BLISTS_XorIteratorInitTail(xorListIterator_t iterator, xorList_t xlist)
+{
+    if (RICK45BLISTS_XorIteratorInit(iterator, xlist) == -1)
+        return -1;
+    iterator->next = xlist->tail;
+    return 0;
+}
+
+void *RICK45BLISTS_XorIteratorNext(xorListIterator_t iterator)
+{
+    if (iterator == NULL || iterator->next == NULL)
+        return NULL;
+    xorListNode_t node = iterator->next;
+    iterator->next = RICK45BLISTS_XorStep(node, iterator->previous);
+    iterator->previous = node;
+    return node->key;
+}
+
+int RICK45BLISTS_XorIteratorReverse(xorListIterator_t iterator)
+{
+    if (iterator == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: iterator cannot be NULL!");
+        return -1;
+    }
+    xorListNode_t next = iterator->next;
+    iterator->next = iterator->previous;
+    iterator->previous = next;
+    return 0;
+}
+
+size_t RICK45BLISTS_GetXorListSize(xorList_t xlist)
+{
+    if (xlist == NULL)
+        return 0;
+    return xlist->size;
+}
@@ -26,30 +26,46 @@
 
 /*stack functions*/
 stack_t RICK45BSTACK_StackCreate(RICK45B_comparator_t key_cmp, unsigned long int dim)
+{
+    return RICK45BSTACK_StackCreateWithAllocator(key_cmp, dim, NULL);
+}
+
+stack_t RICK45BSTACK_StackCreateWithAllocator(RICK45B_comparator_t key_cmp, unsigned long int dim, allocator_t allocator)
 {
     if (key_cmp == NULL)
     {
-        RICK45B_CopyString("Invalid Argument: key_cmp function cannot be NULL!", RICK45B.GetError, sizeof("Invalid Argument: key_cmp function cannot be NULL!"));
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: key_cmp function cannot be NULL!");
         return NULL;
     }
+    if (allocator != NULL && (allocator->alloc_funct == NULL || allocator->free_funct == NULL))
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: the allocator's functions cannot be NULL!");
+        return NULL;
+    }
+    struct allocator alloc = RICK45B_PickAllocator(allocator);
     list_t list = NULL;
-    list = RICK45BLISTS_ListCreate(key_cmp);
+    list = RICK45BLISTS_ListCreateWithAllocator(key_cmp, &alloc);
 
     if (list == NULL)
     {
-        RICK45B_CopyString("Couldn't create stack: internal list creation failed!", RICK45B.GetError, sizeof("Couldn't create stack: internal list creation failed!"));
+        RICK45B_SetError(RICK45B_ERR_INTERNAL, "Couldn't create stack: internal list creation failed!");
         return NULL;
     }
 
     stack_t out = NULL;
-    out = mallocFun(sizeof(struct stack));
+    out = RICK45B_Alloc(&alloc, sizeof(struct stack));
     if (out == NULL)
     {
-        RICK45B_CopyString("Fatal Error: Cannot allocate memory for new stack_t type. Perhaps the heap is full?", RICK45B.GetError, sizeof("Fatal Error: Cannot allocate memory for new stack_t type. Perhaps the heap is full?"));
+        RICK45BLISTS_ListDestroy(&list, 0);
+        RICK45B_SetError(RICK45B_ERR_NO_MEMORY, "Fatal Error: Cannot allocate memory for new stack_t type. Perhaps the heap is full?");
         return NULL;
     }
     out->head = list;
     out->dim = dim;
+    out->allocator = alloc;
+    out->keys = NULL;
+    out->size = 0;
+    out->capacity = 0;
     return out;
 }
 
@@ -59,18 +75,113 @@ void RICK45BSTACK_StackDestroy(stack_t stack, int delete_bool)
     {
         RICK45BLISTS_ListDestroy(&(stack->head), delete_bool);
         stack->head = NULL;
-        freeFun(stack);
+        if (stack->keys != NULL)
+        {
+            size_t i;
+            if (delete_bool)
+                for (i = 0; i<stack->size; i++)
+                    freeFun(stack->keys[i]);
+            RICK45B_Free(&stack->allocator, stack->keys);
+        }
+        RICK45B_Free(&stack->allocator, stack);
+    }
+}
+
+int RICK45BSTACK_StackUseNodePool(stack_t stack, size_t nodesPerChunk)
+{
+    if (stack == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Invalid argument: stack cannot be NULL!");
+        return -1;
+    }
+    if (stack->keys != NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid argument: an array-backed stack has no nodes to pool!");
+        return -1;
+    }
+    return RICK45BLISTS_ListUseNodePool(stack->head, nodesPerChunk);
+}
+
+int RICK45BSTACK_StackUseHashIndex(stack_t stack, RICK45B_hash_t hash)
+{
+    if (stack == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Invalid argument: stack cannot be NULL!");
+        return -1;
+    }
+    if (stack->keys != NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid argument: an array-backed stack can't use a hash index!");
+        return -1;
     }
+    return RICK45BLISTS_ListUseHashIndex(stack->head, hash);
+}
+
+int RICK45BSTACK_StackUseArray(stack_t stack, size_t capacity)
+{
+    if (stack == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Invalid argument: stack cannot be NULL!");
+        return -1;
+    }
+    if (RICK45BSTACK_GetStackSize(stack) != 0)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid argument: only an empty stack can switch to an array!");
+        return -1;
+    }
+    if (stack->keys != NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid argument: the stack already uses an array!");
+        return -1;
+    }
+    if (stack->head->hashIndex != NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid argument: a stack with a hash index can't use an array!");
+        return -1;
+    }
+    if (capacity == 0)  capacity = RICK45BSTACK_ARRAY_DEFAULT_CAPACITY;
+    if (stack->dim && capacity>stack->dim)  capacity = stack->dim;
+    stack->keys = RICK45B_Alloc(&stack->allocator, sizeof(void *)*capacity);
+    if (stack->keys == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NO_MEMORY, "Fatal Error: Cannot allocate memory for the stack's array. Perhaps the heap is full?");
+        return -1;
+    }
+    stack->size = 0;
+    stack->capacity = capacity;
+    return 0;
+}
+
+/*moves the keys of a full array-backed stack to an array twice as big (capped to the max dimension).*/
+static int RICK45BSTACK_StackGrow(stack_t stack)
+{
+    size_t capacity = stack->capacity*2;
+    if (stack->dim && capacity>stack->dim)  capacity = stack->dim;
+    void **keys = RICK45B_Alloc(&stack->allocator, sizeof(void *)*capacity);
+    if (keys == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NO_MEMORY, "Fatal Error: Cannot allocate memory for the stack's array. Perhaps the heap is full?");
+        return -1;
+    }
+    size_t i;
+    for (i = 0; i<stack->size; i++)
+        keys[i] = stack->keys[i];
+    RICK45B_Free(&stack->allocator, stack->keys);
+    stack->keys = keys;
+    stack->capacity = capacity;
+    return 0;
 }
 
 void *RICK45BSTACK_StackTop(stack_t stack)
 {
     if (stack == NULL)
     {
-        RICK45B_CopyString("Invalid argument: stack cannot be NULL!", RICK45B.GetError, sizeof("Invalid argument: stack cannot be NULL!"));
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Invalid argument: stack cannot be NULL!");
         return NULL;
     }
 
+    if (stack->keys != NULL)
+        return stack->size != 0 ? stack->keys[stack->size-1] : NULL;
     if (stack->head!=NULL)
     {
         if (stack->head->head!=NULL) return stack->head->head->key;
@@ -78,7 +189,7 @@ void *RICK45BSTACK_StackTop(stack_t stack)
     }
     else
     {
-        RICK45B_CopyString("Stack is corrupted!", RICK45B.GetError, sizeof("Stack is corrupted!"));
+        RICK45B_SetError(RICK45B_ERR_CORRUPTED, "Stack is corrupted!");
         return NULL;
     }
 }
@@ -87,10 +198,13 @@ void *RICK45BSTACK_StackPop(stack_t stack)
 {
     if (stack == NULL)
     {
-        RICK45B_CopyString("Invalid argument: stack cannot be NULL!", RICK45B.GetError, sizeof("Invalid argument: stack cannot be NULL!"));
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Invalid argument: stack cannot be NULL!");
         return NULL;
     }
 
+    if (stack->keys != NULL)
+        return stack->size != 0 ? stack->keys[--stack->size] : NULL;
+
     void* out = NULL;
     if (stack->head!=NULL)
     {
@@ -99,13 +213,13 @@ void *RICK45BSTACK_StackPop(stack_t stack)
     }
     else
     {
-        RICK45B_CopyString("Stack is corrupted!", RICK45B.GetError, sizeof("Stack is corrupted!"));
+        RICK45B_SetError(RICK45B_ERR_CORRUPTED, "Stack is corrupted!");
         return NULL;
     }
 
     if (RICK45BLISTS_RemoveHead(stack->head, 0)==-1)
     {
-        RICK45B_CopyString("An error has occurred while popping the node from the stack!", RICK45B.GetError, sizeof("An error has occurred while popping the node from the stack!"));
+        RICK45B_SetError(RICK45B_ERR_INTERNAL, "An error has occurred while popping the node from the stack!");
         return NULL;
     }
     return out;
@@ -115,21 +229,35 @@ int RICK45BSTACK_StackPush(stack_t stack, void *key)
 {
     if (stack == NULL)
     {
-        RICK45B_CopyString("Invalid argument: stack cannot be NULL!", RICK45B.GetError, sizeof("Invalid argument: stack cannot be NULL!"));
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Invalid argument: stack cannot be NULL!");
         return -1;
     }
     if (key == NULL)
     {
-        RICK45B_CopyString("Invalid argument: key cannot be NULL!", RICK45B.GetError, sizeof("Invalid argument: key cannot be NULL!"));
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid argument: key cannot be NULL!");
         return -1;
     }
 
+    if (stack->keys != NULL)
+    {
+        if (stack->size == stack->capacity)
+        {
+            if (stack->dim && stack->size >= stack->dim)
+            {
+                RICK45B_SetError(RICK45B_ERR_FULL, "Cannot push element into stack: stack is full!");
+                return -1;
+            }
+            if (RICK45BSTACK_StackGrow(stack) == -1)    return -1;
+        }
+        stack->keys[stack->size++] = key;
+        return 0;
+    }
     if (!stack->dim)    return RICK45BLISTS_HeadAddListNode(key, stack->head);  /*no max dimension set. No need to check.*/
-    if (RICK45BSTACK_GetStackSize(stack)+1<=stack->dim)
+    if (stack->head->size<stack->dim)
         return RICK45BLISTS_HeadAddListNode(key, stack->head);
     else
     {
-        RICK45B_CopyString("Cannot push element into stack: stack is full!", RICK45B.GetError, sizeof("Cannot push element into stack: stack is full!"));
+        RICK45B_SetError(RICK45B_ERR_FULL, "Cannot push element into stack: stack is full!");
         return -1;
     }
 
@@ -139,7 +267,7 @@ int RICK45BSTACK_IsEmpty(stack_t stack)
 {
     if (stack == NULL)
     {
-        RICK45B_CopyString("Invalid argument: stack cannot be NULL!", RICK45B.GetError, sizeof("Invalid argument: stack cannot be NULL!"));
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Invalid argument: stack cannot be NULL!");
         return -1;
     }
     return RICK45BSTACK_GetStackSize(stack)==0;
@@ -149,7 +277,7 @@ int RICK45BSTACK_IsFull(stack_t stack)
 {
     if (stack == NULL)
     {
-        RICK45B_CopyString("Invalid argument: stack cannot be NULL!", RICK45B.GetError, sizeof("Invalid argument: stack cannot be NULL!"));
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Invalid argument: stack cannot be NULL!");
         return -1;
     }
     if (!stack->dim)    return 0;
@@ -159,27 +287,54 @@ int RICK45BSTACK_IsFull(stack_t stack)
 size_t RICK45BSTACK_GetStackSize(stack_t stack)
 {
     if (stack == NULL)  return 0;
+    if (stack->keys != NULL)    return stack->size;
     if (stack->head == NULL) return 0;
     return RICK45BLISTS_GetListSize(stack->head);
 }
 
+void **RICK45BSTACK_StackToArray(stack_t stack, void **array, int reverse)
+{
+    if (stack == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Invalid argument: stack cannot be NULL!");
+        return NULL;
+    }
+    if (stack->keys != NULL)
+    {
+        if (array == NULL)
+        {
+            array = RICK45B_Alloc(&RICK45B_DefaultAllocator, sizeof(void *)*(stack->size!=0 ? stack->size : 1));
+            if (array == NULL)
+            {
+                RICK45B_SetError(RICK45B_ERR_NO_MEMORY, "Fatal Error: Cannot allocate memory for the array of keys. Maybe the heap is full?");
+                return NULL;
+            }
+        }
+        size_t i;
+        for (i = 0; i<stack->size; i++)     /*the top of the stack is the end of its array*/
+            array[i] = reverse ? stack->keys[i] : stack->keys[stack->size-1-i];
+        return array;
+    }
+    return RICK45BLISTS_ListToArray(stack->head, array, reverse);    /*the top of the stack is the head of its list*/
+}
+
 int RICK45BSTACK_IsTop(stack_t stack, void *key)
 {
     if (stack == NULL)
     {
-        RICK45B_CopyString("Invalid argument: stack cannot be NULL!", RICK45B.GetError, sizeof("Invalid argument: stack cannot be NULL!"));
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Invalid argument: stack cannot be NULL!");
         return -1;
     }
     if (key == NULL)
     {
-        RICK45B_CopyString("Invalid argument: key cannot be NULL!", RICK45B.GetError, sizeof("Invalid argument: key cannot be NULL!"));
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid argument: key cannot be NULL!");
         return -1;
     }
-    listNode_t node = RICK45BLISTS_GetNodeByPosition(stack->head, 0);   /*retrieving the node at the head of the list*/
-    if (node == NULL && (RICK45B_Stringcmp("Fatal Error: List is NULL! Before using it, please consider using RICK45BLISTS_ListCreate to initialize the list.", RICK45B_GetError())==0 || RICK45B_Stringcmp("Invalid Argument: Position value out of range for the given linkedList!", RICK45B_GetError())==0)) return -1;
-    if (node == NULL)
+    if (stack->keys != NULL)
+        return stack->size != 0 && stack->head->key_cmp(key, stack->keys[stack->size-1])==0;
+    if (RICK45BLISTS_GetListSize(stack->head)==0)
         return 0;
-    if (stack->head->key_cmp(key, node->key)==0)    return 1;
+    if (stack->head->key_cmp(key, stack->head->head->key)==0)    return 1;   /*the top is the head of the list*/
     return 0;
 }
 
@@ -187,14 +342,22 @@ int RICK45BSTACK_ContainedInStack(stack_t stack, void *key)
 {
     if (stack == NULL)
     {
-        RICK45B_CopyString("Invalid argument: stack cannot be NULL!", RICK45B.GetError, sizeof("Invalid argument: stack cannot be NULL!"));
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Invalid argument: stack cannot be NULL!");
         return -1;
     }
     if (key == NULL)
     {
-        RICK45B_CopyString("Invalid argument: key cannot be NULL!", RICK45B.GetError, sizeof("Invalid argument: key cannot be NULL!"));
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid argument: key cannot be NULL!");
         return -1;
     }
+    if (stack->keys != NULL)
+    {
+        size_t i;
+        for (i = stack->size; i>0; i--)     /*from the top, like the list-backed stack*/
+            if (stack->head->key_cmp(stack->keys[i-1], key)==0)
+                return 1;
+        return 0;
+    }
     if (RICK45BLISTS_GetNodeByKey(stack->head, key)==NULL)
         return 0;
     return 1;
@@ -202,30 +365,43 @@ int RICK45BSTACK_ContainedInStack(stack_t stack, void *key)
 
 /*queue functions*/
 queue_t RICK45BQUEUE_QueueCreate(RICK45B_comparator_t key_cmp, unsigned long int dim)
+{
+    return RICK45BQUEUE_QueueCreateWithAllocator(key_cmp, dim, NULL);
+}
+
+queue_t RICK45BQUEUE_QueueCreateWithAllocator(RICK45B_comparator_t key_cmp, unsigned long int dim, allocator_t allocator)
 {
     if (key_cmp == NULL)
     {
-        RICK45B_CopyString("Invalid Argument: key_cmp function cannot be NULL!", RICK45B.GetError, sizeof("Invalid Argument: key_cmp function cannot be NULL!"));
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: key_cmp function cannot be NULL!");
         return NULL;
     }
+    if (allocator != NULL && (allocator->alloc_funct == NULL || allocator->free_funct == NULL))
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: the allocator's functions cannot be NULL!");
+        return NULL;
+    }
+    struct allocator alloc = RICK45B_PickAllocator(allocator);
     list_t list = NULL;
-    list = RICK45BLISTS_ListCreate(key_cmp);
+    list = RICK45BLISTS_ListCreateWithAllocator(key_cmp, &alloc);
 
     if (list == NULL)
     {
-        RICK45B_CopyString("Couldn't create queue: internal list creation failed!", RICK45B.GetError, sizeof("Couldn't create queue: internal list creation failed!"));
+        RICK45B_SetError(RICK45B_ERR_INTERNAL, "Couldn't create queue: internal list creation failed!");
         return NULL;
     }
 
     queue_t out = NULL;
-    out = mallocFun(sizeof(struct queue));
+    out = RICK45B_Alloc(&alloc, sizeof(struct queue));
     if (out == NULL)
     {
-        RICK45B_CopyString("Fatal Error: Cannot allocate memory for new queue_t type. Perhaps the heap is full?", RICK45B.GetError, sizeof("Fatal Error: Cannot allocate memory for new queue_t type. Perhaps the heap is full?"));
+        RICK45BLISTS_ListDestroy(&list, 0);
+        RICK45B_SetError(RICK45B_ERR_NO_MEMORY, "Fatal Error: Cannot allocate memory for new queue_t type. Perhaps the heap is full?");
         return NULL;
     }
     out->list = list;
     out->dim = dim;
+    out->allocator = alloc;
     return out;
 }
 
@@ -235,20 +411,40 @@ void RICK45BQUEUE_QueueDestroy(queue_t queue, int delete_bool)
     {
         RICK45BLISTS_ListDestroy(&(queue->list), delete_bool);
         queue->list = NULL;
-        freeFun(queue);
+        RICK45B_Free(&queue->allocator, queue);
+    }
+}
+
+int RICK45BQUEUE_QueueUseNodePool(queue_t queue, size_t nodesPerChunk)
+{
+    if (queue == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Invalid argument: queue cannot be NULL!");
+        return -1;
+    }
+    return RICK45BLISTS_ListUseNodePool(queue->list, nodesPerChunk);
+}
+
+int RICK45BQUEUE_QueueUseHashIndex(queue_t queue, RICK45B_hash_t hash)
+{
+    if (queue == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Invalid argument: queue cannot be NULL!");
+        return -1;
     }
+    return RICK45BLISTS_ListUseHashIndex(queue->list, hash);
 }
 
 int RICK45BQUEUE_Enqueue(queue_t queue, void *key)
 {
     if (queue == NULL)
     {
-        RICK45B_CopyString("Invalid argument: queue cannot be NULL!", RICK45B.GetError, sizeof("Invalid argument: queue cannot be NULL!"));
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Invalid argument: queue cannot be NULL!");
         return -1;
     }
     if (key == NULL)
     {
-        RICK45B_CopyString("Invalid argument: key cannot be NULL!", RICK45B.GetError, sizeof("Invalid argument: key cannot be NULL!"));
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid argument: key cannot be NULL!");
         return -1;
     }
     if (!queue->dim)    return RICK45BLISTS_HeadAddListNode(key, queue->list);  /*no max dimension set. No need to check.*/
@@ -256,7 +452,7 @@ int RICK45BQUEUE_Enqueue(queue_t queue, void *key)
         return RICK45BLISTS_HeadAddListNode(key, queue->list);
     else
     {
-        RICK45B_CopyString("Cannot enqueue element into queue: queue is full!", RICK45B.GetError, sizeof("Cannot enqueue element into queue: queue is full!"));
+        RICK45B_SetError(RICK45B_ERR_FULL, "Cannot enqueue element into queue: queue is full!");
         return -1;
     }
 }
@@ -265,7 +461,7 @@ int RICK45BQUEUE_IsEmpty(queue_t queue)
 {
     if (queue == NULL)
     {
-        RICK45B_CopyString("Invalid argument: queue cannot be NULL!", RICK45B.GetError, sizeof("Invalid argument: queue cannot be NULL!"));
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Invalid argument: queue cannot be NULL!");
         return -1;
     }
     return RICK45BQUEUE_GetQueueSize(queue)==0;
@@ -275,7 +471,7 @@ int RICK45BQUEUE_IsFull(queue_t queue)
 {
     if (queue == NULL)
     {
-        RICK45B_CopyString("Invalid argument: queue cannot be NULL!", RICK45B.GetError, sizeof("Invalid argument: queue cannot be NULL!"));
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Invalid argument: queue cannot be NULL!");
         return -1;
     }
     if (!queue->dim)    return 0;
@@ -286,7 +482,7 @@ void *RICK45BQUEUE_Dequeue(queue_t queue)
 {
     if (queue == NULL)
     {
-        RICK45B_CopyString("Invalid argument: queue cannot be NULL!", RICK45B.GetError, sizeof("Invalid argument: queue cannot be NULL!"));
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Invalid argument: queue cannot be NULL!");
         return NULL;
     }
 
@@ -298,7 +494,7 @@ void *RICK45BQUEUE_Dequeue(queue_t queue)
             if (queue->list->tail->key != NULL) out = queue->list->tail->key;
             else
             {
-                RICK45B_CopyString("Queue is corrupted!", RICK45B.GetError, sizeof("Queue is corrupted!"));
+                RICK45B_SetError(RICK45B_ERR_CORRUPTED, "Queue is corrupted!");
                 return NULL;
             }
         }
@@ -306,12 +502,12 @@ void *RICK45BQUEUE_Dequeue(queue_t queue)
     }
     else
     {
-        RICK45B_CopyString("Queue is corrupted!", RICK45B.GetError, sizeof("Queue is corrupted!"));
+        RICK45B_SetError(RICK45B_ERR_CORRUPTED, "Queue is corrupted!");
         return NULL;
     }
     if (RICK45BLISTS_RemoveTail(queue->list, 0)==-1)
     {
-        RICK45B_CopyString("An error has occurred while dequeing the node!", RICK45B.GetError, sizeof("An error has occurred while dequeing the node!"));
+        RICK45B_SetError(RICK45B_ERR_INTERNAL, "An error has occurred while dequeing the node!");
         return NULL;
     }
     return out;
@@ -324,16 +520,26 @@ size_t RICK45BQUEUE_GetQueueSize(queue_t queue)
     return RICK45BLISTS_GetListSize(queue->list);
 }
 
+void **RICK45BQUEUE_QueueToArray(queue_t queue, void **array, int reverse)
+{
+    if (queue == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Invalid argument: queue cannot be NULL!");
+        return NULL;
+    }
+    return RICK45BLISTS_ListToArray(queue->list, array, !reverse);   /*keys are enqueued at the head and dequeued from the tail*/
+}
+
 int RICK45BQUEUE_ContainedInQueue(queue_t queue, void *key)
 {
     if (queue == NULL)
     {
-        RICK45B_CopyString("Invalid argument: queue cannot be NULL!", RICK45B.GetError, sizeof("Invalid argument: queue cannot be NULL!"));
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Invalid argument: queue cannot be NULL!");
         return -1;
     }
     if (key == NULL)
     {
-        RICK45B_CopyString("Invalid argument: key cannot be NULL!", RICK45B.GetError, sizeof("Invalid argument: key cannot be NULL!"));
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid argument: key cannot be NULL!");
         return -1;
     }
     if (RICK45BLISTS_GetNodeByKey(queue->list, key)==NULL)
@@ -345,7 +551,7 @@ void *RICK45BQUEUE_Peek(queue_t queue)
 {
     if (queue == NULL)
     {
-        RICK45B_CopyString("Invalid argument: queue cannot be NULL!", RICK45B.GetError, sizeof("Invalid argument: queue cannot be NULL!"));
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Invalid argument: queue cannot be NULL!");
         return NULL;
     }
     if (queue->list!=NULL)
@@ -355,7 +561,7 @@ void *RICK45BQUEUE_Peek(queue_t queue)
     }
     else
     {
-        RICK45B_CopyString("Queue is corrupted!", RICK45B.GetError, sizeof("Queue is corrupted!"));
+        RICK45B_SetError(RICK45B_ERR_CORRUPTED, "Queue is corrupted!");
         return NULL;
     }
 }
@@ -364,7 +570,7 @@ void *RICK45BQUEUE_Rear(queue_t queue)
 {
     if (queue == NULL)
     {
-        RICK45B_CopyString("Invalid argument: queue cannot be NULL!", RICK45B.GetError, sizeof("Invalid argument: queue cannot be NULL!"));
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Invalid argument: queue cannot be NULL!");
         return NULL;
     }
     if (queue->list!=NULL)
@@ -374,7 +580,7 @@ void *RICK45BQUEUE_Rear(queue_t queue)
     }
     else
     {
-        RICK45B_CopyString("Queue is corrupted!", RICK45B.GetError, sizeof("Queue is corrupted!"));
+        RICK45B_SetError(RICK45B_ERR_CORRUPTED, "Queue is corrupted!");
         return NULL;
     }
 }
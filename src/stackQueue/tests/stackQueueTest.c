@@ -15,6 +15,10 @@
 void destroy_createStackTEST();
 void misc_StackTEST();
 void error_StackQueueTEST();
+void allocator_StackQueueTEST();
+void toArray_StackQueueTEST();
+void hashIndex_StackQueueTEST();
+void array_StackTEST();
 
 int main()
 {
@@ -28,6 +32,14 @@ int main()
     printf("\n***misc_StackTEST successful***\n\n");
     error_StackQueueTEST();
     printf("\n***error_StackQueueTEST successful***\n\n");
+    allocator_StackQueueTEST();
+    printf("\n***allocator_StackQueueTEST successful***\n\n");
+    toArray_StackQueueTEST();
+    printf("\n***toArray_StackQueueTEST successful***\n\n");
+    hashIndex_StackQueueTEST();
+    printf("\n***hashIndex_StackQueueTEST successful***\n\n");
+    array_StackTEST();
+    printf("\n***array_StackTEST successful***\n\n");
     printf("\n***All test were successful***\n\n");
     return 0;
 }
@@ -111,6 +123,7 @@ void misc_StackTEST()
     RICK45BSTACK_StackPush(stack, mallocData3);
     assert(RICK45BSTACK_GetStackSize(stack)==3);
     assert(RICK45BSTACK_StackPush(stack, mallocData4)==-1 && strcmp("Cannot push element into stack: stack is full!", RICK45B_GetError())==0);
+    assert(RICK45B_LastErrorCode()==RICK45B_ERR_FULL);
     assert(RICK45BSTACK_GetStackSize(stack)==3);  /*No data has been added!*/
     assert(RICK45BSTACK_IsEmpty(stack)==0 && RICK45BSTACK_IsFull(stack)==1);
     assert(strcmp(RICK45BSTACK_StackTop(stack), mallocData3)==0);
@@ -154,6 +167,8 @@ void error_StackQueueTEST()
     assert(RICK45BSTACK_IsTop(NULL, strings[1])==-1 && strcmp("Invalid argument: stack cannot be NULL!", RICK45B_GetError())==0);
     assert(RICK45BSTACK_IsTop(stack, NULL)==-1 && strcmp("Invalid argument: key cannot be NULL!", RICK45B_GetError())==0);
     assert(RICK45BSTACK_IsTop(NULL, NULL)==-1 && strcmp("Invalid argument: stack cannot be NULL!", RICK45B_GetError())==0);
+    assert(RICK45B_LastErrorCode()==RICK45B_ERR_NULL_ADT);
+    assert(RICK45BSTACK_IsTop(stack, strings[0])==0 && RICK45B_LastErrorCode()==RICK45B_ERR_NULL_ADT);  /*success leaves the last error alone*/
 
     assert(RICK45BSTACK_ContainedInStack(NULL, strings[2])==-1 && strcmp("Invalid argument: stack cannot be NULL!", RICK45B_GetError())==0);
     assert(RICK45BSTACK_ContainedInStack(stack, NULL)==-1 && strcmp("Invalid argument: key cannot be NULL!", RICK45B_GetError())==0);
@@ -197,3 +212,207 @@ void error_StackQueueTEST()
     assert(RICK45BQUEUE_ContainedInQueue(NULL, NULL)==-1 && strcmp("Invalid argument: queue cannot be NULL!", RICK45B_GetError())==0);
     RICK45BQUEUE_QueueDestroy(queue, 0);
 }
+
+void *CountingAlloc(size_t size, void *ctx)
+{
+    (*(int *)ctx)++;
+    return malloc(size);
+}
+
+void CountingFree(void *ptr, void *ctx)
+{
+    (*(int *)ctx)--;
+    free(ptr);
+}
+
+void allocator_StackQueueTEST()
+{
+    char strings[4][100] = {"car", "caterpillar", "Dave", "truck"};
+    int live = 0;   /*number of live allocations made through the allocator*/
+    struct allocator counting = {CountingAlloc, CountingFree, &live};
+
+    stack_t stack = RICK45BSTACK_StackCreateWithAllocator((RICK45B_comparator_t)strcmp, 0, &counting);
+    assert(stack!=NULL && live == 2);   /*the stack and its internal list*/
+    assert(RICK45BSTACK_StackPush(stack, strings[0])==0 && RICK45BSTACK_StackPush(stack, strings[1])==0);
+    assert(live == 4);
+    assert(strcmp(RICK45BSTACK_StackPop(stack), strings[1])==0 && live == 3);
+    RICK45BSTACK_StackDestroy(stack, 0);
+    assert(live == 0);
+
+    queue_t queue = RICK45BQUEUE_QueueCreateWithAllocator((RICK45B_comparator_t)strcmp, 0, &counting);
+    assert(queue!=NULL && live == 2);
+    assert(RICK45BQUEUE_Enqueue(queue, strings[2])==0 && RICK45BQUEUE_Enqueue(queue, strings[3])==0);
+    assert(live == 4);
+    RICK45BQUEUE_QueueDestroy(queue, 0);
+    assert(live == 0);
+
+    /*node pools*/
+    stack = RICK45BSTACK_StackCreateWithAllocator((RICK45B_comparator_t)strcmp, 0, &counting);
+    assert(RICK45BSTACK_StackUseNodePool(stack, 16)==0 && live == 3);
+    int cnt;
+    for (cnt = 0; cnt<32; cnt++)
+        assert(RICK45BSTACK_StackPush(stack, strings[cnt%4])==0);
+    assert(live == 5);
+    assert(strcmp(RICK45BSTACK_StackPop(stack), strings[3])==0 && live == 5);
+    RICK45BSTACK_StackDestroy(stack, 0);
+    assert(live == 0);
+
+    queue = RICK45BQUEUE_QueueCreateWithAllocator((RICK45B_comparator_t)strcmp, 0, &counting);
+    assert(RICK45BQUEUE_QueueUseNodePool(queue, 16)==0 && live == 3);
+    assert(RICK45BQUEUE_Enqueue(queue, strings[2])==0 && live == 4);
+    RICK45BQUEUE_QueueDestroy(queue, 0);
+    assert(live == 0);
+    assert(RICK45BQUEUE_QueueUseNodePool(NULL, 16)==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_NULL_ADT);
+}
+
+void toArray_StackQueueTEST()
+{
+    char strings[4][100] = {"car", "caterpillar", "Dave", "truck"};
+    void *array[4];
+    void **copy;
+    int cnt;
+
+    stack_t stack = RICK45BSTACK_StackCreate((RICK45B_comparator_t)strcmp, 0);
+    queue_t queue = RICK45BQUEUE_QueueCreate((RICK45B_comparator_t)strcmp, 0);
+    assert(RICK45BSTACK_StackToArray(NULL, array, 0)==NULL && RICK45B_LastErrorCode()==RICK45B_ERR_NULL_ADT);
+    assert(RICK45BQUEUE_QueueToArray(NULL, array, 0)==NULL && RICK45B_LastErrorCode()==RICK45B_ERR_NULL_ADT);
+    assert(RICK45BSTACK_StackToArray(stack, array, 0)==array && RICK45BQUEUE_QueueToArray(queue, array, 1)==array);
+    for (cnt = 0; cnt<4; cnt++)
+    {
+        assert(RICK45BSTACK_StackPush(stack, strings[cnt])==0);
+        assert(RICK45BQUEUE_Enqueue(queue, strings[cnt])==0);
+    }
+
+    /*stack: from the top to the bottom, queue: from the front to the rear*/
+    assert(RICK45BSTACK_StackToArray(stack, array, 0)==array);
+    for (cnt = 0; cnt<4; cnt++)
+        assert(array[cnt] == strings[3-cnt]);
+    copy = RICK45BSTACK_StackToArray(stack, NULL, 1);
+    for (cnt = 0; cnt<4; cnt++)
+        assert(copy[cnt] == strings[cnt]);
+    free(copy);
+    assert(RICK45BQUEUE_QueueToArray(queue, array, 0)==array && array[0] == RICK45BQUEUE_Peek(queue));
+    for (cnt = 0; cnt<4; cnt++)
+        assert(array[cnt] == strings[cnt]);
+    copy = RICK45BQUEUE_QueueToArray(queue, NULL, 1);
+    for (cnt = 0; cnt<4; cnt++)
+        assert(copy[cnt] == strings[3-cnt]);
+    free(copy);
+    assert(RICK45BSTACK_GetStackSize(stack)==4 && RICK45BQUEUE_GetQueueSize(queue)==4);
+
+    RICK45BSTACK_StackDestroy(stack, 0);
+    RICK45BQUEUE_QueueDestroy(queue, 0);
+}
+
+size_t HashString(const void *key)
+{
+    const unsigned char *string = key;
+    size_t hash = 5381;
+    while (*string)
+        hash = hash*33+*string++;
+    return hash;
+}
+
+void hashIndex_StackQueueTEST()
+{
+    char strings[4][100] = {"car", "caterpillar", "Dave", "truck"};
+    char copy[100] = "Dave";
+    int cnt;
+
+    stack_t stack = RICK45BSTACK_StackCreate((RICK45B_comparator_t)strcmp, 0);
+    queue_t queue = RICK45BQUEUE_QueueCreate((RICK45B_comparator_t)strcmp, 0);
+    assert(RICK45BSTACK_StackUseHashIndex(NULL, HashString)==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_NULL_ADT);
+    assert(RICK45BQUEUE_QueueUseHashIndex(NULL, HashString)==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_NULL_ADT);
+    assert(RICK45BSTACK_StackPush(stack, strings[0])==0);
+    assert(RICK45BSTACK_StackUseHashIndex(stack, HashString)==0 && RICK45BQUEUE_QueueUseHashIndex(queue, HashString)==0);
+    assert(RICK45BSTACK_StackUseHashIndex(stack, HashString)==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_INVALID_ARGUMENT);
+    for (cnt = 1; cnt<4; cnt++)
+        assert(RICK45BSTACK_StackPush(stack, strings[cnt])==0);
+    for (cnt = 0; cnt<3; cnt++)
+        assert(RICK45BQUEUE_Enqueue(queue, strings[cnt])==0);
+
+    /*equal keys are found, even if they are different strings*/
+    assert(RICK45BSTACK_ContainedInStack(stack, copy)==1 && RICK45BQUEUE_ContainedInQueue(queue, copy)==1);
+    assert(RICK45BQUEUE_ContainedInQueue(queue, strings[3])==0);
+    assert(strcmp(RICK45BSTACK_StackPop(stack), "truck")==0);
+    assert(RICK45BSTACK_ContainedInStack(stack, strings[3])==0 && RICK45BSTACK_ContainedInStack(stack, strings[0])==1);
+    while (RICK45BSTACK_StackPop(stack)!=NULL);
+    assert(RICK45BSTACK_ContainedInStack(stack, strings[0])==0);
+
+    RICK45BSTACK_StackDestroy(stack, 0);
+    RICK45BQUEUE_QueueDestroy(queue, 0);
+}
+
+void array_StackTEST()
+{
+    char strings[4][100] = {"car", "caterpillar", "Dave", "truck"};
+    char copy[100] = "Dave";
+    void *array[4];
+    int live = 0;
+    struct allocator counting = {CountingAlloc, CountingFree, &live};
+    int cnt;
+
+    assert(RICK45BSTACK_StackUseArray(NULL, 4)==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_NULL_ADT);
+    stack_t stack = RICK45BSTACK_StackCreateWithAllocator((RICK45B_comparator_t)strcmp, 0, &counting);
+    assert(RICK45BSTACK_StackPush(stack, strings[0])==0);
+    assert(RICK45BSTACK_StackUseArray(stack, 2)==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_INVALID_ARGUMENT);
+    assert(RICK45BSTACK_StackPop(stack)==strings[0] && live == 2);
+    assert(RICK45BSTACK_StackUseArray(stack, 2)==0 && live == 3 && stack->capacity == 2);
+    assert(RICK45BSTACK_StackUseArray(stack, 2)==-1 && RICK45BSTACK_StackUseNodePool(stack, 16)==-1);
+    assert(RICK45BSTACK_StackUseHashIndex(stack, HashString)==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_INVALID_ARGUMENT);
+    assert(RICK45BSTACK_StackTop(stack)==NULL && RICK45BSTACK_StackPop(stack)==NULL && RICK45BSTACK_IsEmpty(stack)==1);
+
+    /*same behaviour as the list-backed stack*/
+    for (cnt = 0; cnt<4; cnt++)
+        assert(RICK45BSTACK_StackPush(stack, strings[cnt])==0);
+    assert(stack->capacity == 4 && live == 3 && RICK45BSTACK_GetStackSize(stack)==4 && RICK45BSTACK_IsFull(stack)==0);
+    assert(RICK45BSTACK_IsTop(stack, strings[3])==1 && RICK45BSTACK_IsTop(stack, strings[2])==0);
+    assert(RICK45BSTACK_ContainedInStack(stack, copy)==1 && RICK45BSTACK_ContainedInStack(stack, "bus")==0);
+    assert(RICK45BSTACK_StackToArray(stack, array, 0)==array);
+    for (cnt = 0; cnt<4; cnt++)
+        assert(array[cnt] == strings[3-cnt]);
+    assert(RICK45BSTACK_StackToArray(stack, array, 1)==array);
+    for (cnt = 0; cnt<4; cnt++)
+        assert(array[cnt] == strings[cnt]);
+    assert(RICK45BSTACK_StackPop(stack)==strings[3] && RICK45BSTACK_StackTop(stack)==strings[2]);
+    assert(RICK45BSTACK_ContainedInStack(stack, strings[3])==0 && RICK45BSTACK_IsTop(stack, copy)==1);
+
+    /*once grown, pushes and pops don't allocate anymore*/
+    for (cnt = 0; cnt<1000; cnt++)
+    {
+        assert(RICK45BSTACK_StackPush(stack, strings[cnt%4])==0 && RICK45BSTACK_StackPush(stack, strings[cnt%4])==0);
+        assert(RICK45BSTACK_StackPop(stack)==strings[cnt%4]);
+    }
+    assert(RICK45BSTACK_GetStackSize(stack)==1003 && stack->capacity == 1024 && live == 3);
+    while (RICK45BSTACK_StackPop(stack)!=NULL);
+    for (cnt = 0; cnt<1024; cnt++)
+        assert(RICK45BSTACK_StackPush(stack, strings[0])==0);
+    assert(live == 3 && RICK45BSTACK_IsEmpty(stack)==0);
+    RICK45BSTACK_StackDestroy(stack, 0);
+    assert(live == 0);
+
+    /*max dimension: the array never grows past it*/
+    stack = RICK45BSTACK_StackCreateWithAllocator((RICK45B_comparator_t)strcmp, 5, &counting);
+    assert(RICK45BSTACK_StackUseArray(stack, 0)==0 && stack->capacity == 5);
+    RICK45BSTACK_StackDestroy(stack, 0);
+    stack = RICK45BSTACK_StackCreateWithAllocator((RICK45B_comparator_t)strcmp, 5, &counting);
+    assert(RICK45BSTACK_StackUseArray(stack, 2)==0);
+    for (cnt = 0; cnt<5; cnt++)
+        assert(RICK45BSTACK_StackPush(stack, strings[cnt%4])==0 && RICK45BSTACK_IsFull(stack)==(cnt==4));
+    assert(stack->capacity == 5 && RICK45BSTACK_GetStackSize(stack)==5);
+    assert(RICK45BSTACK_StackPush(stack, strings[0])==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_FULL);
+    assert(RICK45BSTACK_StackPop(stack)==strings[0] && RICK45BSTACK_IsFull(stack)==0);
+    RICK45BSTACK_StackDestroy(stack, 0);
+    assert(live == 0);
+
+    /*delete_bool frees the keys left in the array*/
+    stack = RICK45BSTACK_StackCreate((RICK45B_comparator_t)strcmp, 0);
+    assert(RICK45BSTACK_StackUseArray(stack, 1)==0);
+    for (cnt = 0; cnt<3; cnt++)
+    {
+        char *key = malloc(100);
+        strcpy(key, strings[cnt]);
+        assert(RICK45BSTACK_StackPush(stack, key)==0);
+    }
+    RICK45BSTACK_StackDestroy(stack, 1);
+}
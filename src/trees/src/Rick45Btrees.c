@@ -25,44 +25,105 @@
 #include "Rick45B-AlgorithmsADT.h"
 
 Btree_t RICK45BTREES_BtreeCreate(RICK45B_comparator_t key_cmp)
+{
+    return RICK45BTREES_BtreeCreateWithAllocator(key_cmp, NULL);
+}
+
+Btree_t RICK45BTREES_BtreeCreateWithAllocator(RICK45B_comparator_t key_cmp, allocator_t allocator)
 {
     if (key_cmp == NULL)
     {
-        RICK45B_CopyString("Invalid Argument: key_cmp function cannot be NULL!", RICK45B.GetError, sizeof("Invalid Argument: key_cmp function cannot be NULL!"));
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: key_cmp function cannot be NULL!");
+        return NULL;
+    }
+    if (allocator != NULL && (allocator->alloc_funct == NULL || allocator->free_funct == NULL))
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: the allocator's functions cannot be NULL!");
         return NULL;
     }
 
+    struct allocator alloc = RICK45B_PickAllocator(allocator);
     Btree_t out = NULL;
-    out = mallocFun(sizeof(struct binaryTree));
+    out = RICK45B_Alloc(&alloc, sizeof(struct binaryTree));
 
     if (out == NULL)
     {
-        RICK45B_CopyString("Fatal Error: Cannot allocate memory for new Btree_t type. Perhaps the heap is full?", RICK45B.GetError, sizeof("Fatal Error: Cannot allocate memory for new Btree_t type. Perhaps the heap is full?"));
+        RICK45B_SetError(RICK45B_ERR_NO_MEMORY, "Fatal Error: Cannot allocate memory for new Btree_t type. Perhaps the heap is full?");
         return NULL;
     }
 
     out->root = NULL;
     out->key_cmp = key_cmp;
     out->treeType = 2;  //the tree can have 2 childs max
+    out->allocator = alloc;
+    out->nodeAllocator = alloc;
+    out->pool = NULL;
     return out;
 }
 
 int RICK45BTREES_BtreeDestroy(Btree_t Btree, int delete_value, int delete_key)
 {
-    int opt[] = {delete_value, delete_key};
-    int out = RICK45BTREES_BtreeforEach(Btree, RICK45BTREES_BtreeforEachDeleteNode, opt);
-    freeFun(Btree);
-    return out;
+    if (Btree == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Invalid Argument: the binary search tree cannot be NULL!");
+        return -1;
+    }
+    if (Btree->pool != NULL)    /*the nodes are released all at once, together with their pool*/
+    {
+        if (delete_value || delete_key)
+            RICK45BTREES_BtreeDestroyImpl(Btree, Btree->root, delete_value, delete_key);
+        RICK45B_NodePoolDestroy(Btree->pool);
+    }
+    else
+        RICK45BTREES_BtreeDestroyImpl(Btree, Btree->root, delete_value, delete_key);
+    RICK45B_Free(&Btree->allocator, Btree);
+    return 0;
+}
+
+int RICK45BTREES_BtreeUseNodePool(Btree_t Btree, size_t nodesPerChunk)
+{
+    if (Btree == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Invalid Argument: the binary search tree cannot be NULL!");
+        return -1;
+    }
+    if (Btree->root != NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: a node pool can only be attached to an empty tree!");
+        return -1;
+    }
+    if (Btree->pool != NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: the tree already uses a node pool!");
+        return -1;
+    }
+    nodePool_t pool = RICK45B_NodePoolCreate(sizeof(struct treeNode), nodesPerChunk, &Btree->allocator);
+    if (pool == NULL)   return -1;
+    Btree->pool = pool;
+    Btree->nodeAllocator = RICK45B_NodePoolAllocator(pool);
+    return 0;
+}
+
+void RICK45BTREES_BtreeDestroyImpl(Btree_t Btree, treeNode_t node, int delete_value, int delete_key)
+{
+    if (node != NULL)
+    {
+        RICK45BTREES_BtreeDestroyImpl(Btree, node->childs[0], delete_value, delete_key);
+        RICK45BTREES_BtreeDestroyImpl(Btree, node->childs[1], delete_value, delete_key);
+        if (delete_value)   freeFun(node->value);
+        if (delete_key) freeFun(node->key);
+        RICK45B_Free(&Btree->nodeAllocator, node);
+    }
 }
 
 int RICK45BTREES_BtreeAddNode(Btree_t Btree, void *key, void *value)
 {
     if (Btree == NULL)
     {
-        RICK45B_CopyString("Invalid Argument: the binary search tree cannot be NULL!", RICK45B.GetError, sizeof("Invalid Argument: the binary search tree cannot be NULL!"));
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Invalid Argument: the binary search tree cannot be NULL!");
         return -1;
     }
-    treeNode_t node = RICK45BTREES_NodeCreate(key, value, Btree->treeType);
+    treeNode_t node = RICK45BTREES_NodeCreate(key, value, Btree->treeType, &Btree->nodeAllocator);
     if (node == NULL) return -1;
 
     if (Btree->root == NULL)
@@ -82,42 +143,37 @@ int RICK45BTREES_BtreeAddNode(Btree_t Btree, void *key, void *value)
     return 0;
 }
 
-treeNode_t RICK45BTREES_NodeCreate(void *key, void *value, unsigned int treeType)
+treeNode_t RICK45BTREES_NodeCreate(void *key, void *value, unsigned int treeType, allocator_t allocator)
 {
     if (key==NULL)
     {
-        RICK45B_CopyString("Invalid Argument: key cannot be NULL!", RICK45B.GetError, sizeof("Invalid Argument: key cannot be NULL!"));
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: key cannot be NULL!");
         return NULL;
     }
     if (value==NULL)
     {
-        RICK45B_CopyString("Invalid Argument: value cannot be NULL!", RICK45B.GetError, sizeof("Invalid Argument: value cannot be NULL!"));
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: value cannot be NULL!");
+        return NULL;
+    }
+    if (treeType>2)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: a treeNode_t can have 2 childs max!");
         return NULL;
     }
 
+    struct allocator alloc = RICK45B_PickAllocator(allocator);
     treeNode_t out = NULL;
-    out = mallocFun(sizeof(struct treeNode));
+    out = RICK45B_Alloc(&alloc, sizeof(struct treeNode));
 
     if (out==NULL)
     {
-        RICK45B_CopyString("Fatal Error: Cannot allocate memory for new treeNode_t type. Perhaps the heap is full?", RICK45B.GetError, sizeof("Fatal Error: Cannot allocate memory for new treeNode_t type. Perhaps the heap is full?"));
+        RICK45B_SetError(RICK45B_ERR_NO_MEMORY, "Fatal Error: Cannot allocate memory for new treeNode_t type. Perhaps the heap is full?");
         return NULL;
     }
     out->key = key;
     out->value = value;
-    out->childs = NULL;
-    out->childs = mallocFun(sizeof(struct treeNode*)*treeType);
-    if (out->childs==NULL)
-    {
-        RICK45B_CopyString("Fatal Error: Cannot allocate memory for all the childs of the new node. Perhaps the heap is full?", RICK45B.GetError, sizeof("Fatal Error: Cannot allocate memory for all the childs of the new node. Perhaps the heap is full?"));
-        return NULL;
-    }
-
-    unsigned int i;
-    for (i=0; i<treeType; i++)  /*Setting all childs to NULL*/
-        (out->childs)[i]=NULL;
-
-
+    out->childs[0] = NULL;
+    out->childs[1] = NULL;
     return out;
 }
 
@@ -125,13 +181,13 @@ int RICK45BTREES_BtreeforEach(Btree_t Btree, RICK45B_forEach_t funct, void *opt)
 {
     if (Btree == NULL)
     {
-        RICK45B_CopyString("Invalid Argument: the binary search tree cannot be NULL!", RICK45B.GetError, sizeof("Invalid Argument: the binary search tree cannot be NULL!"));
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Invalid Argument: the binary search tree cannot be NULL!");
         return -1;
     }
 
     if (funct == NULL)
     {
-        RICK45B_CopyString("Invalid Argument: the binary search tree cannot be NULL!", RICK45B.GetError, sizeof("Invalid Argument: the binary search tree cannot be NULL!"));
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Invalid Argument: the binary search tree cannot be NULL!");
         return -1;
     }
     int state = 0;
@@ -151,39 +207,10 @@ int RICK45BTREES_BtreeforEachImpl(treeNode_t node, RICK45B_forEach_t funct, void
         *state = funct(node, opt);
         if (*state == -1)
         {
-            RICK45B_CopyString("Provided function error!", RICK45B.GetError, sizeof("Provided function error!"));
+            RICK45B_SetError(RICK45B_ERR_CALLBACK, "Provided function error!");
             return -1;
         }
     }
-
-}
-
-int RICK45BTREES_BtreeforEachDeleteNode(void *nodeIn, void *optIn)
-{
-    treeNode_t node = (treeNode_t)nodeIn;
-    int *opt = (int *)optIn;
-
-    if (node == NULL)
-        return -1;
-    if (opt == NULL)
-        return -1;
-    if ((sizeof(opt)/sizeof(int)) != 2)  //the array 'opt' has a different lenght than the expected 2.
-        return -1;
-
-    if (opt[0] !=0 && opt[1] != 0)
-    {
-        freeFun(node->key);
-        freeFun(node->value);
-    }
-    else
-    {
-        if (opt[0] == 0 && opt[1] != 0)
-            freeFun(node->value);
-        if (opt[0] !=0 && opt[1] == 0)
-            freeFun(node->key);
-    }
-    freeFun(node->childs);
-    freeFun(node);
     return 0;
 }
 
@@ -191,12 +218,12 @@ int RICK45BTREES_BtreeRemoveNode(Btree_t Btree, void *key, int delete_value, int
 {
     if (Btree == NULL)
     {
-        RICK45B_CopyString("Invalid Argument: the binary search tree cannot be NULL!", RICK45B.GetError, sizeof("Invalid Argument: the binary search tree cannot be NULL!"));
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Invalid Argument: the binary search tree cannot be NULL!");
         return -1;
     }
     if (key == NULL)
     {
-        RICK45B_CopyString("Invalid Argument: key cannot be NULL!", RICK45B.GetError, sizeof("Invalid Argument: key cannot be NULL!"));
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: key cannot be NULL!");
         return -1;
     }
     Btree->root = RICK45BTREES_BtreeRemoveNodeImpl(Btree, Btree->root, key, delete_value, delete_key);
@@ -231,8 +258,7 @@ treeNode_t RICK45BTREES_BtreeRemoveNodeImpl(Btree_t Btree, treeNode_t node, void
                 else    node = node->childs[0];
                 if (delete_value)   freeFun(old_node->value);
                 if (delete_key) freeFun(old_node->key);
-                if (old_node->childs != NULL)  freeFun(old_node->childs);
-                freeFun(old_node);
+                RICK45B_Free(&Btree->nodeAllocator, old_node);
             }
         }
     }
@@ -243,12 +269,12 @@ treeNode_t RICK45BTREES_BtreeSearchNode(Btree_t Btree, void *key)
 {
     if (Btree == NULL)
     {
-        RICK45B_CopyString("Invalid Argument: the binary search tree cannot be NULL!", RICK45B.GetError, sizeof("Invalid Argument: the binary search tree cannot be NULL!"));
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Invalid Argument: the binary search tree cannot be NULL!");
         return NULL;
     }
     if (key == NULL)
     {
-        RICK45B_CopyString("Invalid Argument: key cannot be NULL!", RICK45B.GetError, sizeof("Invalid Argument: key cannot be NULL!"));
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: key cannot be NULL!");
         return NULL;
     }
     int *returnCode;
@@ -282,19 +308,19 @@ int RICK45BTREES_BtreeIsLeaf(Btree_t Btree, void *key)
 {
     if (Btree == NULL)
     {
-        RICK45B_CopyString("Invalid Argument: the binary search tree cannot be NULL!", RICK45B.GetError, sizeof("Invalid Argument: the binary search tree cannot be NULL!"));
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Invalid Argument: the binary search tree cannot be NULL!");
         return -1;
     }
     if (key == NULL)
     {
-        RICK45B_CopyString("Invalid Argument: key cannot be NULL!", RICK45B.GetError, sizeof("Invalid Argument: key cannot be NULL!"));
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: key cannot be NULL!");
         return -1;
     }
 
     treeNode_t node = RICK45BTREES_BtreeSearchNode(Btree, key);
     if (node == NULL)
     {
-        RICK45B_CopyString("Couldn't find given key inside the binary search tree!", RICK45B.GetError, sizeof("Couldn't find given key inside the binary search tree!"));
+        RICK45B_SetError(RICK45B_ERR_NOT_FOUND, "Couldn't find given key inside the binary search tree!");
         return -1;
     }
     if (node->childs[0]==NULL && node->childs[1]==NULL)
@@ -306,12 +332,12 @@ treeNode_t RICK45BTREES_BtreeFindPrev(Btree_t Btree, treeNode_t node, treeNode_t
 {
     if (node == NULL)
     {
-        RICK45B_CopyString("Invalid Argument: node cannot be NULL!", RICK45B.GetError, sizeof("Invalid Argument: node cannot be NULL!"));
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: node cannot be NULL!");
         return NULL;
     }
     if (root == NULL)
     {
-        RICK45B_CopyString("Invalid Argument: passed base node cannot be NULL!", RICK45B.GetError, sizeof("Invalid Argument: passed base node cannot be NULL!"));
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: passed base node cannot be NULL!");
         return NULL;
     }
 
@@ -332,7 +358,7 @@ treeNode_t RICK45BTREES_BtreeMaxNode(treeNode_t root)
 {
     if (root == NULL)
     {
-        RICK45B_CopyString("Invalid Argument: the root node cannot be NULL!", RICK45B.GetError, sizeof("Invalid Argument: the root node cannot be NULL!"));
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: the root node cannot be NULL!");
         return NULL;
     }
     if (root->childs[1] != NULL)
@@ -345,7 +371,7 @@ treeNode_t RICK45BTREES_BtreeMinNode(treeNode_t root)
 {
     if (root == NULL)
     {
-        RICK45B_CopyString("Invalid Argument: the root node cannot be NULL!", RICK45B.GetError, sizeof("Invalid Argument: the root node cannot be NULL!"));
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: the root node cannot be NULL!");
         return NULL;
     }
     if (root->childs[0] != NULL)
@@ -358,7 +384,7 @@ int RICK45BTREES_BtreeHeight(Btree_t Btree)
 {
     if (Btree == NULL)
     {
-        RICK45B_CopyString("Invalid Argument: the binary search tree cannot be NULL!", RICK45B.GetError, sizeof("Invalid Argument: the binary search tree cannot be NULL!"));
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Invalid Argument: the binary search tree cannot be NULL!");
         return -1;
     }
     return RICK45BTREES_BtreeHeightImpl(Btree->root);
@@ -379,7 +405,7 @@ int RICK45BTREES_BtreeLeavesNum(Btree_t Btree)
 {
     if (Btree == NULL)
     {
-        RICK45B_CopyString("Invalid Argument: the binary search tree cannot be NULL!", RICK45B.GetError, sizeof("Invalid Argument: the binary search tree cannot be NULL!"));
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Invalid Argument: the binary search tree cannot be NULL!");
         return -1;
     }
     return RICK45BTREES_BtreeLeavesNumImpl(Btree, Btree->root);
@@ -399,7 +425,7 @@ int RICK45BTREES_BtreeNodesNum(Btree_t Btree)
 {
     if (Btree == NULL)
     {
-        RICK45B_CopyString("Invalid Argument: the binary search tree cannot be NULL!", RICK45B.GetError, sizeof("Invalid Argument: the binary search tree cannot be NULL!"));
+        RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Invalid Argument: the binary search tree cannot be NULL!");
         return -1;
     }
     return RICK45BTREES_BtreeNodesNumImpl(Btree, Btree->root);
@@ -0,0 +1,142 @@
+/*
+ * @LICENSE: This file has no copyright assigned and is placed in the Public Domain.
+ * @AUTHOR: Riccardo Giovanni Gualiumi 2024
+ * No Software Warranty. The Software and related documentation are provided “AS IS” and without any warranty of any kind and Seller EXPRESSLY DISCLAIMS ALL WARRANTIES, EXPRESS
+ * OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+*/
+
+/*
+ * Benchmark of the BST lookups with the childs stored inline in the node, against the previous layout
+ * (childs kept in a separately allocated array), on trees going from 1K to 1M random keys.
+ * Both trees are built with the same insertion order and searched with the same algorithm, so only
+ * the node layout changes.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "Rick45B-AlgorithmsADT.h"
+
+#define MAX_NODES (1024*1024)
+#define LOOKUPS (4*1024*1024)   /*every measure performs this many lookups*/
+
+int RICK45B_DoubleCMP(const void *a, const void *b){
+    const double *aa = a;
+    const double *bb = b;
+    return (*aa > *bb) - (*aa < *bb);
+}
+
+/*previous layout*/
+struct oldTreeNode{
+    void* key;
+    void* value;
+    struct oldTreeNode **childs;
+};
+typedef struct oldTreeNode* oldTreeNode_t;
+
+oldTreeNode_t OLD_NodeCreate(void *key, void *value)
+{
+    oldTreeNode_t out = malloc(sizeof(struct oldTreeNode));
+    out->key = key;
+    out->value = value;
+    out->childs = malloc(sizeof(struct oldTreeNode*)*2);
+    out->childs[0] = NULL;
+    out->childs[1] = NULL;
+    return out;
+}
+
+oldTreeNode_t OLD_AddNode(oldTreeNode_t root, void *key, void *value)
+{
+    oldTreeNode_t node = OLD_NodeCreate(key, value);
+    if (root == NULL)   return node;
+    oldTreeNode_t visit = root;
+    oldTreeNode_t prev = NULL;
+    while (visit!=NULL)
+    {
+        prev = visit;
+        (RICK45B_DoubleCMP(key, visit->key)<0)?(visit=(visit->childs)[0]):(visit=(visit->childs)[1]);
+    }
+    (RICK45B_DoubleCMP(key, prev->key)<0)?((prev->childs)[0]=node):((prev->childs)[1]=node);
+    return root;
+}
+
+/*the comparator is taken from a Btree_t, so that it is called through a pointer like the library does*/
+oldTreeNode_t OLD_SearchNode(Btree_t Btree, oldTreeNode_t root, void *key)
+{
+    if (root == NULL)
+        return NULL;
+    if (Btree->key_cmp(key, root->key)<0)
+        return OLD_SearchNode(Btree, root->childs[0], key);
+    if (Btree->key_cmp(key, root->key)>0)
+        return OLD_SearchNode(Btree, root->childs[1], key);
+    oldTreeNode_t out = OLD_SearchNode(Btree, root->childs[0], key);
+    if (out==NULL)  return root;
+    return out;
+}
+
+void OLD_Destroy(oldTreeNode_t root)
+{
+    if (root != NULL)
+    {
+        OLD_Destroy(root->childs[0]);
+        OLD_Destroy(root->childs[1]);
+        free(root->childs);
+        free(root);
+    }
+}
+
+volatile size_t sink;   /*keeps the compiler from dropping the measured calls*/
+
+double Elapsed(clock_t start)
+{
+    return (double)(clock()-start)/CLOCKS_PER_SEC;
+}
+
+int main()
+{
+    RICK45B_LibStart(malloc, free);
+    double *keys = malloc(sizeof(double)*MAX_NODES);
+    size_t *order = malloc(sizeof(size_t)*LOOKUPS);
+    if (keys == NULL || order == NULL)
+    {
+        perror("Fatal Error: cannot allocate the benchmark's buffers!");
+        return 1;
+    }
+
+    printf("%10s | %14s %14s   (ns per lookup)\n", "nodes", "old layout", "inline childs");
+    size_t nodes, i;
+    srand(45);
+    for (nodes = 1024; nodes<=MAX_NODES; nodes*=4)
+    {
+        for (i=0; i<nodes; i++)
+            keys[i] = (double)rand()/RAND_MAX;
+        for (i=0; i<LOOKUPS; i++)
+            order[i] = (size_t)rand()%nodes;
+
+        oldTreeNode_t oldRoot = NULL;
+        Btree_t tree = RICK45BTREES_BtreeCreate(RICK45B_DoubleCMP);
+        for (i=0; i<nodes; i++)
+        {
+            oldRoot = OLD_AddNode(oldRoot, &keys[i], &keys[i]);
+            RICK45BTREES_BtreeAddNode(tree, &keys[i], &keys[i]);
+        }
+
+        clock_t start = clock();
+        for (i=0; i<LOOKUPS; i++)
+            sink += (size_t)OLD_SearchNode(tree, oldRoot, &keys[order[i]]);
+        double oldTime = Elapsed(start)*1e9/LOOKUPS;
+
+        start = clock();
+        for (i=0; i<LOOKUPS; i++)
+            sink += (size_t)RICK45BTREES_BtreeSearchNode(tree, &keys[order[i]]);
+        double newTime = Elapsed(start)*1e9/LOOKUPS;
+
+        printf("%10lu | %14.1f %14.1f\n", (unsigned long)nodes, oldTime, newTime);
+        OLD_Destroy(oldRoot);
+        RICK45BTREES_BtreeDestroy(tree, 0, 0);
+    }
+
+    free(keys);
+    free(order);
+    return 0;
+}
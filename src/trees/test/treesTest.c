@@ -31,6 +31,18 @@ int RICK45B_DoubleCMP(const void *a, const void *b){
 
 }
 
+void *CountingAlloc(size_t size, void *ctx)
+{
+    (*(int *)ctx)++;
+    return malloc(size);
+}
+
+void CountingFree(void *ptr, void *ctx)
+{
+    (*(int *)ctx)--;
+    free(ptr);
+}
+
 int main(){
     /*starting the library*/
     RICK45B_LibStart(malloc, free);
@@ -51,10 +63,11 @@ void destroy_createTreesTEST(){
     Btree_t binaryTree = NULL;
     binaryTree = RICK45BTREES_BtreeCreate(RICK45B_DoubleCMP);
     assert(binaryTree!=NULL);
-    treeNode_t temp = RICK45BTREES_NodeCreate("A", &array_values[3], 2);
+    treeNode_t temp = RICK45BTREES_NodeCreate("A", &array_values[3], 2, NULL);
     assert(temp!=NULL && strcmp(temp->key, "A")==0 && RICK45B_DoubleCMP(temp->value, &array_values[3])==0);
-    free(temp->childs);
-    free(temp);
+    assert(temp->childs[0]==NULL && temp->childs[1]==NULL);
+    RICK45B_Free(&RICK45B_DefaultAllocator, temp);   /*created without an allocator: released through the default one*/
+    assert(RICK45BTREES_NodeCreate("A", &array_values[3], 3, NULL)==NULL && RICK45B_LastErrorCode()==RICK45B_ERR_INVALID_ARGUMENT);
     assert(RICK45BTREES_BtreeDestroy(binaryTree, 0, 0)!=-1);
 }
 
@@ -301,6 +314,29 @@ void miscTreesTest()
     assert(RICK45BTREES_BtreeNodesNum(NULL)==-1);   /*Testing error detection*/
 
     assert(RICK45BTREES_BtreeDestroy(binaryTree, 0, 0)!=-1);
+
+    /*testing a tree using its own allocator*/
+    int live = 0;   /*number of live allocations made through the allocator*/
+    struct allocator counting = {CountingAlloc, CountingFree, &live};
+    binaryTree = RICK45BTREES_BtreeCreateWithAllocator(RICK45B_DoubleCMP, &counting);
+    assert(binaryTree!=NULL && live == 1);
+    RICK45BTREES_BtreeAddNode(binaryTree, &array_keys[0], "A");
+    RICK45BTREES_BtreeAddNode(binaryTree, &array_keys[1], "B");
+    RICK45BTREES_BtreeAddNode(binaryTree, &array_keys[2], "C");
+    assert(live == 4);  /*each node is a single allocation, childs included*/
+    assert(RICK45BTREES_BtreeRemoveNode(binaryTree, &array_keys[1], 0, 0)==0 && live == 3);
+    assert(RICK45BTREES_BtreeDestroy(binaryTree, 0, 0)!=-1 && live == 0);
+
+    /*testing a tree using a node pool*/
+    binaryTree = RICK45BTREES_BtreeCreateWithAllocator(RICK45B_DoubleCMP, &counting);
+    assert(RICK45BTREES_BtreeUseNodePool(binaryTree, 0)==0 && live == 2);
+    RICK45BTREES_BtreeAddNode(binaryTree, &array_keys[0], "A");
+    RICK45BTREES_BtreeAddNode(binaryTree, &array_keys[1], "B");
+    RICK45BTREES_BtreeAddNode(binaryTree, &array_keys[2], "C");
+    assert(live == 3 && RICK45BTREES_BtreeNodesNum(binaryTree)==3);
+    assert(RICK45BTREES_BtreeUseNodePool(binaryTree, 0)==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_INVALID_ARGUMENT);
+    assert(RICK45BTREES_BtreeRemoveNode(binaryTree, &array_keys[1], 0, 0)==0 && live == 3);
+    assert(RICK45BTREES_BtreeDestroy(binaryTree, 0, 0)!=-1 && live == 0);
 }
 
 int doubleNodeValue(void *node, void *opt)
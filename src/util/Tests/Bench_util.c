@@ -0,0 +1,120 @@
+/*
+ * @LICENSE: This file has no copyright assigned and is placed in the Public Domain.
+ * @AUTHOR: Riccardo Giovanni Gualiumi 2024
+ * No Software Warranty. The Software and related documentation are provided “AS IS” and without any warranty of any kind and Seller EXPRESSLY DISCLAIMS ALL WARRANTIES, EXPRESS
+ * OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+*/
+
+/*
+ * Benchmark of the util string kernels against the previous (recursive / byte by byte) implementations,
+ * on string lenghts going from 8 bytes to 1 MB.
+ * The previous RICK45B_Stringcmp is O(n^2) and the previous RICK45B_Strlen recurses once per character,
+ * so they are skipped on the lenghts where they would take too long or overflow the stack.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "Rick45B-Utils.h"
+
+#define MAX_LEN (1024*1024)
+#define OLD_STRLEN_MAX_LEN (64*1024)
+#define OLD_STRINGCMP_MAX_LEN (4*1024)
+#define BYTES_PER_RUN (64*1024*1024)    /*every measure processes about this many bytes*/
+
+/*previous implementations*/
+size_t OLD_Strlen(char const *string)
+{
+     if(*string==0)
+      return 0;
+
+    return OLD_Strlen(string+1)+1;
+}
+
+int OLD_Stringcmp(char const *string1, char const *string2)
+{
+    if (OLD_Strlen(string1)!=OLD_Strlen(string2))   return -1;
+    size_t i;
+    for (i=0; i<OLD_Strlen(string1); i++)
+        if (string1[i]!=string2[i]) return 1;
+    return 0;
+}
+
+void OLD_CopyString(char const *source, char *dest, size_t lenght){
+
+    if (lenght>0)
+    {
+        size_t cnt = 0;
+        for (cnt = 0; cnt<lenght; cnt++)
+            dest[cnt] = source[cnt];
+        dest[lenght] = '\0';
+    }
+}
+
+volatile size_t sink;   /*keeps the compiler from dropping the measured calls*/
+
+double Elapsed(clock_t start)
+{
+    return (double)(clock()-start)/CLOCKS_PER_SEC;
+}
+
+/*returns the nanoseconds per call of the given kernel, 'which' selects it.*/
+double Measure(int which, char const *string1, char const *string2, char *dest, size_t len, size_t runs)
+{
+    size_t i;
+    clock_t start = clock();
+    for (i=0; i<runs; i++)
+    {
+        switch (which)
+        {
+            case 0: sink += OLD_Strlen(string1); break;
+            case 1: sink += RICK45B_Strlen(string1); break;
+            case 2: sink += (size_t)OLD_Stringcmp(string1, string2); break;
+            case 3: sink += (size_t)RICK45B_Stringcmp(string1, string2); break;
+            case 4: sink += (size_t)RICK45B_StringEqual(string1, string2); break;
+            case 5: OLD_CopyString(string1, dest, len); sink += (size_t)dest[0]; break;
+            default: RICK45B_CopyString(string1, dest, len); sink += (size_t)dest[0]; break;
+        }
+    }
+    return Elapsed(start)*1e9/(double)runs;
+}
+
+int main()
+{
+    char *string1 = malloc(MAX_LEN+1);
+    char *string2 = malloc(MAX_LEN+1);
+    char *dest = malloc(MAX_LEN+1);
+    if (string1 == NULL || string2 == NULL || dest == NULL)
+    {
+        perror("Fatal Error: cannot allocate the benchmark's buffers!");
+        return 1;
+    }
+
+    printf("%10s | %12s %12s | %12s %12s %12s | %12s %12s   (ns per call)\n", "lenght", "old strlen", "strlen", "old cmp", "cmp", "equal", "old copy", "copy");
+    size_t len;
+    for (len = 8; len<=MAX_LEN; len*=2)
+    {
+        memset(string1, 'x', len);
+        memset(string2, 'x', len);
+        string1[len] = '\0';
+        string2[len] = '\0';
+        size_t runs = BYTES_PER_RUN/len;
+
+        printf("%10lu | ", (unsigned long)len);
+        if (len<=OLD_STRLEN_MAX_LEN)    printf("%12.1f ", Measure(0, string1, string2, dest, len, runs));
+        else    printf("%12s ", "skipped");
+        printf("%12.1f | ", Measure(1, string1, string2, dest, len, runs));
+        if (len<=OLD_STRINGCMP_MAX_LEN) printf("%12.1f ", Measure(2, string1, string2, dest, len, runs/len+1));
+        else    printf("%12s ", "skipped");
+        printf("%12.1f ", Measure(3, string1, string2, dest, len, runs));
+        printf("%12.1f | ", Measure(4, string1, string2, dest, len, runs));
+        printf("%12.1f ", Measure(5, string1, string2, dest, len, runs));
+        printf("%12.1f\n", Measure(6, string1, string2, dest, len, runs));
+    }
+
+    free(string1);
+    free(string2);
+    free(dest);
+    return 0;
+}
@@ -26,6 +26,7 @@ int RICK45B_DoubleCMP(const void *a, const void *b){
 
 void Errors_Test();
 void Functions_Test();
+void NodePool_Test();
 
 int main()
 {
@@ -33,6 +34,8 @@ int main()
     printf("\n***Errors_Test succesful***\n\n");
     Functions_Test();
     printf("\n***Functions_Test succesful***\n\n");
+    NodePool_Test();
+    printf("\n***NodePool_Test succesful***\n\n");
     printf("\n***All test were successful***\n\n");
     return 0;
 }
@@ -40,12 +43,22 @@ int main()
 void Errors_Test()
 {
     /*testing the error setting and retrieval functions*/
-    RICK45B_SetError("Something went wrong!");
+    RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Something went wrong!");
     assert(strcmp("Something went wrong!", RICK45B_GetError())==0);
-    RICK45B_SetError("Cat!!");
+    RICK45B_SetError(RICK45B_ERR_NOT_FOUND, "Cat!!");
     assert(strcmp("Cat!!", RICK45B_GetError())==0);
-    RICK45B_SetError("Can you can a can as a canner can can a can?");
+    RICK45B_SetError(RICK45B_ERR_INTERNAL, "Can you can a can as a canner can can a can?");
     assert(strcmp("Can you can a can as a canner can can a can?", RICK45B_GetError())==0);
+
+    /*messages are no longer copied, so they can't be truncated nor overflow the error slot*/
+    RICK45B_SetError(RICK45B_ERR_NULL_ADT, "Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list.");
+    assert(strcmp("Fatal Error: double linkedList is NULL! Before using it, please consider using RICK45BLISTS_DoubleListCreate to initialize the double linked list.", RICK45B_GetError())==0);
+    assert(RICK45B_LastErrorCode()==RICK45B_ERR_NULL_ADT);
+
+    /*clearing the error state*/
+    RICK45B_ClearError();
+    assert(RICK45B_LastErrorCode()==RICK45B_NO_ERROR);
+    assert(strcmp("", RICK45B_GetError())==0);
 }
 
 void Functions_Test()
@@ -65,4 +78,130 @@ void Functions_Test()
     assert(RICK45B_Stringcmp(string1, string5)==0);
     assert(RICK45B_Stringcmp(string1, string4)>0);
     assert(RICK45B_Stringcmp(string3, string2)==-1);
+    assert(RICK45B_StringEqual(string1, string5)==1);
+    assert(RICK45B_StringEqual(string1, string4)==0);
+    assert(RICK45B_StringEqual(string3, string2)==0);
+    assert(RICK45B_Strlen(NULL)==0);
+
+    /*testing the word-at-a-time kernels on every lenght / alignment combination around a few words*/
+    char buffer1[128];
+    char buffer2[128];
+    char copy[128];
+    size_t offset1, offset2, len;
+    for (offset1 = 0; offset1<2*sizeof(size_t); offset1++)
+        for (offset2 = 0; offset2<2*sizeof(size_t); offset2++)
+            for (len = 0; len<64; len++)
+            {
+                memset(buffer1, 'a', sizeof(buffer1));
+                memset(buffer2, 'a', sizeof(buffer2));
+                buffer1[offset1+len] = '\0';
+                buffer2[offset2+len] = '\0';
+                assert(RICK45B_Strlen(buffer1+offset1)==len);
+                assert(RICK45B_StringEqual(buffer1+offset1, buffer2+offset2)==1);
+                assert(RICK45B_Stringcmp(buffer1+offset1, buffer2+offset2)==0);
+                if (len>0)
+                {
+                    RICK45B_CopyString(buffer1+offset1, copy+offset2, len);
+                    assert(strcmp(buffer1+offset1, copy+offset2)==0);
+                    buffer2[offset2+len-1] = 'b';  /*difference on the last character*/
+                    assert(RICK45B_StringEqual(buffer1+offset1, buffer2+offset2)==0);
+                    assert(RICK45B_Stringcmp(buffer1+offset1, buffer2+offset2)>0);
+                    buffer2[offset2+len-1] = '\0';   /*shorter string*/
+                    assert(RICK45B_StringEqual(buffer1+offset1, buffer2+offset2)==0);
+                    assert(RICK45B_Stringcmp(buffer1+offset1, buffer2+offset2)==-1);
+                }
+            }
+}
+
+void *CountingAlloc(size_t size, void *ctx)
+{
+    (*(int *)ctx)++;
+    return malloc(size);
+}
+
+void CountingFree(void *ptr, void *ctx)
+{
+    (*(int *)ctx)--;
+    free(ptr);
+}
+
+void NodePool_Test()
+{
+    int live = 0;   /*number of live allocations made through the allocator*/
+    struct allocator counting = {CountingAlloc, CountingFree, &live};
+    void *nodes[10];
+    int cnt;
+
+    assert(RICK45B_NodePoolCreate(0, 4, &counting)==NULL && RICK45B_LastErrorCode()==RICK45B_ERR_INVALID_ARGUMENT);
+    nodePool_t pool = RICK45B_NodePoolCreate(3, 4, &counting);
+    assert(pool != NULL && live == 1);
+    assert(pool->nodeSize == sizeof(void *));   /*rounded up so that a free node can hold a pointer*/
+
+    /*10 nodes of 4 per chunk -> 3 chunks*/
+    for (cnt = 0; cnt<10; cnt++)
+    {
+        nodes[cnt] = RICK45B_NodePoolAlloc(pool);
+        assert(nodes[cnt] != NULL && (size_t)nodes[cnt]%sizeof(void *)==0);
+        memset(nodes[cnt], cnt, pool->nodeSize);
+    }
+    assert(live == 4);
+    for (cnt = 0; cnt<10; cnt++)
+        assert(((unsigned char *)nodes[cnt])[0]==cnt);  /*nodes don't overlap*/
+
+    /*released nodes are reused (last released, first reused) without new chunks*/
+    RICK45B_NodePoolFree(pool, nodes[2]);
+    RICK45B_NodePoolFree(pool, nodes[7]);
+    assert(RICK45B_NodePoolAlloc(pool)==nodes[7]);
+    assert(RICK45B_NodePoolAlloc(pool)==nodes[2]);
+    assert(live == 4);
+
+    /*pool backed allocator*/
+    struct allocator poolAllocator = RICK45B_NodePoolAllocator(pool);
+    assert(RICK45B_Alloc(&poolAllocator, pool->nodeSize+1)==NULL && RICK45B_LastErrorCode()==RICK45B_ERR_INVALID_ARGUMENT);
+    void *node = RICK45B_Alloc(&poolAllocator, 1);
+    assert(node != NULL);
+    RICK45B_Free(&poolAllocator, node);
+    assert(RICK45B_NodePoolAlloc(pool)==node);
+
+    /*merged pools: the nodes of either one can be given back to the other, and the chunks live as long as both*/
+    nodePool_t other = RICK45B_NodePoolCreate(sizeof(void *), 4, &counting);
+    nodePool_t wider = RICK45B_NodePoolCreate(2*sizeof(void *), 4, &counting);
+    void *otherNode = RICK45B_NodePoolAlloc(other);
+    assert(live == 7 && RICK45B_NodePoolMerge(pool, wider)==-1 && RICK45B_LastErrorCode()==RICK45B_ERR_INVALID_ARGUMENT);
+    RICK45B_NodePoolDestroy(wider);
+    assert(RICK45B_NodePoolMerge(pool, other)==0 && RICK45B_NodePoolMerged(other) == pool && RICK45B_NodePoolMerged(pool) == pool);
+    assert(RICK45B_NodePoolMerge(other, pool)==0 && live == 6);     /*'other' stays, forwarding to 'pool'*/
+    RICK45B_NodePoolFree(pool, otherNode);
+    assert(RICK45B_NodePoolAlloc(other) == otherNode && other->freeNodes == NULL);
+    for (cnt = 0; cnt<4; cnt++)     /*the never used nodes of both newest chunks aren't lost*/
+        assert(RICK45B_NodePoolAlloc(pool) != NULL);
+    assert(live == 6);
+    RICK45B_NodePoolDestroy(pool);
+    assert(live == 6);
+    RICK45B_NodePoolDestroy(other);
+    assert(live == 0);
+
+    /*merging keeps the free nodes of both pools, and the never used ones as whole ranges*/
+    void *merged[21];
+    pool = RICK45B_NodePoolCreate(2*sizeof(void *), 8, &counting);
+    other = RICK45B_NodePoolCreate(2*sizeof(void *), 8, &counting);
+    nodePool_t third = RICK45B_NodePoolCreate(2*sizeof(void *), 8, &counting);
+    for (cnt = 0; cnt<7; cnt++)
+        merged[cnt] = RICK45B_NodePoolAlloc(cnt<3 ? pool : cnt<6 ? other : third);
+    RICK45B_NodePoolFree(pool, merged[0]);
+    RICK45B_NodePoolFree(other, merged[3]);
+    RICK45B_NodePoolFree(other, merged[4]);
+    assert(RICK45B_NodePoolMerge(pool, other)==0 && RICK45B_NodePoolMerge(third, pool)==0 && live == 6);
+    for (cnt = 0; cnt<21; cnt++)    /*3 free nodes, then 7+5+5 never used ones, then a new chunk*/
+    {
+        merged[cnt] = RICK45B_NodePoolAlloc(cnt%3==0 ? pool : cnt%3==1 ? other : third);
+        memset(merged[cnt], cnt, pool->nodeSize);
+        assert(live == (cnt<20 ? 6 : 7));
+    }
+    for (cnt = 0; cnt<21; cnt++)
+        assert(((unsigned char *)merged[cnt])[pool->nodeSize-1]==cnt);    /*nodes don't overlap*/
+    RICK45B_NodePoolDestroy(third);
+    RICK45B_NodePoolDestroy(other);
+    RICK45B_NodePoolDestroy(pool);
+    assert(live == 0);
 }
@@ -6,46 +6,375 @@
 */
 
 #include "Rick45B-Utils.h"
-error_rick45b RICK45B;  //needed for the client to get error info.
+RICK45B_THREAD_LOCAL error_rick45b RICK45B = {RICK45B_NO_ERROR, ""};  //needed for the client to get error info.
 free_t freeFun;
 malloc_t mallocFun;
 
+void *RICK45B_DefaultAlloc(size_t size, void *ctx)
+{
+    (void)ctx;
+    return mallocFun(size);
+}
+
+void RICK45B_DefaultFree(void *ptr, void *ctx)
+{
+    (void)ctx;
+    freeFun(ptr);
+}
+
+struct allocator RICK45B_DefaultAllocator = {RICK45B_DefaultAlloc, RICK45B_DefaultFree, NULL};
+
+struct allocator RICK45B_PickAllocator(allocator_t allocator)
+{
+    if (allocator == NULL)
+        return RICK45B_DefaultAllocator;
+    return *allocator;
+}
+
 char *RICK45B_GetError()
 {
-    return RICK45B.GetError;
+    return RICK45B.msg;
 }
 
-void RICK45B_SetError(char *errorMsg)
+RICK45B_errorCode_t RICK45B_LastErrorCode()
+{
+    return RICK45B.code;
+}
+
+void RICK45B_ClearError()
+{
+    RICK45B.code = RICK45B_NO_ERROR;
+    RICK45B.msg = "";
+}
+
+void RICK45B_SetError(RICK45B_errorCode_t code, char *errorMsg)
 {
     if (errorMsg!=NULL)
-        RICK45B_CopyString(errorMsg, RICK45B.GetError, RICK45B_Strlen(errorMsg));
+    {
+        RICK45B.code = code;
+        RICK45B.msg = errorMsg;
+    }
+}
+
+/*
+ * Every chunk of a node pool starts with a header holding the pointer to the previous chunk, padded so that
+ * the nodes that follow it keep the strictest alignment malloc would give them.
+*/
+#define RICK45B_CHUNK_HEADER (2*sizeof(void *))
+
+nodePool_t RICK45B_NodePoolCreate(size_t nodeSize, size_t nodesPerChunk, allocator_t allocator)
+{
+    if (nodeSize == 0)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: nodeSize cannot be 0!");
+        return NULL;
+    }
+    if (allocator != NULL && (allocator->alloc_funct == NULL || allocator->free_funct == NULL))
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: the allocator's functions cannot be NULL!");
+        return NULL;
+    }
+
+    struct allocator alloc = RICK45B_PickAllocator(allocator);
+    nodePool_t out = RICK45B_Alloc(&alloc, sizeof(struct nodePool));
+    if (out == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_NO_MEMORY, "Fatal Error: Cannot allocate memory for new nodePool_t type. Perhaps the heap is full?");
+        return NULL;
+    }
+
+    out->nodeSize = (nodeSize+sizeof(void *)-1)/sizeof(void *)*sizeof(void *);   /*a free node must hold a pointer*/
+    out->nodesPerChunk = nodesPerChunk!=0 ? nodesPerChunk : RICK45B_POOL_DEFAULT_CHUNK;
+    out->freeNodes = NULL;
+    out->freeTail = NULL;
+    out->chunks = NULL;
+    out->chunksTail = NULL;
+    out->bump = NULL;
+    out->bumpEnd = NULL;
+    out->spare = NULL;
+    out->spareTail = NULL;
+    out->allocator = alloc;
+    out->refs = 1;
+    out->forward = NULL;
+    return out;
+}
+
+void RICK45B_NodePoolDestroy(nodePool_t pool)
+{
+    while (pool != NULL && --pool->refs == 0)
+    {
+        nodePool_t forward = pool->forward;     /*a merged pool holds a reference to the one it was merged into*/
+        while (pool->chunks != NULL)
+        {
+            char *chunk = pool->chunks;
+            pool->chunks = *(char **)chunk;
+            RICK45B_Free(&pool->allocator, chunk);
+        }
+        RICK45B_Free(&pool->allocator, pool);
+        pool = forward;
+    }
+}
+
+nodePool_t RICK45B_NodePoolMerged(nodePool_t pool)
+{
+    if (pool != NULL)
+        while (pool->forward != NULL)
+            pool = pool->forward;
+    return pool;
+}
+
+/*keeps the never used nodes in [begin, end) for later allocations, in constant time.*/
+static void RICK45B_NodePoolSpare(nodePool_t pool, char *begin, char *end)
+{
+    if (end-begin < (ptrdiff_t)(2*sizeof(char *)))     /*too small to hold a range: at most one node*/
+    {
+        if (begin != end)
+            RICK45B_NodePoolFree(pool, begin);
+        return;
+    }
+    ((char **)begin)[0] = pool->spare;
+    ((char **)begin)[1] = end;
+    if (pool->spare == NULL)
+        pool->spareTail = begin;
+    pool->spare = begin;
+}
+
+int RICK45B_NodePoolMerge(nodePool_t dst, nodePool_t src)
+{
+    if (dst == NULL || src == NULL)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: the pools cannot be NULL!");
+        return -1;
+    }
+    dst = RICK45B_NodePoolMerged(dst);
+    src = RICK45B_NodePoolMerged(src);
+    if (dst == src)
+        return 0;
+    if (dst->nodeSize != src->nodeSize || dst->allocator.alloc_funct != src->allocator.alloc_funct
+        || dst->allocator.free_funct != src->allocator.free_funct || dst->allocator.ctx != src->allocator.ctx)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: the pools must have the same node size and allocator!");
+        return -1;
+    }
+
+    /*the never used nodes of the bigger of the two newest chunks are kept for the bump allocation, the others are spared*/
+    if (src->bumpEnd-src->bump > dst->bumpEnd-dst->bump)
+    {
+        char *bump = dst->bump, *bumpEnd = dst->bumpEnd;
+        dst->bump = src->bump;
+        dst->bumpEnd = src->bumpEnd;
+        src->bump = bump;
+        src->bumpEnd = bumpEnd;
+    }
+    RICK45B_NodePoolSpare(dst, src->bump, src->bumpEnd);
+    if (src->spare != NULL)
+    {
+        if (dst->spare == NULL)     dst->spareTail = src->spareTail;
+        ((char **)src->spareTail)[0] = dst->spare;
+        dst->spare = src->spare;
+    }
+    if (src->freeNodes != NULL)
+    {
+        if (dst->freeNodes == NULL)     dst->freeTail = src->freeTail;
+        *(void **)src->freeTail = dst->freeNodes;
+        dst->freeNodes = src->freeNodes;
+    }
+    if (src->chunks != NULL)
+    {
+        if (dst->chunks == NULL)    dst->chunksTail = src->chunksTail;
+        *(char **)src->chunksTail = dst->chunks;
+        dst->chunks = src->chunks;
+    }
+    src->freeNodes = src->freeTail = NULL;
+    src->chunks = src->chunksTail = NULL;
+    src->bump = src->bumpEnd = NULL;
+    src->spare = src->spareTail = NULL;
+    src->forward = dst;     /*the owners of 'src' keep using it, through 'dst'*/
+    dst->refs++;
+    return 0;
 }
 
+void *RICK45B_NodePoolAlloc(nodePool_t pool)
+{
+    while (pool->forward != NULL)
+        pool = pool->forward;
+    void *out = pool->freeNodes;
+    if (out != NULL)    /*reusing a released node*/
+    {
+        pool->freeNodes = *(void **)out;
+        return out;
+    }
+
+    if (pool->bump == pool->bumpEnd && pool->spare != NULL)    /*the newest chunk is used up, but a merged pool left some nodes*/
+    {
+        pool->bump = pool->spare;
+        pool->bumpEnd = ((char **)pool->spare)[1];
+        pool->spare = ((char **)pool->spare)[0];
+    }
+    if (pool->bump == pool->bumpEnd)    /*the newest chunk is used up*/
+    {
+        char *chunk = RICK45B_Alloc(&pool->allocator, RICK45B_CHUNK_HEADER+pool->nodeSize*pool->nodesPerChunk);
+        if (chunk == NULL)
+        {
+            RICK45B_SetError(RICK45B_ERR_NO_MEMORY, "Fatal Error: Cannot allocate memory for a new chunk of the node pool. Perhaps the heap is full?");
+            return NULL;
+        }
+        *(char **)chunk = pool->chunks;
+        if (pool->chunks == NULL)
+            pool->chunksTail = chunk;
+        pool->chunks = chunk;
+        pool->bump = chunk+RICK45B_CHUNK_HEADER;
+        pool->bumpEnd = pool->bump+pool->nodeSize*pool->nodesPerChunk;
+    }
+    out = pool->bump;
+    pool->bump += pool->nodeSize;
+    return out;
+}
+
+void RICK45B_NodePoolFree(nodePool_t pool, void *node)
+{
+    if (node != NULL)
+    {
+        while (pool->forward != NULL)
+            pool = pool->forward;
+        *(void **)node = pool->freeNodes;
+        if (pool->freeNodes == NULL)
+            pool->freeTail = node;
+        pool->freeNodes = node;
+    }
+}
+
+static void *RICK45B_NodePoolAllocImpl(size_t size, void *ctx)
+{
+    nodePool_t pool = (nodePool_t)ctx;
+    if (size > pool->nodeSize)
+    {
+        RICK45B_SetError(RICK45B_ERR_INVALID_ARGUMENT, "Invalid Argument: requested size is bigger than the pool's node size!");
+        return NULL;
+    }
+    return RICK45B_NodePoolAlloc(pool);
+}
+
+static void RICK45B_NodePoolFreeImpl(void *ptr, void *ctx)
+{
+    RICK45B_NodePoolFree((nodePool_t)ctx, ptr);
+}
+
+struct allocator RICK45B_NodePoolAllocator(nodePool_t pool)
+{
+    struct allocator out = {RICK45B_NodePoolAllocImpl, RICK45B_NodePoolFreeImpl, NULL};
+    out.ctx = pool;
+    return out;
+}
+
+/*
+ * The string kernels below work one block at a time: a SSE2 register (16 bytes) when the compiler targets
+ * SSE2, a machine word (size_t) otherwise. Reads are always aligned to the block size, so a block read
+ * never crosses a page boundary and can't fault, even when it goes past the terminating '\0' of the string.
+ * Only compiler intrinsics are used, so no libc is required.
+*/
+#ifdef __SSE2__
+#include <emmintrin.h>
+typedef __m128i RICK45B_block_t;
+#define RICK45B_BLOCK_LOAD(ptr) _mm_load_si128((RICK45B_block_t const *)(ptr))
+#define RICK45B_BLOCK_STORE(ptr, block) _mm_store_si128((RICK45B_block_t *)(ptr), (block))
+#define RICK45B_BLOCK_HAS_ZERO(block) _mm_movemask_epi8(_mm_cmpeq_epi8((block), _mm_setzero_si128()))
+#define RICK45B_BLOCK_EQUAL(block1, block2) (_mm_movemask_epi8(_mm_cmpeq_epi8((block1), (block2)))==0xFFFF)
+#else
+typedef size_t __attribute__((__may_alias__)) RICK45B_block_t;
+#define RICK45B_ONES ((size_t)-1/0xFF)      /*0x0101...01*/
+#define RICK45B_HIGHS (RICK45B_ONES*0x80)   /*0x8080...80*/
+#define RICK45B_BLOCK_LOAD(ptr) (*(RICK45B_block_t const *)(ptr))
+#define RICK45B_BLOCK_STORE(ptr, block) (*(RICK45B_block_t *)(ptr) = (block))
+#define RICK45B_BLOCK_HAS_ZERO(block) (((block)-RICK45B_ONES) & ~(block) & RICK45B_HIGHS)  /*!=0 if a byte of block is 0*/
+#define RICK45B_BLOCK_EQUAL(block1, block2) ((block1)==(block2))
+#endif
+
+#define RICK45B_BLOCK_SIZE sizeof(RICK45B_block_t)
+#define RICK45B_BLOCK_MASK (RICK45B_BLOCK_SIZE-1)
+#define RICK45B_OVERREAD __attribute__((no_sanitize_address))  /*the aligned over-read is intended*/
+
 void RICK45B_CopyString(char const *source, char *dest, size_t lenght){
 
     if (lenght>0)
     {
         size_t cnt = 0;
-        for (cnt = 0; cnt<lenght; cnt++)
+        if ((((size_t)source ^ (size_t)dest) & RICK45B_BLOCK_MASK) == 0)   /*same alignment: copy whole blocks*/
+        {
+            while (cnt<lenght && ((size_t)(source+cnt) & RICK45B_BLOCK_MASK))
+            {
+                dest[cnt] = source[cnt];
+                cnt++;
+            }
+            for (; cnt+RICK45B_BLOCK_SIZE<=lenght; cnt+=RICK45B_BLOCK_SIZE)
+                RICK45B_BLOCK_STORE(dest+cnt, RICK45B_BLOCK_LOAD(source+cnt));
+        }
+        for (; cnt<lenght; cnt++)
             dest[cnt] = source[cnt];
         dest[lenght] = '\0';
     }
 }
 
-size_t RICK45B_Strlen(char const *string)
+RICK45B_OVERREAD size_t RICK45B_Strlen(char const *string)
+{
+    if (string == NULL)
+        return 0;
+
+    char const *ptr = string;
+    while ((size_t)ptr & RICK45B_BLOCK_MASK)  /*reaching the first aligned block*/
+    {
+        if (*ptr == '\0')
+            return (size_t)(ptr-string);
+        ptr++;
+    }
+
+    while (!RICK45B_BLOCK_HAS_ZERO(RICK45B_BLOCK_LOAD(ptr)))
+        ptr += RICK45B_BLOCK_SIZE;
+
+    while (*ptr != '\0')    /*the terminator is inside this block*/
+        ptr++;
+    return (size_t)(ptr-string);
+}
+
+RICK45B_OVERREAD int RICK45B_StringEqual(char const *string1, char const *string2)
 {
-     if(*string==0)
-      return 0;
+    if (string1 == NULL || string2 == NULL)
+        return string1 == string2;
 
-    return RICK45B_Strlen(string+1)+1;
+    if ((((size_t)string1 ^ (size_t)string2) & RICK45B_BLOCK_MASK) == 0)   /*same alignment: compare whole blocks*/
+    {
+        while ((size_t)string1 & RICK45B_BLOCK_MASK)
+        {
+            if (*string1 != *string2)
+                return 0;
+            if (*string1 == '\0')
+                return 1;
+            string1++;
+            string2++;
+        }
+
+        RICK45B_block_t block1 = RICK45B_BLOCK_LOAD(string1);
+        while (RICK45B_BLOCK_EQUAL(block1, RICK45B_BLOCK_LOAD(string2)) && !RICK45B_BLOCK_HAS_ZERO(block1))
+        {
+            string1 += RICK45B_BLOCK_SIZE;
+            string2 += RICK45B_BLOCK_SIZE;
+            block1 = RICK45B_BLOCK_LOAD(string1);
+        }
+    }
+
+    while (*string1 == *string2 && *string1 != '\0')   /*finishing byte by byte*/
+    {
+        string1++;
+        string2++;
+    }
+    return *string1 == *string2;
 }
 
 int RICK45B_Stringcmp(char const *string1, char const *string2)
 {
-    if (RICK45B_Strlen(string1)!=RICK45B_Strlen(string2))   return -1;  /*an error has occurred*/
-    size_t i;
-    for (i=0; i<RICK45B_Strlen(string1); i++)
-        if (string1[i]!=string2[i]) return 1;   /*strings are different from each other*/
-    return 0;   /*strings contain the same characters*/
-
+    if (string1 == NULL || string2 == NULL) return -1;  /*an error has occurred*/
+    size_t len = RICK45B_Strlen(string1);
+    if (len!=RICK45B_Strlen(string2))   return -1;  /*an error has occurred*/
+    if (RICK45B_StringEqual(string1, string2))  return 0;   /*strings contain the same characters*/
+    return 1;   /*strings are different from each other*/
 }